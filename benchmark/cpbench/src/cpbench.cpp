@@ -0,0 +1,896 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+#include "nixl.h"
+#include "utils/serdes/serdes.h"
+
+namespace {
+constexpr size_t cpBenchBlockSize = 4096;
+
+// Order of the descriptors in the lists given to NIXL
+enum class cpBenchOrder { SEQUENTIAL, REVERSE, RANDOM };
+
+const cpBenchOrder cpBenchOrders[] = {
+    cpBenchOrder::SEQUENTIAL, cpBenchOrder::REVERSE, cpBenchOrder::RANDOM};
+
+const char *
+orderStr(cpBenchOrder order) {
+    switch (order) {
+    case cpBenchOrder::SEQUENTIAL:
+        return "sequential";
+    case cpBenchOrder::REVERSE:
+        return "reverse";
+    case cpBenchOrder::RANDOM:
+        return "random";
+    }
+    return "unknown";
+}
+
+// Permutation of [0, n) in the given order, the same one on every run
+std::vector<size_t>
+makeOrder(size_t n, cpBenchOrder order) {
+    std::vector<size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    if (order == cpBenchOrder::REVERSE) {
+        std::reverse(perm.begin(), perm.end());
+    } else if (order == cpBenchOrder::RANDOM) {
+        std::mt19937_64 rng(n);
+        std::shuffle(perm.begin(), perm.end(), rng);
+    }
+    return perm;
+}
+
+// Bytes allocated from the heap, including the chunks which are mmap'ed by malloc
+size_t
+heapBytes() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+#else
+    struct mallinfo info = mallinfo();
+#endif
+    return static_cast<size_t>(info.uordblks) + static_cast<size_t>(info.hblkhd);
+}
+
+// Resident set size, which also accounts the memory mapped by the backends
+size_t
+rssBytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t
+growth(size_t before, size_t after) {
+    return after > before ? after - before : 0;
+}
+
+double
+elapsedSec(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// An agent with a single backend and the memory of the benchmarks: local DRAM regions and
+// target regions, in DRAM for network backends and in a file for storage backends. Transfers
+// go from the local regions to the target regions of the agent itself (loopback).
+class cpBenchAgent {
+public:
+    cpBenchAgent(const std::string &name,
+                 const std::string &backend,
+                 size_t num_regions,
+                 size_t region_size,
+                 const nixlAgentConfig &config = nixlAgentConfig(false, false))
+        : name_(name),
+          agent_(name, config),
+          numRegions_(num_regions),
+          regionSize_(region_size),
+          targetSeg_(backend == "POSIX" ? FILE_SEG : DRAM_SEG) {
+        nixl_mem_list_t mems;
+        nixl_b_params_t init_params;
+        nixlBackendH *backend_hndl = nullptr;
+
+        if (agent_.getPluginParams(backend, mems, init_params) != NIXL_SUCCESS ||
+            agent_.createBackend(backend, init_params, backend_hndl) != NIXL_SUCCESS) {
+            error_ = "failed to create backend " + backend;
+            return;
+        }
+        params_.backends.push_back(backend_hndl);
+
+        const size_t total_size = num_regions * region_size;
+        void *local = nullptr;
+        if (posix_memalign(&local, cpBenchBlockSize, total_size) != 0) {
+            error_ = "failed to allocate local memory";
+            return;
+        }
+        local_.reset(static_cast<char *>(local));
+        memset(local, 0, total_size);
+
+        if (targetSeg_ == FILE_SEG) {
+            std::string path =
+                std::string(getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp") + "/cpbench.XXXXXX";
+            fd_ = mkstemp(path.data());
+            if (fd_ < 0 || ftruncate(fd_, total_size) != 0) {
+                error_ = "failed to create target file in " + path;
+                return;
+            }
+            unlink(path.c_str());
+        } else {
+            void *target = nullptr;
+            if (posix_memalign(&target, cpBenchBlockSize, total_size) != 0) {
+                error_ = "failed to allocate target memory";
+                return;
+            }
+            target_.reset(static_cast<char *>(target));
+            memset(target, 0, total_size);
+        }
+    }
+
+    ~cpBenchAgent() {
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+
+    const std::string &
+    error() const {
+        return error_;
+    }
+
+    const std::string &
+    name() const {
+        return name_;
+    }
+
+    nixlAgent &
+    agent() {
+        return agent_;
+    }
+
+    const nixl_opt_args_t *
+    params() const {
+        return &params_;
+    }
+
+    // Registration list of the local or target regions, in the given order of the regions
+    nixl_reg_dlist_t
+    regDlist(bool target, const std::vector<size_t> &order) const {
+        nixl_reg_dlist_t dlist(target ? targetSeg_ : DRAM_SEG);
+        for (size_t region : order) {
+            dlist.addDesc(nixlBlobDesc(regionAddr(target, region), regionSize_, devId(target)));
+        }
+        return dlist;
+    }
+
+    // Transfer list of num_descs blocks spread round robin over the local or target regions,
+    // in the given order of the blocks
+    nixl_xfer_dlist_t
+    xferDlist(bool target, const std::vector<size_t> &order) const {
+        nixl_xfer_dlist_t dlist(target ? targetSeg_ : DRAM_SEG);
+        for (size_t desc : order) {
+            uintptr_t addr = regionAddr(target, desc % numRegions_) +
+                (desc / numRegions_) * cpBenchBlockSize;
+            dlist.addDesc(nixlBasicDesc(addr, cpBenchBlockSize, devId(target)));
+        }
+        return dlist;
+    }
+
+    bool
+    registerAll() {
+        auto order = makeOrder(numRegions_, cpBenchOrder::SEQUENTIAL);
+        if (agent_.registerMem(regDlist(false, order), &params_) != NIXL_SUCCESS ||
+            agent_.registerMem(regDlist(true, order), &params_) != NIXL_SUCCESS) {
+            error_ = "failed to register memory";
+            return false;
+        }
+        registered_ = true;
+        return true;
+    }
+
+    void
+    deregisterAll() {
+        if (registered_) {
+            auto order = makeOrder(numRegions_, cpBenchOrder::SEQUENTIAL);
+            agent_.deregisterMem(regDlist(false, order), &params_);
+            agent_.deregisterMem(regDlist(true, order), &params_);
+            registered_ = false;
+        }
+    }
+
+private:
+    struct freeDeleter {
+        void
+        operator()(char *ptr) const {
+            free(ptr);
+        }
+    };
+
+    uintptr_t
+    regionAddr(bool target, size_t region) const {
+        if (target && targetSeg_ == FILE_SEG) {
+            return region * regionSize_; // File offset
+        }
+        return reinterpret_cast<uintptr_t>((target ? target_ : local_).get()) +
+            region * regionSize_;
+    }
+
+    uint64_t
+    devId(bool target) const {
+        return target && targetSeg_ == FILE_SEG ? fd_ : 0;
+    }
+
+    std::string name_;
+    nixlAgent agent_;
+    nixl_opt_args_t params_;
+    size_t numRegions_;
+    size_t regionSize_;
+    nixl_mem_t targetSeg_;
+    std::unique_ptr<char, freeDeleter> local_;
+    std::unique_ptr<char, freeDeleter> target_;
+    int fd_ = -1;
+    bool registered_ = false;
+    std::string error_;
+};
+
+// Time per item (region or descriptor) and memory retained by every operation
+void
+setCounters(benchmark::State &state, size_t items, size_t heap_delta, size_t rss_delta) {
+    const double ops = std::max<double>(state.iterations(), 1);
+    state.SetItemsProcessed(state.iterations() * items);
+    state.counters["time_per_item"] = benchmark::Counter(
+        items, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    state.counters["heap_per_op"] =
+        benchmark::Counter(heap_delta / ops, benchmark::Counter::kDefaults,
+                           benchmark::Counter::kIs1024);
+    state.counters["rss_per_op"] =
+        benchmark::Counter(rss_delta / ops, benchmark::Counter::kDefaults,
+                           benchmark::Counter::kIs1024);
+}
+
+void
+benchRegisterMem(benchmark::State &state, std::string backend, cpBenchOrder order, bool reg) {
+    const size_t num_regions = state.range(0);
+    cpBenchAgent bench("cpbench", backend, num_regions, cpBenchBlockSize);
+    if (!bench.error().empty()) {
+        state.SkipWithError(bench.error().c_str());
+        return;
+    }
+
+    // Registration of the target regions, which are the ones of the storage backends
+    nixl_reg_dlist_t dlist = bench.regDlist(true, makeOrder(num_regions, order));
+    size_t heap_delta = 0, rss_delta = 0;
+
+    for (auto _ : state) {
+        if (!reg && bench.agent().registerMem(dlist, bench.params()) != NIXL_SUCCESS) {
+            state.SkipWithError("registerMem failed");
+            break;
+        }
+
+        size_t heap = heapBytes(), rss = rssBytes();
+        auto start = std::chrono::steady_clock::now();
+        nixl_status_t status = reg ? bench.agent().registerMem(dlist, bench.params()) :
+                                     bench.agent().deregisterMem(dlist, bench.params());
+        state.SetIterationTime(elapsedSec(start));
+        if (status != NIXL_SUCCESS) {
+            state.SkipWithError(reg ? "registerMem failed" : "deregisterMem failed");
+            break;
+        }
+
+        if (reg) {
+            heap_delta += growth(heap, heapBytes());
+            rss_delta += growth(rss, rssBytes());
+            bench.agent().deregisterMem(dlist, bench.params());
+        }
+    }
+
+    setCounters(state, num_regions, heap_delta, rss_delta);
+}
+
+// Metadata codecs, with which agents compress the metadata fetched by their peers
+const char *const cpBenchCodecs[] = {"none", "lz4", "zstd"};
+
+// Compresses metadata as an agent does for a peer which advertised the codec
+bool
+compressMD(const std::string &codec_name, nixl_blob_t &md) {
+    nixl_serdes_codec_t codec;
+    nixlSerDes sd;
+    if (nixlSerDes::parseCodec(codec_name, codec) != NIXL_SUCCESS ||
+        sd.importStr(md) != NIXL_SUCCESS) {
+        return false;
+    }
+
+    md = sd.exportStr(codec);
+    return true;
+}
+
+void
+benchGetLocalMD(benchmark::State &state, std::string backend, std::string codec) {
+    const size_t num_regions = state.range(0);
+    cpBenchAgent bench("cpbench", backend, num_regions, cpBenchBlockSize);
+    if (!bench.error().empty() || !bench.registerAll()) {
+        state.SkipWithError(bench.error().c_str());
+        return;
+    }
+
+    nixl_blob_t md;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        nixl_status_t status = bench.agent().getLocalMD(md);
+        const bool compressed = status == NIXL_SUCCESS && compressMD(codec, md);
+        state.SetIterationTime(elapsedSec(start));
+        if (!compressed) {
+            state.SkipWithError("getLocalMD failed");
+            break;
+        }
+        benchmark::DoNotOptimize(md);
+    }
+
+    setCounters(state, num_regions, 0, 0);
+    state.counters["md_bytes"] = md.size();
+    bench.deregisterAll();
+}
+
+void
+benchLoadRemoteMD(benchmark::State &state, std::string backend, std::string codec) {
+    const size_t num_regions = state.range(0);
+    cpBenchAgent target("cpbench_target", backend, num_regions, cpBenchBlockSize);
+    cpBenchAgent initiator("cpbench_initiator", backend, 1, cpBenchBlockSize);
+    if (!target.error().empty() || !initiator.error().empty() || !target.registerAll()) {
+        state.SkipWithError(!target.error().empty() ? target.error().c_str() :
+                                                      initiator.error().c_str());
+        return;
+    }
+
+    nixl_blob_t md;
+    if (target.agent().getLocalMD(md) != NIXL_SUCCESS || !compressMD(codec, md)) {
+        state.SkipWithError("getLocalMD failed");
+        return;
+    }
+
+    size_t heap_delta = 0, rss_delta = 0;
+    for (auto _ : state) {
+        std::string remote_name;
+        size_t heap = heapBytes(), rss = rssBytes();
+        auto start = std::chrono::steady_clock::now();
+        nixl_status_t status = initiator.agent().loadRemoteMD(md, remote_name);
+        state.SetIterationTime(elapsedSec(start));
+        if (status != NIXL_SUCCESS) {
+            state.SkipWithError("loadRemoteMD failed");
+            break;
+        }
+
+        heap_delta += growth(heap, heapBytes());
+        rss_delta += growth(rss, rssBytes());
+        initiator.agent().invalidateRemoteMD(remote_name);
+    }
+
+    setCounters(state, num_regions, heap_delta, rss_delta);
+    state.counters["md_bytes"] = md.size();
+    target.deregisterAll();
+}
+
+// Bulk load of many regions given in some order: registerMem of the target regions,
+// getLocalPartialMD of them and loadRemoteMD of the partial metadata by a second agent
+void
+benchBulkLoad(benchmark::State &state, std::string backend, cpBenchOrder order) {
+    const size_t num_regions = state.range(0);
+    cpBenchAgent target("cpbench_target", backend, num_regions, cpBenchBlockSize);
+    cpBenchAgent initiator("cpbench_initiator", backend, 1, cpBenchBlockSize);
+    if (!target.error().empty() || !initiator.error().empty()) {
+        state.SkipWithError(!target.error().empty() ? target.error().c_str() :
+                                                      initiator.error().c_str());
+        return;
+    }
+
+    nixl_reg_dlist_t dlist = target.regDlist(true, makeOrder(num_regions, order));
+    double register_sec = 0, partial_md_sec = 0, load_sec = 0;
+
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        if (target.agent().registerMem(dlist, target.params()) != NIXL_SUCCESS) {
+            state.SkipWithError("registerMem failed");
+            break;
+        }
+        const double reg = elapsedSec(start);
+
+        nixl_blob_t md;
+        start = std::chrono::steady_clock::now();
+        nixl_status_t status = target.agent().getLocalPartialMD(dlist, md, target.params());
+        const double partial_md = elapsedSec(start);
+
+        std::string remote_name;
+        double load = 0;
+        if (status == NIXL_SUCCESS) {
+            start = std::chrono::steady_clock::now();
+            status = initiator.agent().loadRemoteMD(md, remote_name);
+            load = elapsedSec(start);
+        }
+
+        state.SetIterationTime(reg + partial_md + load);
+        register_sec += reg;
+        partial_md_sec += partial_md;
+        load_sec += load;
+
+        if (status == NIXL_SUCCESS) {
+            initiator.agent().invalidateRemoteMD(remote_name);
+        }
+        target.agent().deregisterMem(dlist, target.params());
+        if (status != NIXL_SUCCESS) {
+            state.SkipWithError("getLocalPartialMD or loadRemoteMD failed");
+            break;
+        }
+    }
+
+    setCounters(state, num_regions, 0, 0);
+    const auto per_op_us = benchmark::Counter::kAvgIterations;
+    state.counters["register_us"] = benchmark::Counter(register_sec * 1e6, per_op_us);
+    state.counters["partial_md_us"] = benchmark::Counter(partial_md_sec * 1e6, per_op_us);
+    state.counters["load_us"] = benchmark::Counter(load_sec * 1e6, per_op_us);
+}
+
+// Transfer request creation steps, on num_descs descriptors over num_regions regions.
+// CREATE_POST is createXferReq followed by postXferReq, the completion is not timed.
+enum class cpBenchXferOp { PREP_LOCAL, PREP_REMOTE, MAKE, CREATE, CREATE_POST };
+
+void
+benchXferReq(benchmark::State &state,
+             std::string backend,
+             cpBenchOrder order,
+             cpBenchXferOp op) {
+    const size_t num_regions = state.range(0);
+    const size_t num_descs = state.range(1);
+    const size_t blocks_per_region = (num_descs + num_regions - 1) / num_regions;
+    cpBenchAgent bench("cpbench", backend, num_regions, blocks_per_region * cpBenchBlockSize);
+    if (!bench.error().empty() || !bench.registerAll()) {
+        state.SkipWithError(bench.error().c_str());
+        return;
+    }
+
+    nixlAgent &agent = bench.agent();
+    const auto desc_order = makeOrder(num_descs, order);
+    nixl_xfer_dlist_t local_descs = bench.xferDlist(false, desc_order);
+    nixl_xfer_dlist_t remote_descs = bench.xferDlist(true, desc_order);
+
+    // makeXferReq selects the descriptors of handles prepared in sequential order
+    nixlDlistH *local_hndl = nullptr, *remote_hndl = nullptr;
+    std::vector<int> indices(desc_order.begin(), desc_order.end());
+    if (op == cpBenchXferOp::MAKE) {
+        const auto seq_order = makeOrder(num_descs, cpBenchOrder::SEQUENTIAL);
+        if (agent.prepXferDlist(NIXL_INIT_AGENT,
+                                bench.xferDlist(false, seq_order),
+                                local_hndl,
+                                bench.params()) != NIXL_SUCCESS ||
+            agent.prepXferDlist(bench.name(),
+                                bench.xferDlist(true, seq_order),
+                                remote_hndl,
+                                bench.params()) != NIXL_SUCCESS) {
+            state.SkipWithError("prepXferDlist failed");
+            bench.deregisterAll();
+            return;
+        }
+    }
+
+    size_t heap_delta = 0, rss_delta = 0;
+    for (auto _ : state) {
+        nixlDlistH *dlist_hndl = nullptr;
+        nixlXferReqH *req_hndl = nullptr;
+        nixl_status_t status = NIXL_SUCCESS;
+        size_t heap = heapBytes(), rss = rssBytes();
+        auto start = std::chrono::steady_clock::now();
+
+        switch (op) {
+        case cpBenchXferOp::PREP_LOCAL:
+            status = agent.prepXferDlist(NIXL_INIT_AGENT, local_descs, dlist_hndl, bench.params());
+            break;
+        case cpBenchXferOp::PREP_REMOTE:
+            status = agent.prepXferDlist(bench.name(), remote_descs, dlist_hndl, bench.params());
+            break;
+        case cpBenchXferOp::MAKE:
+            status = agent.makeXferReq(
+                NIXL_WRITE, local_hndl, indices, remote_hndl, indices, req_hndl, bench.params());
+            break;
+        case cpBenchXferOp::CREATE:
+        case cpBenchXferOp::CREATE_POST:
+            status = agent.createXferReq(
+                NIXL_WRITE, local_descs, remote_descs, bench.name(), req_hndl, bench.params());
+            if (op == cpBenchXferOp::CREATE_POST && status == NIXL_SUCCESS) {
+                status = agent.postXferReq(req_hndl);
+            }
+            break;
+        }
+
+        state.SetIterationTime(elapsedSec(start));
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus(req_hndl);
+        }
+        if (status != NIXL_SUCCESS) {
+            state.SkipWithError("transfer request creation failed");
+            if (req_hndl) {
+                agent.releaseXferReq(req_hndl);
+            }
+            break;
+        }
+
+        heap_delta += growth(heap, heapBytes());
+        rss_delta += growth(rss, rssBytes());
+        if (dlist_hndl) {
+            agent.releasedDlistH(dlist_hndl);
+        }
+        if (req_hndl) {
+            agent.releaseXferReq(req_hndl);
+        }
+    }
+
+    if (local_hndl) {
+        agent.releasedDlistH(local_hndl);
+    }
+    if (remote_hndl) {
+        agent.releasedDlistH(remote_hndl);
+    }
+    setCounters(state, num_descs, heap_delta, rss_delta);
+    bench.deregisterAll();
+}
+
+// Delay of the listener threads, shorter than the default so that it does not dominate
+constexpr uint64_t cpBenchListenerDelayUs = 1000;
+
+// Listener ports of the agents of the restart benchmarks, a new one for every agent
+int
+nextListenPort() {
+    static int port = getenv("CPBENCH_BASE_PORT") ? atoi(getenv("CPBENCH_BASE_PORT")) : 19500;
+    return port++;
+}
+
+// Time to first transfer of a restarted agent: creation of the agent, fetch of the metadata of a
+// target agent with num_regions regions through the listener threads, and a first transfer to
+// it. With a warm metadata cache, the unchanged metadata of the target is loaded from the cache.
+void
+benchRestart(benchmark::State &state, std::string backend, bool warm) {
+    const size_t num_regions = state.range(0);
+    nixlAgentConfig target_config(false, true, nextListenPort());
+    target_config.lthrDelay = cpBenchListenerDelayUs;
+    cpBenchAgent target("cpbench_target", backend, num_regions, cpBenchBlockSize, target_config);
+    if (!target.error().empty() || !target.registerAll()) {
+        state.SkipWithError(target.error().c_str());
+        return;
+    }
+
+    char dir_template[] = "/tmp/cpbench_md_cache_XXXXXX";
+    if (!mkdtemp(dir_template)) {
+        state.SkipWithError("failed to create the metadata cache directory");
+        return;
+    }
+    const std::string cache_dir = dir_template;
+    setenv("NIXL_METADATA_CACHE_DIR", cache_dir.c_str(), 1);
+
+    nixl_opt_args_t fetch_args;
+    fetch_args.ipAddr = "127.0.0.1";
+    fetch_args.port = target_config.listenPort;
+    const auto order = makeOrder(1, cpBenchOrder::SEQUENTIAL);
+    nixl_xfer_dlist_t remote_descs = target.xferDlist(true, order);
+
+    // Runs the restarted agent up to the completion of its first transfer
+    const auto restart = [&]() -> const char * {
+        nixlAgentConfig config(false, true, nextListenPort());
+        config.lthrDelay = cpBenchListenerDelayUs;
+        cpBenchAgent initiator("cpbench_initiator", backend, 1, cpBenchBlockSize, config);
+        if (!initiator.error().empty() || !initiator.registerAll()) {
+            return "failed to create the restarted agent";
+        }
+
+        nixlAgent &agent = initiator.agent();
+        if (agent.fetchRemoteMD(target.name(), &fetch_args) != NIXL_SUCCESS) {
+            return "fetchRemoteMD failed";
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (agent.checkRemoteMD(target.name(), remote_descs) != NIXL_SUCCESS) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return "metadata of the target not loaded";
+            }
+            std::this_thread::yield();
+        }
+
+        nixlXferReqH *req_hndl = nullptr;
+        if (agent.createXferReq(NIXL_WRITE,
+                                initiator.xferDlist(false, order),
+                                remote_descs,
+                                target.name(),
+                                req_hndl,
+                                initiator.params()) != NIXL_SUCCESS) {
+            return "createXferReq failed";
+        }
+
+        nixl_status_t status = agent.postXferReq(req_hndl);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus(req_hndl);
+        }
+        agent.releaseXferReq(req_hndl);
+        initiator.deregisterAll();
+        return status == NIXL_SUCCESS ? nullptr : "transfer failed";
+    };
+
+    const char *error = warm ? restart() : nullptr;
+    for (auto _ : state) {
+        if (error) {
+            break;
+        }
+
+        if (!warm) {
+            std::filesystem::remove_all(cache_dir);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        error = restart();
+        state.SetIterationTime(elapsedSec(start));
+    }
+
+    if (error) {
+        state.SkipWithError(error);
+    }
+    unsetenv("NIXL_METADATA_CACHE_DIR");
+    std::filesystem::remove_all(cache_dir);
+    target.deregisterAll();
+}
+
+// Metadata exchange of num_agents agents through etcd, from the sends of their metadata until
+// every agent loaded the metadata of all the others. Agents fetch every peer, or all of them
+// with a single bulk fetch.
+void
+benchEtcdBringup(benchmark::State &state, bool bulk) {
+    const char *endpoints = getenv("NIXL_ETCD_ENDPOINTS");
+    if (!endpoints || !*endpoints) {
+        state.SkipWithError("NIXL_ETCD_ENDPOINTS is not set");
+        return;
+    }
+
+    const int num_agents = state.range(0);
+    int run = 0;
+    for (auto _ : state) {
+        // A namespace per run, so that the agents of previous runs are not fetched
+        const std::string ns = "/nixl/cpbench/" + std::to_string(getpid()) + "/" +
+            std::to_string(run++);
+        setenv("NIXL_ETCD_NAMESPACE", ns.c_str(), 1);
+
+        std::vector<std::unique_ptr<nixlAgent>> agents;
+        for (int i = 0; i < num_agents; i++) {
+            agents.push_back(
+                std::make_unique<nixlAgent>("agent_" + std::to_string(i), nixlAgentConfig()));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto &agent : agents) {
+            agent->sendLocalMD();
+        }
+        for (int i = 0; i < num_agents; i++) {
+            if (bulk) {
+                agents[i]->fetchAllRemoteMD();
+                continue;
+            }
+            for (int j = 0; j < num_agents; j++) {
+                if (i != j) {
+                    agents[i]->fetchRemoteMD("agent_" + std::to_string(j));
+                }
+            }
+        }
+
+        const nixl_xfer_dlist_t no_descs(DRAM_SEG);
+        bool timed_out = false;
+        for (int i = 0; i < num_agents && !timed_out; i++) {
+            for (int j = 0; j < num_agents && !timed_out; j++) {
+                while (i != j &&
+                       agents[i]->checkRemoteMD("agent_" + std::to_string(j), no_descs) !=
+                           NIXL_SUCCESS) {
+                    if (elapsedSec(start) > 60) {
+                        timed_out = true;
+                        break;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        }
+        state.SetIterationTime(elapsedSec(start));
+
+        for (auto &agent : agents) {
+            agent->invalidateLocalMD();
+        }
+        if (timed_out) {
+            state.SkipWithError("metadata exchange timed out");
+            break;
+        }
+    }
+
+    state.counters["agents"] = num_agents;
+}
+
+std::vector<std::string>
+getBackends(const std::string &list) {
+    std::vector<nixl_backend_t> available;
+    nixlAgent agent("cpbench_probe", nixlAgentConfig(false, false));
+    agent.getAvailPlugins(available);
+
+    std::vector<std::string> backends;
+    std::stringstream ss(list);
+    std::string backend;
+    while (std::getline(ss, backend, ',')) {
+        if (std::find(available.begin(), available.end(), backend) != available.end()) {
+            backends.push_back(backend);
+        } else {
+            std::cerr << "Backend " << backend << " is not available, skipping" << std::endl;
+        }
+    }
+    return backends;
+}
+
+void
+registerBenchmarks(const std::vector<std::string> &backends) {
+    benchmark::RegisterBenchmark("etcdBringup/fetch", benchEtcdBringup, false)
+        ->RangeMultiplier(4)
+        ->Range(16, 256)
+        ->ArgNames({"agents"})
+        ->Iterations(3)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("etcdBringup/fetchAll", benchEtcdBringup, true)
+        ->RangeMultiplier(4)
+        ->Range(16, 256)
+        ->ArgNames({"agents"})
+        ->Iterations(3)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+
+    for (const auto &backend : backends) {
+        for (cpBenchOrder order : cpBenchOrders) {
+            const std::string suffix = "/" + backend + "/" + orderStr(order);
+            benchmark::RegisterBenchmark(
+                ("registerMem" + suffix).c_str(), benchRegisterMem, backend, order, true)
+                ->RangeMultiplier(8)
+                ->Range(1, 1 << 15)
+                ->ArgNames({"regions"})
+                ->UseManualTime()
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(
+                ("deregisterMem" + suffix).c_str(), benchRegisterMem, backend, order, false)
+                ->RangeMultiplier(8)
+                ->Range(1, 1 << 15)
+                ->ArgNames({"regions"})
+                ->UseManualTime()
+                ->Unit(benchmark::kMicrosecond);
+
+            const std::pair<const char *, cpBenchXferOp> xfer_ops[] = {
+                {"prepXferDlist/local", cpBenchXferOp::PREP_LOCAL},
+                {"prepXferDlist/remote", cpBenchXferOp::PREP_REMOTE},
+                {"makeXferReq", cpBenchXferOp::MAKE},
+                {"createXferReq", cpBenchXferOp::CREATE}};
+            for (const auto &[name, op] : xfer_ops) {
+                benchmark::RegisterBenchmark(
+                    (name + suffix).c_str(), benchXferReq, backend, order, op)
+                    ->ArgsProduct({{1, 64, 1024}, {16, 256, 4096, 16384}})
+                    ->ArgNames({"regions", "descs"})
+                    ->UseManualTime()
+                    ->Unit(benchmark::kMicrosecond);
+            }
+
+            benchmark::RegisterBenchmark(("createPostXferReq" + suffix).c_str(),
+                                         benchXferReq,
+                                         backend,
+                                         order,
+                                         cpBenchXferOp::CREATE_POST)
+                ->ArgsProduct({{1}, benchmark::CreateRange(1, 4096, 4)})
+                ->ArgNames({"regions", "descs"})
+                ->UseManualTime()
+                ->Unit(benchmark::kMicrosecond);
+        }
+
+        // Storage backends have no remote agents
+        if (backend != "POSIX") {
+            for (bool warm : {false, true}) {
+                benchmark::RegisterBenchmark(
+                    ("restart/" + backend + (warm ? "/warm" : "/cold")).c_str(),
+                    benchRestart,
+                    backend,
+                    warm)
+                    ->RangeMultiplier(16)
+                    ->Range(1, 1 << 12)
+                    ->ArgNames({"regions"})
+                    ->Iterations(10)
+                    ->UseManualTime()
+                    ->Unit(benchmark::kMillisecond);
+            }
+
+            for (cpBenchOrder order : cpBenchOrders) {
+                benchmark::RegisterBenchmark(
+                    ("bulkLoad/" + backend + "/" + orderStr(order)).c_str(),
+                    benchBulkLoad,
+                    backend,
+                    order)
+                    ->Arg(1000)
+                    ->Arg(10000)
+                    ->Arg(100000)
+                    ->ArgNames({"regions"})
+                    ->Iterations(5)
+                    ->UseManualTime()
+                    ->Unit(benchmark::kMillisecond);
+            }
+        }
+
+        for (const std::string codec : cpBenchCodecs) {
+            const std::string suffix = "/" + backend + "/" + codec;
+            benchmark::RegisterBenchmark(
+                ("getLocalMD" + suffix).c_str(), benchGetLocalMD, backend, codec)
+                ->RangeMultiplier(8)
+                ->Range(1, 1 << 15)
+                ->ArgNames({"regions"})
+                ->UseManualTime()
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(
+                ("loadRemoteMD" + suffix).c_str(), benchLoadRemoteMD, backend, codec)
+                ->RangeMultiplier(8)
+                ->Range(1, 1 << 15)
+                ->ArgNames({"regions"})
+                ->UseManualTime()
+                ->Unit(benchmark::kMicrosecond);
+        }
+    }
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+
+    std::string backend_list = "UCX,POSIX";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--backends=", 0) == 0) {
+            backend_list = arg.substr(strlen("--backends="));
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl
+                      << "Usage: " << argv[0] << " [--backends=UCX,POSIX] [benchmark options]"
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<std::string> backends = getBackends(backend_list);
+    if (backends.empty()) {
+        std::cerr << "No backend to benchmark" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    registerBenchmarks(backends);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return EXIT_SUCCESS;
+}
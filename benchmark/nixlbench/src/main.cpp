@@ -20,6 +20,7 @@
 #include <nixl.h>
 #include <sys/time.h>
 #include "utils/utils.h"
+#include "utils/results.h"
 #include "utils/scope_guard.h"
 #include "worker/nixl/nixl_worker.h"
 #if HAVE_NVSHMEM && HAVE_CUDA
@@ -177,6 +178,10 @@ createWorker() {
 } // namespace
 
 int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "compare") {
+        return xferBenchResults::compare(argc, argv);
+    }
+
     int ret = xferBenchConfig::parseConfig(argc, argv);
     if (0 != ret) {
         return EXIT_FAILURE;
@@ -212,6 +217,11 @@ int main(int argc, char *argv[]) {
     if (worker_ptr->isInitiator() && worker_ptr->isMasterRank()) {
         xferBenchConfig::printConfig();
         xferBenchUtils::printStatsHeader();
+        if (!xferBenchConfig::output_file.empty() &&
+            xferBenchResults::open(
+                xferBenchConfig::output_file, xferBenchConfig::output_format, argc, argv) != 0) {
+            return EXIT_FAILURE;
+        }
     }
 
     for (size_t block_size = xferBenchConfig::start_block_size;
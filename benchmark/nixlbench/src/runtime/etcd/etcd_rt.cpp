@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <cstring>
+#include <limits>
 #include <etcd/SyncClient.hpp>
 #include <etcd/Response.hpp>
 #include "etcd_rt.h"
@@ -304,20 +305,28 @@ int xferBenchEtcdRT::recvChar(char* buffer, size_t count, int src_rank) {
 }
 
 int xferBenchEtcdRT::reduceSumDouble(double *local_value, double *global_value, int dest_rank) {
+    return reduceSumDoubles(local_value, global_value, 1, dest_rank);
+}
+
+int xferBenchEtcdRT::reduceSumDoubles(double *local_values, double *global_values, size_t count,
+                                      int dest_rank) {
     try {
         // Use a deterministic key based on dest_rank to avoid collisions
         std::string reduce_key = makeKey("reduce/dest-" + std::to_string(dest_rank));
         std::string value_key = reduce_key + "/rank-" + std::to_string(my_rank);
 
-        // Contribute our value directly as a string
+        // Contribute our values directly as a space separated string
         std::stringstream ss;
-        ss << std::fixed << std::setprecision(16) << *local_value;
+        ss << std::setprecision(std::numeric_limits<double>::max_digits10);
+        for (size_t i = 0; i < count; ++i) {
+            ss << (i ? " " : "") << local_values[i];
+        }
         client->put(value_key, ss.str());
 
         // If we are the destination rank, collect and reduce
         if (my_rank == dest_rank) {
-            // Initialize the global value with our value
-            *global_value = *local_value;
+            // Initialize the global values with our values
+            std::copy(local_values, local_values + count, global_values);
 
             // Wait for all contributions
             int received = 0;
@@ -347,12 +356,13 @@ int xferBenchEtcdRT::reduceSumDouble(double *local_value, double *global_value,
                         // Get the contribution data as a string
                         auto get_response = client->get(key);
                         if (get_response.error_code() == 0) {
-                            // Convert string directly to double
-                            std::string value_str = get_response.value().as_string();
-                            double contrib_value = std::stod(value_str);
-
-                            // Add to the global value
-                            *global_value += contrib_value;
+                            // Convert string directly to doubles and add to the global values
+                            std::istringstream values(get_response.value().as_string());
+                            for (size_t i = 0; i < count; ++i) {
+                                double contrib_value = 0;
+                                values >> contrib_value;
+                                global_values[i] += contrib_value;
+                            }
 
                             // Remove this contribution
                             client->rm(key);
@@ -90,6 +90,8 @@ public:
     int recvChar(char *buffer, size_t count, int src_rank) override;
 
     int reduceSumDouble(double *local_value, double *global_value, int dest_rank) override;
+    int reduceSumDoubles(double *local_values, double *global_values, size_t count,
+                         int dest_rank) override;
 
     // Barrier synchronization
     int barrier(const std::string& barrier_id) override;
@@ -0,0 +1,314 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "local_rt.h"
+
+namespace {
+// Period of checking for termination while waiting for other ranks
+constexpr int poll_timeout_ms = 1000;
+constexpr char barrier_token = 'B';
+} // namespace
+
+xferBenchLocalRT::xferBenchLocalRT(const int size, int *terminate_input)
+    : my_rank(0),
+      global_size(size),
+      terminate(terminate_input) {}
+
+int
+xferBenchLocalRT::setup() {
+    // Sockets between every pair of ranks, per channel
+    std::vector<std::vector<std::array<int, 2>>> fds(
+        global_size, std::vector<std::array<int, 2>>(global_size, {-1, -1}));
+    for (int i = 0; i < global_size; ++i) {
+        for (int j = i + 1; j < global_size; ++j) {
+            for (int channel = 0; channel < 2; ++channel) {
+                int sv[2];
+                if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) != 0) {
+                    std::cerr << "Failed to create local runtime sockets: " << strerror(errno)
+                              << std::endl;
+                    return -1;
+                }
+                fds[i][j][channel] = sv[0];
+                fds[j][i][channel] = sv[1];
+            }
+        }
+    }
+
+    // Do not duplicate buffered output in the forked ranks
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(nullptr);
+
+    const pid_t parent = getpid();
+    for (int rank = 1; rank < global_size; ++rank) {
+        const pid_t pid = fork();
+        if (pid < 0) {
+            std::cerr << "Failed to fork local rank " << rank << ": " << strerror(errno)
+                      << std::endl;
+            return -1;
+        }
+
+        if (pid == 0) {
+            // Do not outlive rank 0
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            if (getppid() != parent) {
+                std::_Exit(EXIT_FAILURE);
+            }
+            my_rank = rank;
+            children.clear();
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    // Keep only the sockets of this rank
+    for (int i = 0; i < global_size; ++i) {
+        for (int j = 0; j < global_size; ++j) {
+            if (i == my_rank) {
+                continue;
+            }
+            for (int fd : fds[i][j]) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+        }
+    }
+    peer_fds = std::move(fds[my_rank]);
+
+    setRank(my_rank);
+    setSize(global_size);
+
+    std::cout << "Local Runtime: Running as rank " << my_rank << " (pid " << getpid()
+              << ") item " << my_rank + 1 << " of " << global_size << std::endl;
+    return 0;
+}
+
+xferBenchLocalRT::~xferBenchLocalRT() {
+    for (const auto &channels : peer_fds) {
+        for (int fd : channels) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    // Rank 0 reports the failure of any other rank in its exit status
+    bool failed = false;
+    for (size_t i = 0; i < children.size(); ++i) {
+        int status = 0;
+        if (waitpid(children[i], &status, 0) < 0 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != EXIT_SUCCESS) {
+            std::cerr << "Local rank " << i + 1 << " failed" << std::endl;
+            failed = true;
+        }
+    }
+
+    if (failed) {
+        std::_Exit(EXIT_FAILURE);
+    }
+}
+
+int
+xferBenchLocalRT::waitFd(int fd, short events) {
+    struct pollfd pfd = {fd, events, 0};
+    while (!error()) {
+        const int ret = poll(&pfd, 1, poll_timeout_ms);
+        if (ret < 0 && errno != EINTR) {
+            std::cerr << "Local runtime poll failed: " << strerror(errno) << std::endl;
+            return -1;
+        }
+        if (ret > 0) {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int
+xferBenchLocalRT::sendBytes(const void *buffer,
+                            size_t len,
+                            int dest_rank,
+                            xferBenchLocalChannel channel) {
+    if (dest_rank < 0 || dest_rank >= global_size || dest_rank == my_rank) {
+        std::cerr << "Invalid destination rank " << dest_rank << std::endl;
+        return -1;
+    }
+
+    const int fd = peer_fds[dest_rank][channel];
+    const char *data = static_cast<const char *>(buffer);
+    while (len > 0) {
+        if (waitFd(fd, POLLOUT) != 0) {
+            return -1;
+        }
+
+        const ssize_t sent = send(fd, data, len, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            std::cerr << "Failed to send to rank " << dest_rank << ": " << strerror(errno)
+                      << std::endl;
+            return -1;
+        }
+        data += sent;
+        len -= sent;
+    }
+    return 0;
+}
+
+int
+xferBenchLocalRT::recvBytes(void *buffer,
+                            size_t len,
+                            int src_rank,
+                            xferBenchLocalChannel channel) {
+    if (src_rank < 0 || src_rank >= global_size || src_rank == my_rank) {
+        std::cerr << "Invalid source rank " << src_rank << std::endl;
+        return -1;
+    }
+
+    const int fd = peer_fds[src_rank][channel];
+    char *data = static_cast<char *>(buffer);
+    while (len > 0) {
+        if (waitFd(fd, POLLIN) != 0) {
+            return -1;
+        }
+
+        const ssize_t received = recv(fd, data, len, 0);
+        if (received < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            std::cerr << "Failed to receive from rank " << src_rank << ": " << strerror(errno)
+                      << std::endl;
+            return -1;
+        }
+        if (received == 0) {
+            std::cerr << "Rank " << src_rank << " exited" << std::endl;
+            return -1;
+        }
+        data += received;
+        len -= received;
+    }
+    return 0;
+}
+
+int xferBenchLocalRT::sendInt(int *buffer, int dest_rank) {
+    return sendBytes(buffer, sizeof(*buffer), dest_rank, LOCAL_CHANNEL_DATA);
+}
+
+int xferBenchLocalRT::recvInt(int *buffer, int src_rank) {
+    return recvBytes(buffer, sizeof(*buffer), src_rank, LOCAL_CHANNEL_DATA);
+}
+
+int xferBenchLocalRT::sendChar(char *buffer, size_t count, int dest_rank) {
+    return sendBytes(buffer, count, dest_rank, LOCAL_CHANNEL_DATA);
+}
+
+int xferBenchLocalRT::recvChar(char *buffer, size_t count, int src_rank) {
+    return recvBytes(buffer, count, src_rank, LOCAL_CHANNEL_DATA);
+}
+
+int xferBenchLocalRT::broadcastInt(int *buffer, size_t count, int root_rank) {
+    if (my_rank != root_rank) {
+        return recvBytes(buffer, count * sizeof(*buffer), root_rank, LOCAL_CHANNEL_COLL);
+    }
+
+    for (int rank = 0; rank < global_size; ++rank) {
+        if (rank != my_rank &&
+            sendBytes(buffer, count * sizeof(*buffer), rank, LOCAL_CHANNEL_COLL) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int xferBenchLocalRT::reduceSumDouble(double *local_value, double *global_value, int dest_rank) {
+    return reduceSumDoubles(local_value, global_value, 1, dest_rank);
+}
+
+int xferBenchLocalRT::reduceSumDoubles(double *local_values, double *global_values, size_t count,
+                                       int dest_rank) {
+    // As with the etcd runtime, with more than 2 ranks only the initiators, the first half of
+    // the ranks, contribute
+    const int contributors = global_size > 2 ? global_size / 2 : global_size;
+
+    if (my_rank != dest_rank) {
+        if (my_rank >= contributors) {
+            return 0;
+        }
+        return sendBytes(local_values, count * sizeof(*local_values), dest_rank,
+                         LOCAL_CHANNEL_COLL);
+    }
+
+    std::copy(local_values, local_values + count, global_values);
+    std::vector<double> contrib_values(count);
+    for (int rank = 0; rank < contributors; ++rank) {
+        if (rank == my_rank) {
+            continue;
+        }
+
+        if (recvBytes(contrib_values.data(), count * sizeof(double), rank,
+                      LOCAL_CHANNEL_COLL) != 0) {
+            return -1;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            global_values[i] += contrib_values[i];
+        }
+    }
+    return 0;
+}
+
+int xferBenchLocalRT::barrier(const std::string& barrier_id) {
+    char token = barrier_token;
+
+    // Rank 0 releases all the ranks once they all arrived
+    if (my_rank != 0) {
+        if (sendBytes(&token, 1, 0, LOCAL_CHANNEL_COLL) != 0 ||
+            recvBytes(&token, 1, 0, LOCAL_CHANNEL_COLL) != 0) {
+            std::cerr << "Local runtime barrier " << barrier_id << " failed" << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    for (int rank = 1; rank < global_size; ++rank) {
+        if (recvBytes(&token, 1, rank, LOCAL_CHANNEL_COLL) != 0) {
+            std::cerr << "Local runtime barrier " << barrier_id << " failed" << std::endl;
+            return -1;
+        }
+    }
+
+    for (int rank = 1; rank < global_size; ++rank) {
+        if (sendBytes(&token, 1, rank, LOCAL_CHANNEL_COLL) != 0) {
+            std::cerr << "Local runtime barrier " << barrier_id << " failed" << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
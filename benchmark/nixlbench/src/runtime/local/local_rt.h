@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_BENCHMARK_NIXLBENCH_SRC_RUNTIME_LOCAL_LOCAL_RT_H
+#define NIXL_BENCHMARK_NIXLBENCH_SRC_RUNTIME_LOCAL_LOCAL_RT_H
+
+#include <array>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include "runtime/runtime.h"
+
+/**
+ * Single node runtime for XFER benchmark coordination, without an etcd server.
+ * setup() forks the ranks of the benchmark, which are connected to each other
+ * with Unix domain sockets.
+ */
+class xferBenchLocalRT : public xferBenchRT {
+private:
+    // Point to point messages and collectives use separate sockets, so that they
+    // do not need to be ordered with each other
+    enum xferBenchLocalChannel { LOCAL_CHANNEL_DATA = 0, LOCAL_CHANNEL_COLL = 1 };
+
+    int my_rank;
+    int global_size;
+    int *terminate;
+    // Sockets to every other rank, per channel, -1 for this rank
+    std::vector<std::array<int, 2>> peer_fds;
+    // Forked ranks, only set in rank 0
+    std::vector<pid_t> children;
+
+    bool error() const { return terminate != nullptr && *terminate; };
+
+    int sendBytes(const void *buffer, size_t len, int dest_rank, xferBenchLocalChannel channel);
+    int recvBytes(void *buffer, size_t len, int src_rank, xferBenchLocalChannel channel);
+    int waitFd(int fd, short events);
+
+public:
+    xferBenchLocalRT(const int size, int *terminate = nullptr);
+    ~xferBenchLocalRT();
+
+    // Fork size - 1 ranks, the calling process becomes rank 0. Must be called before
+    // creating any thread, as only the calling thread survives in the forked ranks.
+    int
+    setup();
+
+    // Communication methods
+    int sendInt(int *buffer, int dest_rank) override;
+    int recvInt(int *buffer, int src_rank) override;
+    int broadcastInt(int *buffer, size_t count, int root_rank) override;
+    int sendChar(char *buffer, size_t count, int dest_rank) override;
+    int recvChar(char *buffer, size_t count, int src_rank) override;
+
+    int reduceSumDouble(double *local_value, double *global_value, int dest_rank) override;
+    int reduceSumDoubles(double *local_values, double *global_values, size_t count,
+                         int dest_rank) override;
+
+    // Barrier synchronization
+    int barrier(const std::string& barrier_id) override;
+};
+
+#endif // NIXL_BENCHMARK_NIXLBENCH_SRC_RUNTIME_LOCAL_LOCAL_RT_H
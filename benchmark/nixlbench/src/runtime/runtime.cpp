@@ -50,6 +50,11 @@ int xferBenchRT::reduceSumDouble(double *local_buffer, double *global_buffer, in
     return 0;
 }
 
+int xferBenchRT::reduceSumDoubles(double *local_buffer, double *global_buffer, size_t count,
+                                  int dest_rank) {
+    return 0;
+}
+
 int xferBenchRT::barrier(const std::string& barrier_id) {
     return 0;
 }
@@ -38,6 +38,9 @@ class xferBenchRT {
         virtual int sendChar(char *buffer, size_t count, int dest_rank) = 0;
         virtual int recvChar(char *buffer, size_t count, int src_rank) = 0;
         virtual int reduceSumDouble(double *local_value, double *global_value, int dest_rank) = 0;
+        // Element-wise sum of count values in a single reduction
+        virtual int reduceSumDoubles(double *local_values, double *global_values, size_t count,
+                                     int dest_rank) = 0;
 
         // Add a barrier function to synchronize all processes
         virtual int barrier(const std::string& barrier_id) = 0;
@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <sys/utsname.h>
+#include <thread>
+#include <unistd.h>
+
+#include "config.h"
+#include "utils/results.h"
+
+extern char **environ;
+
+namespace {
+// Columns of the CSV output, a record only sets the ones relevant to its type
+const std::vector<std::string> csv_columns = {
+    // Key of the data point
+    "type", "backend", "worker_type", "op_type", "scheme", "mode", "initiator_seg_type",
+    "target_seg_type", "num_threads", "queue_depth", "block_size", "batch_size", "load_pct",
+    // Closed-loop results
+    "num_iter", "bw_gbps", "agg_bw_gbps", "avg_lat_us", "prep_avg_us", "prep_p99_us",
+    "post_avg_us", "post_p99_us", "tx_min_us", "tx_avg_us", "tx_p90_us", "tx_p95_us",
+    "tx_p99_us", "tx_max_us", "wire_avg_us", "wire_p99_us", "notif_avg_us", "notif_p99_us",
+    // Open-loop results
+    "offered_rate", "achieved_rate", "lat_p50_us", "lat_p99_us", "lat_p999_us", "lat_max_us"};
+
+// Columns which identify a data point of a run
+const std::vector<std::string> key_columns = {"type",
+                                              "backend",
+                                              "worker_type",
+                                              "op_type",
+                                              "scheme",
+                                              "mode",
+                                              "initiator_seg_type",
+                                              "target_seg_type",
+                                              "num_threads",
+                                              "queue_depth",
+                                              "block_size",
+                                              "batch_size",
+                                              "load_pct"};
+
+// Metrics checked by compare, a regression is a change in the bad direction beyond the tolerance
+struct compareMetric {
+    const char *name;
+    bool higher_is_better;
+};
+
+const compareMetric compare_metrics[] = {{"bw_gbps", true},
+                                         {"achieved_rate", true},
+                                         {"tx_p99_us", false},
+                                         {"lat_p99_us", false},
+                                         {"lat_p999_us", false}};
+
+std::string
+jsonEscape(const std::string &value) {
+    std::string escaped;
+    for (char c : value) {
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        case '\t':
+            escaped += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                escaped += buf;
+            } else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+std::string
+csvEscape(const std::string &value) {
+    if (value.find_first_of(",\"\n") == std::string::npos) {
+        return value;
+    }
+    std::string escaped = "\"";
+    for (char c : value) {
+        if (c == '"') {
+            escaped += '"';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+std::vector<std::string>
+splitCsv(const std::string &line) {
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+    for (size_t i = 0; i < line.size(); i++) {
+        char c = line[i];
+        if (quoted) {
+            if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                fields.back() += '"';
+                i++;
+            } else if (c == '"') {
+                quoted = false;
+            } else {
+                fields.back() += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.emplace_back();
+        } else {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+// Parse a flat JSON object of string and number values, as written by xferBenchResults
+bool
+parseJsonLine(const std::string &line, xferBenchRecord &record) {
+    size_t pos = 0;
+    auto skip_ws = [&]() {
+        while (pos < line.size() && isspace(static_cast<unsigned char>(line[pos]))) {
+            pos++;
+        }
+    };
+    auto parse_string = [&](std::string &out) {
+        if (pos >= line.size() || line[pos] != '"') {
+            return false;
+        }
+        for (pos++; pos < line.size() && line[pos] != '"'; pos++) {
+            if (line[pos] == '\\' && pos + 1 < line.size()) {
+                char c = line[++pos];
+                if (c == 'n') {
+                    out += '\n';
+                } else if (c == 't') {
+                    out += '\t';
+                } else if (c == 'u') {
+                    // Only written for control characters, which fit in a char
+                    const char *begin = line.data() + pos + 1;
+                    const char *end = begin + 4;
+                    unsigned code = 0;
+                    if (pos + 4 >= line.size() ||
+                        std::from_chars(begin, end, code, 16).ptr != end || code > 0xff) {
+                        return false;
+                    }
+                    out += static_cast<char>(code);
+                    pos += 4;
+                } else {
+                    out += c;
+                }
+            } else {
+                out += line[pos];
+            }
+        }
+        if (pos >= line.size()) {
+            return false;
+        }
+        pos++;
+        return true;
+    };
+
+    skip_ws();
+    if (pos >= line.size() || line[pos++] != '{') {
+        return false;
+    }
+    skip_ws();
+    if (pos < line.size() && line[pos] == '}') {
+        return true;
+    }
+    while (pos < line.size()) {
+        std::string key, value;
+        skip_ws();
+        if (!parse_string(key)) {
+            return false;
+        }
+        skip_ws();
+        if (pos >= line.size() || line[pos++] != ':') {
+            return false;
+        }
+        skip_ws();
+        if (pos < line.size() && line[pos] == '"') {
+            if (!parse_string(value)) {
+                return false;
+            }
+        } else {
+            while (pos < line.size() && line[pos] != ',' && line[pos] != '}' &&
+                   !isspace(static_cast<unsigned char>(line[pos]))) {
+                value += line[pos++];
+            }
+        }
+        record.add(key, value);
+        skip_ws();
+        if (pos >= line.size()) {
+            return false;
+        }
+        if (line[pos] == '}') {
+            return true;
+        }
+        if (line[pos++] != ',') {
+            return false;
+        }
+    }
+    return false;
+}
+
+std::string
+getKey(const xferBenchRecord &record) {
+    std::string key;
+    for (const auto &column : key_columns) {
+        const std::string *value = record.get(column);
+        if (value && !value->empty()) {
+            key += (key.empty() ? "" : " ") + column + "=" + *value;
+        }
+    }
+    return key;
+}
+
+bool
+getDouble(const xferBenchRecord &record, const std::string &key, double &value) {
+    const std::string *str = record.get(key);
+    if (!str || str->empty()) {
+        return false;
+    }
+    try {
+        value = std::stod(*str);
+    }
+    catch (const std::exception &e) {
+        return false;
+    }
+    return std::isfinite(value);
+}
+
+std::string
+getCpuModel() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) {
+                return line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+        }
+    }
+    return "";
+}
+} // namespace
+
+std::ofstream xferBenchResults::out;
+std::string xferBenchResults::format;
+
+xferBenchRecord &
+xferBenchRecord::add(const std::string &key, const std::string &value) {
+    fields.emplace_back(key, value);
+    numeric.push_back(false);
+    return *this;
+}
+
+xferBenchRecord &
+xferBenchRecord::add(const std::string &key, double value) {
+    std::ostringstream ss;
+    if (std::isfinite(value)) {
+        ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    } else {
+        ss << "null";
+    }
+    fields.emplace_back(key, ss.str());
+    numeric.push_back(true);
+    return *this;
+}
+
+const std::vector<std::pair<std::string, std::string>> &
+xferBenchRecord::getFields() const {
+    return fields;
+}
+
+const std::string *
+xferBenchRecord::get(const std::string &key) const {
+    for (const auto &field : fields) {
+        if (field.first == key) {
+            return &field.second;
+        }
+    }
+    return nullptr;
+}
+
+xferBenchRecord
+xferBenchResults::getEnvironment(int argc, char *argv[]) {
+    xferBenchRecord env;
+    char hostname[256] = {};
+    struct utsname uts = {};
+    std::ostringstream cmdline;
+    std::ostringstream timestamp;
+    std::time_t now = std::time(nullptr);
+    std::tm tm = {};
+
+    gethostname(hostname, sizeof(hostname) - 1);
+    uname(&uts);
+    for (int i = 0; i < argc; i++) {
+        cmdline << (i ? " " : "") << argv[i];
+    }
+    gmtime_r(&now, &tm);
+    timestamp << std::put_time(&tm, "%Y-%m-%dT%H:%M:%SZ");
+
+    env.add("type", "environment")
+        .add("nixlbench_version", NIXLBENCH_VERSION)
+        .add("timestamp", timestamp.str())
+        .add("hostname", hostname)
+        .add("kernel", std::string(uts.sysname) + " " + uts.release)
+        .add("arch", uts.machine)
+        .add("cpu_model", getCpuModel())
+        .add("num_cpus", static_cast<double>(std::thread::hardware_concurrency()))
+        .add("command_line", cmdline.str());
+
+    // Transport tuning variables change the results as much as the command line
+    for (char **var = environ; *var; var++) {
+        if (strncmp(*var, "NIXL_", 5) == 0 || strncmp(*var, "UCX_", 4) == 0 ||
+            strncmp(*var, "FI_", 3) == 0) {
+            const char *eq = strchr(*var, '=');
+            if (eq) {
+                env.add("env." + std::string(*var, eq - *var), std::string(eq + 1));
+            }
+        }
+    }
+
+    return env;
+}
+
+int
+xferBenchResults::open(const std::string &path,
+                       const std::string &output_format,
+                       int argc,
+                       char *argv[]) {
+    out.open(path, std::ios::out | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Failed to open output file " << path << ": " << strerror(errno)
+                  << std::endl;
+        return -1;
+    }
+    format = output_format;
+
+    xferBenchRecord env = getEnvironment(argc, argv);
+    if (format == XFERBENCH_OUTPUT_CSV) {
+        for (const auto &[key, value] : env.getFields()) {
+            if (key != "type") {
+                out << "# " << key << "=" << value << "\n";
+            }
+        }
+        for (size_t i = 0; i < csv_columns.size(); i++) {
+            out << (i ? "," : "") << csv_columns[i];
+        }
+        out << std::endl;
+    } else {
+        write(env);
+    }
+
+    return 0;
+}
+
+bool
+xferBenchResults::isOpen() {
+    return out.is_open();
+}
+
+void
+xferBenchResults::write(const xferBenchRecord &record) {
+    if (!out.is_open()) {
+        return;
+    }
+
+    if (format == XFERBENCH_OUTPUT_CSV) {
+        for (size_t i = 0; i < csv_columns.size(); i++) {
+            const std::string *value = record.get(csv_columns[i]);
+            out << (i ? "," : "") << (value ? csvEscape(*value) : "");
+        }
+    } else {
+        out << "{";
+        for (size_t i = 0; i < record.fields.size(); i++) {
+            const auto &[key, value] = record.fields[i];
+            out << (i ? ", " : "") << "\"" << jsonEscape(key) << "\": ";
+            if (record.numeric[i]) {
+                out << value;
+            } else {
+                out << "\"" << jsonEscape(value) << "\"";
+            }
+        }
+        out << "}";
+    }
+    // Flush every record, so that an interrupted run keeps its results
+    out << std::endl;
+}
+
+int
+xferBenchResults::load(const std::string &path, std::vector<xferBenchRecord> &records) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        std::cerr << "Failed to open " << path << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    std::string line;
+    std::vector<std::string> header;
+    size_t line_num = 0;
+    while (std::getline(in, line)) {
+        line_num++;
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') {
+            continue;
+        }
+        if (line.back() == '\r') {
+            line.pop_back();
+        }
+
+        xferBenchRecord record;
+        if (line[start] == '{') {
+            if (!parseJsonLine(line, record)) {
+                std::cerr << path << ":" << line_num << ": invalid JSON record" << std::endl;
+                return -1;
+            }
+        } else if (header.empty()) {
+            header = splitCsv(line);
+            continue;
+        } else {
+            std::vector<std::string> values = splitCsv(line);
+            if (values.size() != header.size()) {
+                std::cerr << path << ":" << line_num << ": expected " << header.size()
+                          << " columns, got " << values.size() << std::endl;
+                return -1;
+            }
+            for (size_t i = 0; i < header.size(); i++) {
+                record.add(header[i], values[i]);
+            }
+        }
+
+        const std::string *type = record.get("type");
+        if (type && *type != "environment") {
+            records.push_back(std::move(record));
+        }
+    }
+
+    return 0;
+}
+
+int
+xferBenchResults::compare(int argc, char *argv[]) {
+    std::vector<std::string> files;
+    double bw_tolerance = 5;
+    double lat_tolerance = 10;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        try {
+            if (arg.rfind("--bw_tolerance=", 0) == 0) {
+                bw_tolerance = std::stod(arg.substr(strlen("--bw_tolerance=")));
+            } else if (arg.rfind("--lat_tolerance=", 0) == 0) {
+                lat_tolerance = std::stod(arg.substr(strlen("--lat_tolerance=")));
+            } else if (arg.rfind("--", 0) == 0) {
+                std::cerr << "Unknown option " << arg << std::endl;
+                return 2;
+            } else {
+                files.push_back(arg);
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Invalid value in " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    if (files.size() != 2) {
+        std::cerr << "Usage: " << argv[0] << " compare <baseline> <candidate> "
+                  << "[--bw_tolerance=PCT] [--lat_tolerance=PCT]" << std::endl;
+        return 2;
+    }
+
+    std::vector<xferBenchRecord> baseline, candidate;
+    if (load(files[0], baseline) != 0 || load(files[1], candidate) != 0) {
+        return 2;
+    }
+
+    std::map<std::string, const xferBenchRecord *> baseline_points;
+    for (const auto &record : baseline) {
+        baseline_points[getKey(record)] = &record;
+    }
+
+    int num_compared = 0, num_regressions = 0, num_missing = 0;
+    for (const auto &record : candidate) {
+        std::string key = getKey(record);
+        auto it = baseline_points.find(key);
+        if (it == baseline_points.end()) {
+            std::cout << "WARN  not in baseline: " << key << std::endl;
+            num_missing++;
+            continue;
+        }
+        const xferBenchRecord &base = *it->second;
+        baseline_points.erase(it);
+        num_compared++;
+
+        for (const auto &metric : compare_metrics) {
+            double old_value, new_value;
+            if (!getDouble(base, metric.name, old_value) ||
+                !getDouble(record, metric.name, new_value) || old_value <= 0) {
+                continue;
+            }
+
+            double change = (new_value - old_value) / old_value * 100;
+            double tolerance = metric.higher_is_better ? bw_tolerance : lat_tolerance;
+            bool regressed = metric.higher_is_better ? (-change > tolerance) :
+                                                       (change > tolerance);
+            if (regressed) {
+                num_regressions++;
+                std::cout << "FAIL  " << key << ": " << metric.name << " " << old_value
+                          << " -> " << new_value << " (" << std::showpos << std::fixed
+                          << std::setprecision(1) << change << "%)" << std::noshowpos
+                          << std::defaultfloat << std::setprecision(6) << std::endl;
+            }
+        }
+    }
+    for (const auto &[key, record] : baseline_points) {
+        std::cout << "WARN  not in candidate: " << key << std::endl;
+        num_missing++;
+    }
+
+    std::cout << "Compared " << num_compared << " data points: " << num_regressions
+              << " regressions (bandwidth tolerance " << bw_tolerance
+              << "%, latency tolerance " << lat_tolerance << "%), " << num_missing
+              << " unmatched" << std::endl;
+
+    return num_regressions > 0 ? 1 : 0;
+}
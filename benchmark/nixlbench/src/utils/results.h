@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __RESULTS_H
+#define __RESULTS_H
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Output formats of the results
+#define XFERBENCH_OUTPUT_JSON "json"
+#define XFERBENCH_OUTPUT_CSV "csv"
+
+// A data point of the results, as ordered key and value pairs
+class xferBenchRecord {
+public:
+    xferBenchRecord &
+    add(const std::string &key, const std::string &value);
+    xferBenchRecord &
+    add(const std::string &key, double value);
+
+    const std::vector<std::pair<std::string, std::string>> &
+    getFields() const;
+    const std::string *
+    get(const std::string &key) const;
+
+private:
+    std::vector<std::pair<std::string, std::string>> fields;
+    std::vector<bool> numeric;
+
+    friend class xferBenchResults;
+};
+
+// Machine-readable results: an environment fingerprint followed by a record per data point,
+// written as JSON lines (one flat object per line) or CSV (fingerprint in # comment lines)
+class xferBenchResults {
+public:
+    // Open the output file and write the environment fingerprint
+    static int
+    open(const std::string &path, const std::string &format, int argc, char *argv[]);
+    static bool
+    isOpen();
+    static void
+    write(const xferBenchRecord &record);
+
+    // Compare the results of a candidate run with a baseline run, returns 0 without
+    // regression, 1 with regressions and 2 on error
+    static int
+    compare(int argc, char *argv[]);
+
+private:
+    static std::ofstream out;
+    static std::string format;
+
+    static xferBenchRecord
+    getEnvironment(int argc, char *argv[]);
+    static int
+    load(const std::string &path, std::vector<xferBenchRecord> &records);
+};
+
+#endif // __RESULTS_H
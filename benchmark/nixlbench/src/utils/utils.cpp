@@ -36,6 +36,7 @@
 
 #include "runtime/etcd/etcd_rt.h"
 #include "utils/neuron.h"
+#include "utils/results.h"
 #include "utils/utils.h"
 
 // Define command line parameters
@@ -53,12 +54,15 @@ NB_ARG_STRING(
     benchmark_group,
     "default",
     "Name of benchmark group. Use different names to run multiple benchmarks in parallel");
-NB_ARG_STRING(runtime_type, XFERBENCH_RT_ETCD, "Runtime type to use for communication [ETCD]");
+NB_ARG_STRING(runtime_type,
+              XFERBENCH_RT_ETCD,
+              "Runtime type to use for communication [ETCD, LOCAL]. LOCAL forks all the "
+              "processes on this node, without an etcd server");
 NB_ARG_STRING(worker_type, XFERBENCH_WORKER_NIXL, "Type of worker [nixl, nvshmem]");
 NB_ARG_STRING(backend,
               XFERBENCH_BACKEND_UCX,
               "Name of NIXL backend [UCX, GDS, GDS_MT, POSIX, GPUNETIO, Mooncake, HF3FS, OBJ, "
-              "GUSLI, AZURE_BLOB] (only used with nixl worker)");
+              "GUSLI, AZURE_BLOB, TCP] (only used with nixl worker)");
 NB_ARG_STRING(initiator_seg_type,
               XFERBENCH_SEG_TYPE_DRAM,
               "Type of memory segment for initiator [DRAM, VRAM]. Note: Storage backends always "
@@ -82,6 +86,27 @@ NB_ARG_INT32(num_iter, 1000, "Max iterations");
 NB_ARG_BOOL(recreate_xfer,
             false,
             "Recreate xfer each iteration (default: false for all backends, true for GUSLI)");
+NB_ARG_BOOL(completion_stats,
+            false,
+            "Report the wire and notification times stamped by the backend on completion "
+            "(enables transfer telemetry capture)");
+NB_ARG_INT32(queue_depth,
+             1,
+             "Number of transfer requests kept outstanding per thread, each one reposted as soon "
+             "as it completes (only used with nixl worker)");
+NB_ARG_STRING(load_levels,
+              "",
+              "Comma separated loads in percent of the measured peak throughput, e.g. 30,60,90. "
+              "Also measures the latency of open-loop transfers offered at every load "
+              "(only used with nixl worker)");
+NB_ARG_STRING(arrival_pattern,
+              XFERBENCH_ARRIVAL_POISSON,
+              "Arrivals of the open-loop transfers: poisson, constant");
+NB_ARG_STRING(output_file,
+              "",
+              "Also write the environment and the results to this file, for comparison with "
+              "'nixlbench compare'");
+NB_ARG_STRING(output_format, XFERBENCH_OUTPUT_JSON, "Format of the output file: json, csv");
 NB_ARG_INT32(large_blk_iter_ftr,
              16,
              "factor to reduce test iteration when testing large block size(>1MB)");
@@ -97,6 +122,16 @@ NB_ARG_BOOL(enable_pt, false, "Enable Progress Thread (only used with nixl worke
 NB_ARG_UINT64(progress_threads, 0, "Number of progress threads");
 NB_ARG_BOOL(enable_vmm, false, "Enable VMM memory allocation when DRAM is requested");
 
+// UCX options - only used when backend is UCX
+NB_ARG_UINT64(ucx_num_workers,
+              0,
+              "Number of UCX workers, 0 means one per benchmark thread plus one");
+NB_ARG_UINT64(ucx_stripe_threshold,
+              0,
+              "Minimum descriptor size (bytes) to stripe across UCX workers. "
+              "0 means striping is disabled");
+NB_ARG_UINT64(ucx_stripe_chunk_size, 4 * 1024 * 1024, "Chunk size (bytes) for UCX striping");
+
 // Storage backend(GDS, GDS_MT, POSIX, HF3FS, OBJ) options
 NB_ARG_STRING(filepath, "", "File path for storage operations");
 NB_ARG_STRING(filenames, "", "Comma-separated filenames for storage operations");
@@ -213,6 +248,13 @@ std::string xferBenchConfig::op_type = "";
 bool xferBenchConfig::check_consistency = false;
 size_t xferBenchConfig::total_buffer_size = 0;
 bool xferBenchConfig::recreate_xfer = false;
+bool xferBenchConfig::completion_stats = false;
+int xferBenchConfig::queue_depth = 1;
+std::string xferBenchConfig::load_levels = "";
+std::vector<double> xferBenchConfig::load_level_pcts;
+std::string xferBenchConfig::arrival_pattern = "";
+std::string xferBenchConfig::output_file = "";
+std::string xferBenchConfig::output_format = "";
 int xferBenchConfig::num_initiator_dev = 0;
 int xferBenchConfig::num_target_dev = 0;
 size_t xferBenchConfig::start_block_size = 0;
@@ -225,6 +267,9 @@ int xferBenchConfig::warmup_iter = 0;
 int xferBenchConfig::num_threads = 0;
 bool xferBenchConfig::enable_pt = false;
 size_t xferBenchConfig::progress_threads = 0;
+size_t xferBenchConfig::ucx_num_workers = 0;
+size_t xferBenchConfig::ucx_stripe_threshold = 0;
+size_t xferBenchConfig::ucx_stripe_chunk_size = 0;
 bool xferBenchConfig::enable_vmm = false;
 std::string xferBenchConfig::device_list = "";
 std::string xferBenchConfig::etcd_endpoints = "";
@@ -342,6 +387,12 @@ xferBenchConfig::loadParams(void) {
             return -1;
         }
 #endif
+        if (backend == XFERBENCH_BACKEND_UCX) {
+            ucx_num_workers = NB_ARG(ucx_num_workers);
+            ucx_stripe_threshold = NB_ARG(ucx_stripe_threshold);
+            ucx_stripe_chunk_size = NB_ARG(ucx_stripe_chunk_size);
+        }
+
         // Load GDS-specific configurations if backend is GDS
         if (backend == XFERBENCH_BACKEND_GDS) {
             gds_batch_pool_size = NB_ARG(gds_batch_pool_size);
@@ -452,14 +503,74 @@ xferBenchConfig::loadParams(void) {
     posix_api_type = NB_ARG(posix_api_type);
     storage_enable_direct = NB_ARG(storage_enable_direct);
     recreate_xfer = NB_ARG(recreate_xfer);
+    completion_stats = NB_ARG(completion_stats);
+    queue_depth = NB_ARG(queue_depth);
     if (!recreate_xfer && XFERBENCH_BACKEND_GUSLI == backend) {
         std::cout << "GUSLI backend requires per-iteration request creation due to library bug."
                   << " Setting recreate_xfer to true." << std::endl;
         recreate_xfer = true;
     }
 
+    if (queue_depth <= 0) {
+        std::cerr << "queue_depth must be greater than 0" << std::endl;
+        return -1;
+    }
+
+    if (queue_depth > 1 && recreate_xfer) {
+        std::cerr << "queue_depth > 1 is not supported when recreating xfer each iteration"
+                  << std::endl;
+        return -1;
+    }
+
+    arrival_pattern = NB_ARG(arrival_pattern);
+    if (arrival_pattern != XFERBENCH_ARRIVAL_POISSON &&
+        arrival_pattern != XFERBENCH_ARRIVAL_CONSTANT) {
+        std::cerr << "Invalid arrival pattern: " << arrival_pattern
+                  << ". Must be one of [poisson, constant]" << std::endl;
+        return -1;
+    }
+
+    output_file = NB_ARG(output_file);
+    output_format = NB_ARG(output_format);
+    if (output_format != XFERBENCH_OUTPUT_JSON && output_format != XFERBENCH_OUTPUT_CSV) {
+        std::cerr << "Invalid output format: " << output_format << ". Must be one of [json, csv]"
+                  << std::endl;
+        return -1;
+    }
+
+    load_levels = NB_ARG(load_levels);
+    load_level_pcts.clear();
+    std::stringstream load_ss(load_levels);
+    std::string load;
+    while (std::getline(load_ss, load, ',')) {
+        try {
+            load_level_pcts.push_back(std::stod(load));
+        }
+        catch (const std::exception &e) {
+            load_level_pcts.push_back(0);
+        }
+
+        if (load_level_pcts.back() <= 0) {
+            std::cerr << "Invalid load level: " << load << ". Must be a positive percentage"
+                      << std::endl;
+            return -1;
+        }
+    }
+
+    if (!load_level_pcts.empty() && recreate_xfer) {
+        std::cerr << "load_levels is not supported when recreating xfer each iteration"
+                  << std::endl;
+        return -1;
+    }
+
+    if (runtime_type != XFERBENCH_RT_ETCD && runtime_type != XFERBENCH_RT_LOCAL) {
+        std::cerr << "Invalid runtime type: " << runtime_type << ". Must be one of [ETCD, LOCAL]"
+                  << std::endl;
+        return -1;
+    }
+
     // Validate ETCD configuration
-    if (!isStorageBackend() && etcd_endpoints.empty()) {
+    if (runtime_type == XFERBENCH_RT_ETCD && !isStorageBackend() && etcd_endpoints.empty()) {
         // For non-storage backends, set default ETCD endpoint
         etcd_endpoints = "http://localhost:2379";
         std::cout << "Using default ETCD endpoint for non-storage backend: " << etcd_endpoints
@@ -560,7 +671,7 @@ xferBenchConfig::printConfig() {
     printSeparator('*');
     std::cout << "NIXLBench Configuration" << std::endl;
     printSeparator('*');
-    printOption("Runtime (--runtime_type=[etcd])", runtime_type);
+    printOption("Runtime (--runtime_type=[ETCD,LOCAL])", runtime_type);
     if (runtime_type == XFERBENCH_RT_ETCD) {
         if (etcd_endpoints.empty()) {
             printOption("ETCD Endpoint ", "disabled (storage backend)");
@@ -570,14 +681,38 @@ xferBenchConfig::printConfig() {
     }
     printOption("Worker type (--worker_type=[nixl,nvshmem])", worker_type);
     if (worker_type == XFERBENCH_WORKER_NIXL) {
-        printOption("Backend (--backend=[UCX,GDS,GDS_MT,POSIX,Mooncake,HF3FS,OBJ,AZURE_BLOB])",
-                    backend);
+        printOption(
+            "Backend (--backend=[UCX,GDS,GDS_MT,POSIX,Mooncake,HF3FS,OBJ,AZURE_BLOB,TCP])",
+            backend);
         printOption("Enable pt (--enable_pt=[0,1])", std::to_string(enable_pt));
         printOption("Progress threads (--progress_threads=N)", std::to_string(progress_threads));
         printOption("Device list (--device_list=dev1,dev2,...)", device_list);
         printOption("Enable VMM (--enable_vmm=[0,1])", std::to_string(enable_vmm));
         printOption("Recreate xfer each iteration (--recreate_xfer=[0,1])",
                     std::to_string(recreate_xfer));
+        printOption("Completion stats (--completion_stats=[0,1])",
+                    std::to_string(completion_stats));
+        printOption("Queue depth (--queue_depth=N)", std::to_string(queue_depth));
+        if (!load_level_pcts.empty()) {
+            printOption("Load levels (--load_levels=P1,P2,...)", load_levels);
+            printOption("Arrival pattern (--arrival_pattern=[poisson,constant])",
+                        arrival_pattern);
+        }
+        if (!output_file.empty()) {
+            printOption("Output file (--output_file=FILE)", output_file);
+            printOption("Output format (--output_format=[json,csv])", output_format);
+        }
+
+        if (backend == XFERBENCH_BACKEND_UCX) {
+            printOption("UCX workers (--ucx_num_workers=N)",
+                        ucx_num_workers > 0 ? std::to_string(ucx_num_workers) : "(default)");
+            printOption("UCX stripe threshold (--ucx_stripe_threshold=N bytes)",
+                        ucx_stripe_threshold > 0 ?
+                            std::to_string(ucx_stripe_threshold) + " (striping enabled)" :
+                            "0 (striping disabled)");
+            printOption("UCX stripe chunk size (--ucx_stripe_chunk_size=N bytes)",
+                        std::to_string(ucx_stripe_chunk_size));
+        }
 
         // Print GDS options if backend is GDS
         if (backend == XFERBENCH_BACKEND_GDS) {
@@ -1069,8 +1204,7 @@ xferBenchUtils::printStatsHeader() {
                   << std::setw(15) << "Avg Post (us)"
                   << std::setw(15) << "P99 Post (us)"
                   << std::setw(15) << "Avg Tx (us)"
-                  << std::setw(15) << "P99 Tx (us)"
-                  << std::endl;
+                  << std::setw(15) << "P99 Tx (us)";
         // clang-format on
     } else {
         // clang-format off
@@ -1084,13 +1218,39 @@ xferBenchUtils::printStatsHeader() {
                   << std::setw(15) << "Avg Post (us)"
                   << std::setw(15) << "P99 Post (us)"
                   << std::setw(15) << "Avg Tx (us)"
-                  << std::setw(15) << "P99 Tx (us)"
-                  << std::endl;
+                  << std::setw(15) << "P99 Tx (us)";
         // clang-format on
     }
+    if (xferBenchConfig::completion_stats) {
+        // clang-format off
+        std::cout << std::setw(15) << "Avg Wire (us)"
+                  << std::setw(15) << "P99 Wire (us)"
+                  << std::setw(15) << "Avg Notif (us)"
+                  << std::setw(15) << "P99 Notif (us)";
+        // clang-format on
+    }
+    std::cout << std::endl;
     xferBenchConfig::printSeparator('-');
 }
 
+static xferBenchRecord
+getResultKey(const std::string &type, size_t block_size, size_t batch_size) {
+    xferBenchRecord record;
+    record.add("type", type)
+        .add("backend", xferBenchConfig::backend)
+        .add("worker_type", xferBenchConfig::worker_type)
+        .add("op_type", xferBenchConfig::op_type)
+        .add("scheme", xferBenchConfig::scheme)
+        .add("mode", xferBenchConfig::mode)
+        .add("initiator_seg_type", xferBenchConfig::initiator_seg_type)
+        .add("target_seg_type", xferBenchConfig::target_seg_type)
+        .add("num_threads", xferBenchConfig::num_threads)
+        .add("queue_depth", xferBenchConfig::queue_depth)
+        .add("block_size", static_cast<double>(block_size))
+        .add("batch_size", static_cast<double>(batch_size));
+    return record;
+}
+
 void
 xferBenchUtils::printStats(bool is_target,
                            size_t block_size,
@@ -1129,6 +1289,29 @@ xferBenchUtils::printStats(bool is_target,
         totalbw = throughput_gb;
     }
 
+    // Merge the load curves of all the initiators, in a single reduction
+    if (!stats.load_curve.empty() && IS_PAIRWISE_AND_SG() && rt->getSize() > 2) {
+        std::vector<double> local_values;
+        for (const auto &point : stats.load_curve) {
+            local_values.push_back(point.offered_rate);
+            local_values.push_back(point.achieved_rate);
+            const auto counts = point.latency.toDoubles();
+            local_values.insert(local_values.end(), counts.begin(), counts.end());
+        }
+
+        std::vector<double> global_values(local_values.size());
+        if (rt->reduceSumDoubles(
+                local_values.data(), global_values.data(), local_values.size(), 0) == 0) {
+            const double *values = global_values.data();
+            for (auto &point : stats.load_curve) {
+                point.offered_rate = values[0];
+                point.achieved_rate = values[1];
+                point.latency.fromDoubles(values + 2);
+                values += 2 + nixlLatencyHistogram::numBuckets;
+            }
+        }
+    }
+
     if (IS_PAIRWISE_AND_SG() && rt->getRank() != 0) {
         return;
     }
@@ -1156,8 +1339,7 @@ xferBenchUtils::printStats(bool is_target,
                   << std::setw(15) << post_duration
                   << std::setw(15) << post_p99_duration
                   << std::setw(15) << transfer_duration
-                  << std::setw(15) << transfer_p99_duration
-                  << std::endl;
+                  << std::setw(15) << transfer_p99_duration;
         // clang-format on
     } else {
         // clang-format off
@@ -1172,10 +1354,84 @@ xferBenchUtils::printStats(bool is_target,
                   << std::setw(15) << post_duration
                   << std::setw(15) << post_p99_duration
                   << std::setw(15) << transfer_duration
-                  << std::setw(15) << transfer_p99_duration
-                  << std::endl;
+                  << std::setw(15) << transfer_p99_duration;
+        // clang-format on
+    }
+    if (xferBenchConfig::completion_stats) {
+        // clang-format off
+        std::cout << std::setw(15) << stats.wire_duration.avg()
+                  << std::setw(15) << stats.wire_duration.p99()
+                  << std::setw(15) << stats.notif_duration.avg()
+                  << std::setw(15) << stats.notif_duration.p99();
         // clang-format on
     }
+    std::cout << std::endl;
+
+    if (!stats.load_curve.empty()) {
+        printLoadCurve(stats.load_curve);
+    }
+
+    if (xferBenchResults::isOpen()) {
+        xferBenchRecord result = getResultKey("result", block_size, batch_size);
+        result.add("num_iter", num_iter)
+            .add("bw_gbps", throughput_gb)
+            .add("agg_bw_gbps", totalbw)
+            .add("avg_lat_us", avg_latency)
+            .add("prep_avg_us", prepare_duration)
+            .add("prep_p99_us", prepare_p99_duration)
+            .add("post_avg_us", post_duration)
+            .add("post_p99_us", post_p99_duration)
+            .add("tx_min_us", stats.transfer_duration.min())
+            .add("tx_avg_us", transfer_duration)
+            .add("tx_p90_us", stats.transfer_duration.p90())
+            .add("tx_p95_us", stats.transfer_duration.p95())
+            .add("tx_p99_us", transfer_p99_duration)
+            .add("tx_max_us", stats.transfer_duration.max());
+        if (xferBenchConfig::completion_stats) {
+            result.add("wire_avg_us", stats.wire_duration.avg())
+                .add("wire_p99_us", stats.wire_duration.p99())
+                .add("notif_avg_us", stats.notif_duration.avg())
+                .add("notif_p99_us", stats.notif_duration.p99());
+        }
+        xferBenchResults::write(result);
+
+        for (const auto &point : stats.load_curve) {
+            xferBenchRecord load = getResultKey("load", block_size, batch_size);
+            load.add("load_pct", point.load_pct)
+                .add("offered_rate", point.offered_rate)
+                .add("achieved_rate", point.achieved_rate)
+                .add("lat_p50_us", point.latency.percentileUs(0.5))
+                .add("lat_p99_us", point.latency.percentileUs(0.99))
+                .add("lat_p999_us", point.latency.percentileUs(0.999))
+                .add("lat_max_us", point.latency.percentileUs(1.0));
+            xferBenchResults::write(load);
+        }
+    }
+}
+
+void
+xferBenchUtils::printLoadCurve(const std::vector<xferBenchLoadPoint> &load_curve) {
+    // clang-format off
+    std::cout << std::left << std::setw(20) << "  Open loop"
+              << std::setw(15) << "Load (%)"
+              << std::setw(20) << "Offered (xfer/s)"
+              << std::setw(20) << "Achieved (xfer/s)"
+              << std::setw(15) << "P50 Lat. (us)"
+              << std::setw(15) << "P99 Lat. (us)"
+              << std::setw(15) << "P999 Lat. (us)"
+              << std::setw(15) << "Max Lat. (us)" << std::endl;
+    for (const auto &point : load_curve) {
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << std::setw(20) << ""
+                  << std::setw(15) << point.load_pct
+                  << std::setw(20) << point.offered_rate
+                  << std::setw(20) << point.achieved_rate
+                  << std::setw(15) << point.latency.percentileUs(0.5)
+                  << std::setw(15) << point.latency.percentileUs(0.99)
+                  << std::setw(15) << point.latency.percentileUs(0.999)
+                  << std::setw(15) << point.latency.percentileUs(1.0) << std::endl;
+    }
+    // clang-format on
 }
 
 std::string
@@ -1511,6 +1767,72 @@ xferMetricStats::clear() {
     samples.clear();
 }
 
+/*
+ * xferBenchHistogram
+ */
+
+xferBenchHistogram::xferBenchHistogram() : counts(nixlLatencyHistogram::numBuckets, 0) {}
+
+void
+xferBenchHistogram::record(uint64_t value_ns) {
+    ++counts[nixlLatencyHistogram::bucketIndex(value_ns)];
+}
+
+void
+xferBenchHistogram::merge(const xferBenchHistogram &other) {
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] += other.counts[i];
+    }
+}
+
+uint64_t
+xferBenchHistogram::count() const {
+    return std::accumulate(counts.begin(), counts.end(), uint64_t(0));
+}
+
+double
+xferBenchHistogram::percentileUs(double q) const {
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * total + 0.5));
+    uint64_t seen = 0;
+    size_t idx = 0;
+    for (; idx < counts.size() - 1; ++idx) {
+        seen += counts[idx];
+        if (seen >= rank) {
+            break;
+        }
+    }
+    return nixlLatencyHistogram::bucketUpperBound(idx) / 1000.0;
+}
+
+std::vector<double>
+xferBenchHistogram::toDoubles() const {
+    return std::vector<double>(counts.begin(), counts.end());
+}
+
+void
+xferBenchHistogram::fromDoubles(const double *values) {
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = static_cast<uint64_t>(values[i]);
+    }
+}
+
+/*
+ * xferBenchLoadPoint
+ */
+
+void
+xferBenchLoadPoint::add(const xferBenchLoadPoint &other) {
+    load_pct = other.load_pct;
+    offered_rate += other.offered_rate;
+    achieved_rate += other.achieved_rate;
+    latency.merge(other.latency);
+}
+
 /*
  * xferBenchStats
  */
@@ -1521,6 +1843,9 @@ xferBenchStats::clear() {
     prepare_duration.clear();
     post_duration.clear();
     transfer_duration.clear();
+    wire_duration.clear();
+    notif_duration.clear();
+    load_curve.clear();
 }
 
 void
@@ -1529,6 +1854,14 @@ xferBenchStats::add(const xferBenchStats &other) {
     prepare_duration.add(other.prepare_duration);
     post_duration.add(other.post_duration);
     transfer_duration.add(other.transfer_duration);
+    wire_duration.add(other.wire_duration);
+    notif_duration.add(other.notif_duration);
+    if (load_curve.size() < other.load_curve.size()) {
+        load_curve.resize(other.load_curve.size());
+    }
+    for (size_t i = 0; i < other.load_curve.size(); ++i) {
+        load_curve[i].add(other.load_curve[i]);
+    }
 }
 
 void
@@ -1537,6 +1870,10 @@ xferBenchStats::reserve(size_t n) {
     prepare_duration.reserve(n);
     post_duration.reserve(n);
     transfer_duration.reserve(n);
+    if (xferBenchConfig::completion_stats) {
+        wire_duration.reserve(n);
+        notif_duration.reserve(n);
+    }
 }
 
 /*
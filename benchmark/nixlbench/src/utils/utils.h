@@ -28,6 +28,7 @@
 #include <optional>
 #include <toml++/toml.hpp>
 #include <utils/common/nixl_time.h>
+#include <telemetry_histogram.h>
 #include "runtime/runtime.h"
 
 #if HAVE_CUDA
@@ -64,6 +65,7 @@
 
 // Runtime types
 #define XFERBENCH_RT_ETCD "ETCD"
+#define XFERBENCH_RT_LOCAL "LOCAL"
 
 // Backend types
 #define XFERBENCH_BACKEND_UCX "UCX"
@@ -78,6 +80,7 @@
 #define XFERBENCH_BACKEND_GUSLI "GUSLI"
 #define XFERBENCH_BACKEND_UCCL "UCCL"
 #define XFERBENCH_BACKEND_AZURE_BLOB "AZURE_BLOB"
+#define XFERBENCH_BACKEND_TCP "TCP"
 
 // POSIX API types
 #define XFERBENCH_POSIX_API_AIO "AIO"
@@ -121,6 +124,10 @@
 #define XFERBENCH_WORKER_NIXL "nixl"
 #define XFERBENCH_WORKER_NVSHMEM "nvshmem"
 
+// Arrival patterns of open-loop transfers
+#define XFERBENCH_ARRIVAL_POISSON "poisson"
+#define XFERBENCH_ARRIVAL_CONSTANT "constant"
+
 #define IS_PAIRWISE_AND_SG()                                 \
     (XFERBENCH_SCHEME_PAIRWISE == xferBenchConfig::scheme && \
      XFERBENCH_MODE_SG == xferBenchConfig::mode)
@@ -141,6 +148,13 @@ public:
     static bool check_consistency;
     static size_t total_buffer_size;
     static bool recreate_xfer;
+    static bool completion_stats;
+    static int queue_depth;
+    static std::string load_levels;
+    static std::vector<double> load_level_pcts;
+    static std::string arrival_pattern;
+    static std::string output_file;
+    static std::string output_format;
     static int num_initiator_dev;
     static int num_target_dev;
     static size_t start_block_size;
@@ -153,6 +167,9 @@ public:
     static int num_threads;
     static bool enable_pt;
     static size_t progress_threads;
+    static size_t ucx_num_workers;
+    static size_t ucx_stripe_threshold;
+    static size_t ucx_stripe_chunk_size;
     static std::string device_list;
     static std::string etcd_endpoints;
     static std::string benchmark_group;
@@ -272,12 +289,53 @@ private:
     std::vector<double> samples;
 };
 
+// Log-linear (HDR-style) histogram of latencies in nanoseconds, with the buckets of
+// nixlLatencyHistogram. Counts are exchanged between ranks as doubles.
+class xferBenchHistogram {
+public:
+    xferBenchHistogram();
+
+    void
+    record(uint64_t value_ns);
+    void
+    merge(const xferBenchHistogram &other);
+    uint64_t
+    count() const;
+    // Upper bound in microseconds of the bucket of the sample at quantile q (0 <= q <= 1)
+    double
+    percentileUs(double q) const;
+
+    std::vector<double>
+    toDoubles() const;
+    void
+    fromDoubles(const double *counts);
+
+private:
+    std::vector<uint64_t> counts;
+};
+
+// Open-loop transfers offered at a percentage of the closed-loop peak throughput
+struct xferBenchLoadPoint {
+    double load_pct = 0;
+    double offered_rate = 0; // Transfers per second
+    double achieved_rate = 0;
+    xferBenchHistogram latency; // From the intended send time to the completion
+
+    void
+    add(const xferBenchLoadPoint &other);
+};
+
 // Stats class for measuring benchmark metrics
 struct xferBenchStats {
     xferMetricStats total_duration;
     xferMetricStats prepare_duration;
     xferMetricStats post_duration;
     xferMetricStats transfer_duration;
+    // Phases stamped by the backend, see nixl_xfer_telem_t
+    xferMetricStats wire_duration;
+    xferMetricStats notif_duration;
+    // Load-versus-latency curve, one point per load level
+    std::vector<xferBenchLoadPoint> load_curve;
 
     void
     clear();
@@ -369,6 +427,8 @@ public:
     printStatsHeader();
     static void
     printStats(bool is_target, size_t block_size, size_t batch_size, xferBenchStats stats);
+    static void
+    printLoadCurve(const std::vector<xferBenchLoadPoint> &load_curve);
 };
 
 #endif // __UTILS_H
@@ -35,6 +35,7 @@
 #include <sys/stat.h>
 #include <utils/serdes/serdes.h>
 #include <omp.h>
+#include <random>
 
 #define ROUND_UP(value, granularity) \
     ((((value) + (granularity) - 1) / (granularity)) * (granularity))
@@ -112,6 +113,7 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
     nixlAgentConfig dev_meta;
     dev_meta.useProgThread = enable_pt;
     dev_meta.syncMode = sync_mode;
+    dev_meta.captureTelemetry = xferBenchConfig::completion_stats;
 
     agent = new nixlAgent(name, dev_meta);
 
@@ -122,6 +124,7 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_GPUNETIO) ||
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_MOONCAKE) ||
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCCL) ||
+        0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_TCP) ||
         xferBenchConfig::isStorageBackend()) {
         backend_name = xferBenchConfig::backend;
     } else {
@@ -149,7 +152,18 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
             exit(EXIT_FAILURE);
         }
 
-        backend_params["num_workers"] = std::to_string(xferBenchConfig::num_threads + 1);
+        if (xferBenchConfig::ucx_num_workers > 0) {
+            backend_params["num_workers"] = std::to_string(xferBenchConfig::ucx_num_workers);
+        } else {
+            backend_params["num_workers"] = std::to_string(xferBenchConfig::num_threads + 1);
+        }
+
+        if (xferBenchConfig::ucx_stripe_threshold > 0) {
+            backend_params["stripe_threshold"] =
+                std::to_string(xferBenchConfig::ucx_stripe_threshold);
+            backend_params["stripe_chunk_size"] =
+                std::to_string(xferBenchConfig::ucx_stripe_chunk_size);
+        }
 
         std::cout << "Init nixl worker, dev "
                   << (("all" == devices[0]) ? "all" : backend_params["device_list"]) << " rank "
@@ -297,6 +311,9 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
     } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCCL)) {
         std::cout << "UCCL backend" << std::endl;
         backend_params["in_python"] = "0";
+    } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_TCP)) {
+        // Using default param values for TCP backend
+        std::cout << "TCP backend" << std::endl;
     } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_AZURE_BLOB)) {
         // Using default param values for AZURE_BLOB backend
         backend_params["account_url"] = xferBenchConfig::azure_blob_account_url;
@@ -1198,6 +1215,16 @@ xferBenchNixlWorker::exchangeIOV(const std::vector<std::vector<xferBenchIOV>> &l
     return res;
 }
 
+// Helper to add the phases stamped by the backend of a completed transfer
+static inline void
+addCompletionStats(nixlAgent *agent, nixlXferReqH *req, xferBenchStats &thread_stats) {
+    nixl_xfer_telem_t telemetry;
+    if (agent->getXferTelemetry(req, telemetry) == NIXL_SUCCESS) {
+        thread_stats.wire_duration.add(telemetry.wireDuration.count());
+        thread_stats.notif_duration.add(telemetry.notifDuration.count());
+    }
+}
+
 // Helper to execute a single transfer iteration
 static inline nixl_status_t
 execSingleTransfer(nixlAgent *agent,
@@ -1209,6 +1236,10 @@ execSingleTransfer(nixlAgent *agent,
     while (NIXL_IN_PROG == rc) {
         rc = agent->getXferStatus(req);
     }
+
+    if (xferBenchConfig::completion_stats && NIXL_SUCCESS == rc) {
+        addCompletionStats(agent, req, thread_stats);
+    }
     return rc;
 }
 
@@ -1314,6 +1345,216 @@ execTransferIterations(nixlAgent *agent,
     return 0;
 }
 
+// Helper to release the requests kept outstanding
+static int
+releaseXferReqs(nixlAgent *agent, std::vector<nixlXferReqH *> &reqs) {
+    int ret = 0;
+    for (auto *req : reqs) {
+        if (req && agent->releaseXferReq(req) != NIXL_SUCCESS) {
+            std::cout << "NIXL releaseXferReq failed" << std::endl;
+            ret = -1;
+        }
+    }
+    reqs.clear();
+    return ret;
+}
+
+// Helper to prepare the requests kept outstanding, over the same descriptors
+static int
+createXferReqs(nixlAgent *agent,
+               const nixl_xfer_op_t op,
+               nixl_xfer_dlist_t &local_desc,
+               nixl_xfer_dlist_t &remote_desc,
+               const std::string &target,
+               nixl_opt_args_t &params,
+               std::vector<nixlXferReqH *> &reqs) {
+    for (auto &req : reqs) {
+        nixl_status_t create_rc =
+            agent->createXferReq(op, local_desc, remote_desc, target, req, &params);
+        if (NIXL_SUCCESS != create_rc) {
+            std::cerr << "createXferReq failed: " << nixlEnumStrings::statusStr(create_rc)
+                      << std::endl;
+            releaseXferReqs(agent, reqs);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Execute transfers keeping queue_depth requests outstanding. The requests are prepared once
+// over the same descriptors and each one is reposted as soon as it completes, transfer duration
+// is the latency of every request from its post to its completion.
+static int
+execPipelinedIterations(nixlAgent *agent,
+                        const nixl_xfer_op_t op,
+                        nixl_xfer_dlist_t &local_desc,
+                        nixl_xfer_dlist_t &remote_desc,
+                        const std::string &target,
+                        nixl_opt_args_t &params,
+                        const int num_iter,
+                        xferBenchTimer &timer,
+                        xferBenchStats &thread_stats) {
+    const int depth = std::min(xferBenchConfig::queue_depth, num_iter);
+    std::vector<nixlXferReqH *> reqs(depth, nullptr);
+    std::vector<nixlTime::us_t> post_start(depth);
+    std::vector<bool> in_flight(depth, false);
+    int posted = 0;
+    int completed = 0;
+
+    auto post = [&](int slot) {
+        post_start[slot] = nixlTime::getUs();
+        const nixl_status_t rc = agent->postXferReq(reqs[slot]);
+        thread_stats.post_duration.add(nixlTime::getUs() - post_start[slot]);
+        in_flight[slot] = true;
+        ++posted;
+        return rc;
+    };
+
+    if (createXferReqs(agent, op, local_desc, remote_desc, target, params, reqs) != 0) {
+        return -1;
+    }
+    thread_stats.prepare_duration.add(timer.lap() / depth);
+
+    for (int slot = 0; slot < depth; ++slot) {
+        const nixl_status_t rc = post(slot);
+        if (__builtin_expect(rc < 0, 0)) {
+            std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                      << std::endl;
+            releaseXferReqs(agent, reqs);
+            return -1;
+        }
+    }
+
+    while (completed < num_iter) {
+        for (int slot = 0; slot < depth; ++slot) {
+            if (!in_flight[slot]) {
+                continue;
+            }
+
+            nixl_status_t rc = agent->getXferStatus(reqs[slot]);
+            if (NIXL_IN_PROG == rc) {
+                continue;
+            }
+
+            if (__builtin_expect(rc != NIXL_SUCCESS, 0)) {
+                std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                releaseXferReqs(agent, reqs);
+                return -1;
+            }
+
+            thread_stats.transfer_duration.add(nixlTime::getUs() - post_start[slot]);
+            if (xferBenchConfig::completion_stats) {
+                addCompletionStats(agent, reqs[slot], thread_stats);
+            }
+            in_flight[slot] = false;
+            ++completed;
+
+            if (posted < num_iter) {
+                rc = post(slot);
+                if (__builtin_expect(rc < 0, 0)) {
+                    std::cout << "NIXL Xfer failed with status: "
+                              << nixlEnumStrings::statusStr(rc) << std::endl;
+                    releaseXferReqs(agent, reqs);
+                    return -1;
+                }
+            }
+        }
+    }
+
+    return releaseXferReqs(agent, reqs);
+}
+
+// Execute open-loop transfers arriving at rate transfers per second, with constant or Poisson
+// inter-arrival times, on up to queue_depth outstanding requests. A transfer arriving while all
+// the requests are outstanding waits for one of them, so its latency is measured from its
+// arrival rather than from its post, not to omit the waiting time under overload.
+static int
+execOpenLoopIterations(nixlAgent *agent,
+                       const nixl_xfer_op_t op,
+                       nixl_xfer_dlist_t &local_desc,
+                       nixl_xfer_dlist_t &remote_desc,
+                       const std::string &target,
+                       nixl_opt_args_t &params,
+                       const int num_iter,
+                       const double rate,
+                       const int tid,
+                       xferBenchLoadPoint &point) {
+    const int depth = std::min(xferBenchConfig::queue_depth, num_iter);
+    std::vector<nixlXferReqH *> reqs(depth, nullptr);
+    std::vector<nixlTime::ns_t> arrival(depth);
+    std::vector<bool> in_flight(depth, false);
+    int posted = 0;
+    int completed = 0;
+
+    std::mt19937_64 rng(tid + 1);
+    std::exponential_distribution<double> poisson_gap(rate / 1e9);
+    const bool poisson = XFERBENCH_ARRIVAL_POISSON == xferBenchConfig::arrival_pattern;
+    auto next_gap = [&]() { return poisson ? poisson_gap(rng) : 1e9 / rate; };
+
+    if (createXferReqs(agent, op, local_desc, remote_desc, target, params, reqs) != 0) {
+        return -1;
+    }
+
+    const nixlTime::ns_t start = nixlTime::getNs();
+    double next_arrival = 0; // Since start, in nanoseconds
+    while (completed < num_iter) {
+        for (int slot = 0; slot < depth; ++slot) {
+            if (!in_flight[slot]) {
+                continue;
+            }
+
+            const nixl_status_t rc = agent->getXferStatus(reqs[slot]);
+            if (NIXL_IN_PROG == rc) {
+                continue;
+            }
+
+            if (__builtin_expect(rc != NIXL_SUCCESS, 0)) {
+                std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                releaseXferReqs(agent, reqs);
+                return -1;
+            }
+
+            point.latency.record(nixlTime::getNs() - arrival[slot]);
+            in_flight[slot] = false;
+            ++completed;
+        }
+
+        // Post the transfers which arrived, as long as requests are available
+        for (int slot = 0; slot < depth && posted < num_iter; ++slot) {
+            if (in_flight[slot]) {
+                continue;
+            }
+
+            const nixlTime::ns_t slot_arrival = start + static_cast<nixlTime::ns_t>(next_arrival);
+            if (nixlTime::getNs() < slot_arrival) {
+                break;
+            }
+
+            const nixl_status_t rc = agent->postXferReq(reqs[slot]);
+            if (__builtin_expect(rc < 0, 0)) {
+                std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                releaseXferReqs(agent, reqs);
+                return -1;
+            }
+
+            arrival[slot] = slot_arrival;
+            in_flight[slot] = true;
+            next_arrival += next_gap();
+            ++posted;
+        }
+    }
+
+    const double elapsed_sec = (nixlTime::getNs() - start) / 1e9;
+    point.offered_rate = rate;
+    point.achieved_rate = num_iter / elapsed_sec;
+    return releaseXferReqs(agent, reqs);
+}
+
+// Execute num_iter transfers per thread, closed-loop or, when open_loop_rate is set, open-loop
+// at that rate per thread
 static int
 execTransfer(nixlAgent *agent,
              const std::vector<std::vector<xferBenchIOV>> &local_iovs,
@@ -1321,7 +1562,8 @@ execTransfer(nixlAgent *agent,
              const nixl_xfer_op_t op,
              const int num_iter,
              const int num_threads,
-             xferBenchStats &stats) {
+             xferBenchStats &stats,
+             const double open_loop_rate = 0) {
     int ret = 0;
     stats.clear();
 
@@ -1347,17 +1589,42 @@ execTransfer(nixlAgent *agent,
             params.notif = "0xBEEF";
         }
 
+        if (open_loop_rate > 0) {
+            thread_stats.load_curve.resize(1);
+        }
+
         // Execute transfers
-        const int result = execTransferIterations(agent,
-                                                  op,
-                                                  local_desc,
-                                                  remote_desc,
-                                                  target,
-                                                  params,
-                                                  num_iter,
-                                                  timer,
-                                                  thread_stats,
-                                                  xferBenchConfig::recreate_xfer);
+        const int result = open_loop_rate > 0 ?
+            execOpenLoopIterations(agent,
+                                   op,
+                                   local_desc,
+                                   remote_desc,
+                                   target,
+                                   params,
+                                   num_iter,
+                                   open_loop_rate,
+                                   tid,
+                                   thread_stats.load_curve[0]) :
+            xferBenchConfig::queue_depth > 1 ?
+            execPipelinedIterations(agent,
+                                    op,
+                                    local_desc,
+                                    remote_desc,
+                                    target,
+                                    params,
+                                    num_iter,
+                                    timer,
+                                    thread_stats) :
+            execTransferIterations(agent,
+                                   op,
+                                   local_desc,
+                                   remote_desc,
+                                   target,
+                                   params,
+                                   num_iter,
+                                   timer,
+                                   thread_stats,
+                                   xferBenchConfig::recreate_xfer);
 
         if (__builtin_expect(result != 0, 0)) {
             ret = result;
@@ -1408,6 +1675,26 @@ xferBenchNixlWorker::transfer(size_t block_size,
         return std::variant<xferBenchStats, int>(ret);
     }
 
+    // Offer open-loop transfers at percentages of the closed-loop peak rate of every thread
+    const double peak_rate = num_iter / (std::max(stats.total_duration.avg(), 1.0) / 1e6);
+    for (const double load_pct : xferBenchConfig::load_level_pcts) {
+        xferBenchStats load_stats;
+        ret = execTransfer(agent,
+                           local_iovs,
+                           remote_iovs,
+                           xfer_op,
+                           num_iter,
+                           xferBenchConfig::num_threads,
+                           load_stats,
+                           peak_rate * load_pct / 100);
+        if (ret < 0) {
+            return std::variant<xferBenchStats, int>(ret);
+        }
+
+        load_stats.load_curve[0].load_pct = load_pct;
+        stats.load_curve.push_back(load_stats.load_curve[0]);
+    }
+
     synchronize();
     return std::variant<xferBenchStats, int>(stats);
 }
@@ -1425,7 +1712,8 @@ xferBenchNixlWorker::poll(size_t block_size) {
         skip /= xferBenchConfig::large_blk_iter_ftr;
         num_iter /= xferBenchConfig::large_blk_iter_ftr;
     }
-    total_iter = skip + num_iter;
+    // The initiator also runs num_iter open-loop transfers at every load level
+    total_iter = skip + num_iter * (1 + xferBenchConfig::load_level_pcts.size());
 
     /* Ensure warmup is done*/
     do {
@@ -17,8 +17,10 @@
 
 #include "worker.h"
 #include "runtime/etcd/etcd_rt.h"
+#include "runtime/local/local_rt.h"
 #include "utils/utils.h"
 
+#include <algorithm>
 #include <unistd.h>
 
 // Null runtime for storage backends that don't need ETCD
@@ -62,19 +64,49 @@ public:
         return 0;
     }
 
+    virtual int
+    reduceSumDoubles(double *local_values,
+                     double *global_values,
+                     size_t count,
+                     int dest_rank) override {
+        std::copy(local_values, local_values + count, global_values);
+        return 0;
+    }
+
     virtual int
     barrier(const std::string &barrier_id) override {
         return 0;
     }
 };
 
+static bool
+useNullRT() {
+    return xferBenchConfig::isStorageBackend() &&
+        (xferBenchConfig::etcd_endpoints.empty() ||
+         XFERBENCH_RT_LOCAL == xferBenchConfig::runtime_type);
+}
+
 static xferBenchRT *createRT(int *terminate) {
-    // For storage backends without ETCD endpoints, use null runtime
-    if (xferBenchConfig::isStorageBackend() && xferBenchConfig::etcd_endpoints.empty()) {
+    // For storage backends without ETCD endpoints or with the local runtime, use null runtime
+    if (useNullRT()) {
         std::cout << "Using null runtime for storage backend without ETCD" << std::endl;
         return new xferBenchNullRT();
     }
 
+    if (XFERBENCH_RT_LOCAL == xferBenchConfig::runtime_type) {
+        int total = 2;
+        if (XFERBENCH_MODE_SG == xferBenchConfig::mode) {
+            total = xferBenchConfig::num_initiator_dev + xferBenchConfig::num_target_dev;
+        }
+        xferBenchLocalRT *local_rt = new xferBenchLocalRT(total, terminate);
+        if (local_rt->setup() != 0) {
+            std::cerr << "Failed to setup local runtime" << std::endl;
+            delete local_rt;
+            exit(EXIT_FAILURE);
+        }
+        return local_rt;
+    }
+
 #if HAVE_ETCD
     if (XFERBENCH_RT_ETCD == xferBenchConfig::runtime_type) {
         int total = 2;
@@ -127,8 +159,8 @@ xferBenchWorker::xferBenchWorker() {
 
     int rank = rt->getRank();
 
-    // For storage backends without ETCD, always act as initiator
-    if (xferBenchConfig::isStorageBackend() && xferBenchConfig::etcd_endpoints.empty()) {
+    // Storage backends with the null runtime always act as initiator
+    if (useNullRT()) {
         name = "initiator";
     } else if (XFERBENCH_MODE_SG == xferBenchConfig::mode) {
         if (rank >= 0 && rank < xferBenchConfig::num_initiator_dev) {
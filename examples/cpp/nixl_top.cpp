@@ -0,0 +1,527 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Live view of the telemetry of running agents, read from the files of the shared memory buffer
+// exporter. Files are only observed: the events are not consumed, so other readers still get
+// them, and the agents are not slowed down.
+//
+// Usage: nixl_top [options] <telemetry_file_or_dir>...
+
+#include <getopt.h>
+#include <signal.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/cyclic_buffer.h"
+#include "telemetry_event.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+volatile sig_atomic_t g_running = true;
+
+void
+signal_handler(int signal) {
+    if (signal == SIGINT || signal == SIGTERM) {
+        g_running = false;
+    }
+}
+
+constexpr size_t num_categories = 8;
+constexpr size_t peek_batch = 1024;
+constexpr std::chrono::milliseconds poll_interval(20);
+constexpr char trace_file_ext[] = ".nixltrace";
+
+struct options {
+    std::vector<std::string> paths;
+    std::chrono::milliseconds interval{1000};
+    std::chrono::seconds window{10};
+    uint64_t iterations = 0;
+    bool json = false;
+};
+
+enum class sample_kind_t { TX_BYTES, RX_BYTES, TX_REQUESTS, RX_REQUESTS, XFER_TIME, OTHER };
+
+struct sample {
+    uint64_t timestampUs;
+    nixl_telemetry_category_t category;
+    sample_kind_t kind;
+    uint64_t value;
+};
+
+[[nodiscard]] sample_kind_t
+sampleKind(const nixlTelemetryEvent &event) {
+    static const std::map<std::string, sample_kind_t> kinds = {
+        {"agent_tx_bytes", sample_kind_t::TX_BYTES},
+        {"agent_rx_bytes", sample_kind_t::RX_BYTES},
+        {"agent_tx_requests_num", sample_kind_t::TX_REQUESTS},
+        {"agent_rx_requests_num", sample_kind_t::RX_REQUESTS},
+        {"agent_xfer_time", sample_kind_t::XFER_TIME},
+    };
+    const auto it = kinds.find(event.eventName_);
+    return it == kinds.end() ? sample_kind_t::OTHER : it->second;
+}
+
+// Rolling statistics of an agent over the window
+struct agentStats {
+    double windowSec = 0;
+    double txBytesPerSec = 0;
+    double rxBytesPerSec = 0;
+    double iops = 0;
+    double errorsPerSec = 0;
+    double errorRate = 0;
+    size_t xferSamples = 0;
+    uint64_t xferP50Us = 0;
+    uint64_t xferP99Us = 0;
+    uint64_t xferMaxUs = 0;
+    std::array<double, num_categories> eventsPerSec{};
+};
+
+class agentView {
+public:
+    agentView(const fs::path &path, uint64_t now_us)
+        : path_(path),
+          buffer_(std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(
+              path.string(), false, TELEMETRY_VERSION, 0, true)),
+          cursor_(buffer_->head()),
+          attachedUs_(now_us),
+          events_(peek_batch) {}
+
+    [[nodiscard]] std::string
+    name() const {
+        return path_.filename().string();
+    }
+
+    [[nodiscard]] const fs::path &
+    path() const {
+        return path_;
+    }
+
+    [[nodiscard]] uint64_t
+    skipped() const {
+        return skipped_;
+    }
+
+    [[nodiscard]] const std::map<std::string, std::map<std::string, uint64_t>> &
+    summaries() const {
+        return summaries_;
+    }
+
+    void
+    poll() {
+        size_t count;
+        do {
+            count = buffer_->peek(cursor_, events_.data(), events_.size(), skipped_);
+            for (size_t i = 0; i < count; ++i) {
+                add(events_[i]);
+            }
+        } while (count == events_.size());
+    }
+
+    [[nodiscard]] agentStats
+    stats(uint64_t now_us, uint64_t window_us) {
+        while (!samples_.empty() && samples_.front().timestampUs + window_us < now_us) {
+            samples_.pop_front();
+        }
+
+        // Do not average over the part of the window before the first observed event
+        const uint64_t since_us = std::min(attachedUs_, firstUs_);
+        agentStats stats;
+        const uint64_t observed_us = now_us > since_us ? now_us - since_us : 1;
+        stats.windowSec = static_cast<double>(std::min(window_us, observed_us)) / 1e6;
+
+        uint64_t tx_bytes = 0, rx_bytes = 0, requests = 0, errors = 0;
+        std::array<uint64_t, num_categories> events{};
+        std::vector<uint64_t> xfer_times;
+        for (const auto &sample : samples_) {
+            const auto category = static_cast<size_t>(sample.category);
+            if (category < num_categories) {
+                ++events[category];
+            }
+
+            switch (sample.kind) {
+            case sample_kind_t::TX_BYTES:
+                tx_bytes += sample.value;
+                break;
+            case sample_kind_t::RX_BYTES:
+                rx_bytes += sample.value;
+                break;
+            case sample_kind_t::TX_REQUESTS:
+            case sample_kind_t::RX_REQUESTS:
+                requests += sample.value;
+                break;
+            case sample_kind_t::XFER_TIME:
+                xfer_times.push_back(sample.value);
+                break;
+            case sample_kind_t::OTHER:
+                if (sample.category == nixl_telemetry_category_t::NIXL_TELEMETRY_ERROR) {
+                    ++errors;
+                }
+                break;
+            }
+        }
+
+        stats.txBytesPerSec = tx_bytes / stats.windowSec;
+        stats.rxBytesPerSec = rx_bytes / stats.windowSec;
+        stats.iops = requests / stats.windowSec;
+        stats.errorsPerSec = errors / stats.windowSec;
+        stats.errorRate = requests + errors ? static_cast<double>(errors) / (requests + errors) : 0;
+        for (size_t i = 0; i < num_categories; ++i) {
+            stats.eventsPerSec[i] = events[i] / stats.windowSec;
+        }
+
+        stats.xferSamples = xfer_times.size();
+        if (!xfer_times.empty()) {
+            std::sort(xfer_times.begin(), xfer_times.end());
+            const auto percentile = [&xfer_times](double p) {
+                return xfer_times[static_cast<size_t>(p * (xfer_times.size() - 1))];
+            };
+            stats.xferP50Us = percentile(0.5);
+            stats.xferP99Us = percentile(0.99);
+            stats.xferMaxUs = xfer_times.back();
+        }
+
+        return stats;
+    }
+
+private:
+    void
+    add(const nixlTelemetryEvent &event) {
+        firstUs_ = std::min(firstUs_, event.timestampUs_);
+
+        // Histogram summary records are named <backend>/<op>/<size>/<stat>, keep the latest
+        const std::string name(event.eventName_);
+        const auto stat_pos = name.rfind('/');
+        if (event.category_ == nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE &&
+            stat_pos != std::string::npos) {
+            summaries_[name.substr(0, stat_pos)][name.substr(stat_pos + 1)] = event.value_;
+        }
+
+        samples_.push_back({event.timestampUs_, event.category_, sampleKind(event), event.value_});
+    }
+
+    const fs::path path_;
+    std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
+    size_t cursor_;
+    uint64_t skipped_ = 0;
+    const uint64_t attachedUs_;
+    uint64_t firstUs_ = UINT64_MAX;
+    std::vector<nixlTelemetryEvent> events_;
+    std::deque<sample> samples_;
+    std::map<std::string, std::map<std::string, uint64_t>> summaries_;
+};
+
+[[nodiscard]] uint64_t
+nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+[[nodiscard]] std::string
+categoryName(size_t category) {
+    // Drop the NIXL_TELEMETRY_ prefix
+    const auto name =
+        nixlEnumStrings::telemetryCategoryStr(static_cast<nixl_telemetry_category_t>(category));
+    const auto pos = name.rfind('_');
+    return pos == std::string::npos ? name : name.substr(pos + 1);
+}
+
+[[nodiscard]] std::string
+formatBytes(double bytes) {
+    const char *units[] = {"B", "KB", "MB", "GB", "TB"};
+    int unit_index = 0;
+    while (bytes >= 1024.0 && unit_index < 4) {
+        bytes /= 1024.0;
+        unit_index++;
+    }
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(1) << bytes << " " << units[unit_index];
+    return ss.str();
+}
+
+[[nodiscard]] std::string
+formatRate(double value) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(value < 100 ? 1 : 0) << value;
+    return ss.str();
+}
+
+[[nodiscard]] std::string
+jsonString(const std::string &str) {
+    std::stringstream ss;
+    ss << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            ss << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+               << std::dec << std::setfill(' ');
+        } else {
+            ss << c;
+        }
+    }
+    ss << '"';
+    return ss.str();
+}
+
+void
+printJson(const agentView &agent, const agentStats &stats, uint64_t now_us) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << "{\"timestamp_us\":" << now_us
+       << ",\"agent\":" << jsonString(agent.name()) << ",\"window_s\":" << stats.windowSec
+       << ",\"tx_bytes_per_s\":" << stats.txBytesPerSec
+       << ",\"rx_bytes_per_s\":" << stats.rxBytesPerSec << ",\"iops\":" << stats.iops
+       << ",\"errors_per_s\":" << stats.errorsPerSec << ",\"error_rate\":" << stats.errorRate
+       << ",\"xfer_time_us\":{\"n\":" << stats.xferSamples << ",\"p50\":" << stats.xferP50Us
+       << ",\"p99\":" << stats.xferP99Us << ",\"max\":" << stats.xferMaxUs << "}"
+       << ",\"events_per_s\":{";
+    for (size_t i = 0; i < num_categories; ++i) {
+        ss << (i ? "," : "") << jsonString(categoryName(i)) << ":" << stats.eventsPerSec[i];
+    }
+
+    ss << "},\"histograms\":{";
+    bool first = true;
+    for (const auto &[key, values] : agent.summaries()) {
+        ss << (first ? "" : ",") << jsonString(key) << ":{";
+        first = false;
+        bool first_value = true;
+        for (const auto &[stat, value] : values) {
+            ss << (first_value ? "" : ",") << jsonString(stat) << ":" << value;
+            first_value = false;
+        }
+        ss << "}";
+    }
+
+    ss << "},\"skipped\":" << agent.skipped() << "}";
+    std::cout << ss.str() << std::endl;
+}
+
+void
+printView(const std::vector<std::pair<const agentView *, agentStats>> &view,
+          const options &opts) {
+    std::stringstream ss;
+    // Clear the screen and move the cursor to its top
+    ss << "\033[H\033[2J";
+    ss << "nixl_top - " << view.size() << " agent(s) - window " << opts.window.count()
+       << "s - refresh " << opts.interval.count() << "ms - Ctrl+C to quit\n\n";
+    ss << std::left << std::setw(24) << "AGENT" << std::right << std::setw(12) << "TX/s"
+       << std::setw(12) << "RX/s" << std::setw(10) << "IOPS" << std::setw(9) << "ERR/s"
+       << std::setw(8) << "ERR%" << std::setw(10) << "P50(us)" << std::setw(10) << "P99(us)"
+       << std::setw(10) << "MAX(us)" << std::setw(10) << "SKIPPED" << "\n";
+
+    for (const auto &[agent, stats] : view) {
+        ss << std::left << std::setw(24) << agent->name().substr(0, 23) << std::right
+           << std::setw(12) << formatBytes(stats.txBytesPerSec) << std::setw(12)
+           << formatBytes(stats.rxBytesPerSec) << std::setw(10) << formatRate(stats.iops)
+           << std::setw(9) << formatRate(stats.errorsPerSec) << std::setw(8)
+           << formatRate(stats.errorRate * 100) << std::setw(10) << stats.xferP50Us
+           << std::setw(10) << stats.xferP99Us << std::setw(10) << stats.xferMaxUs
+           << std::setw(10) << agent->skipped() << "\n";
+
+        ss << "  events/s:";
+        for (size_t i = 0; i < num_categories; ++i) {
+            if (stats.eventsPerSec[i] > 0) {
+                ss << " " << categoryName(i) << " " << formatRate(stats.eventsPerSec[i]);
+            }
+        }
+        ss << "\n";
+
+        for (const auto &[key, values] : agent->summaries()) {
+            ss << "  " << std::left << std::setw(22) << key << std::right;
+            for (const auto &[stat, value] : values) {
+                ss << " " << stat << "=" << value;
+            }
+            ss << "\n";
+        }
+    }
+
+    std::cout << ss.str() << std::flush;
+}
+
+// Attach to the telemetry files which are not observed yet, paths can be files or directories
+void
+attach(const options &opts,
+       std::map<fs::path, std::unique_ptr<agentView>> &agents,
+       std::set<fs::path> &failed) {
+    std::vector<std::pair<fs::path, bool>> candidates;
+    for (const auto &path : opts.paths) {
+        std::error_code ec;
+        if (fs::is_directory(path, ec)) {
+            for (const auto &entry : fs::directory_iterator(path, ec)) {
+                if (entry.is_regular_file(ec) && entry.path().extension() != trace_file_ext) {
+                    candidates.emplace_back(entry.path(), false);
+                }
+            }
+        } else {
+            candidates.emplace_back(path, true);
+        }
+    }
+
+    for (const auto &[path, explicit_path] : candidates) {
+        if (agents.count(path) || failed.count(path) || !fs::exists(path)) {
+            continue;
+        }
+
+        try {
+            agents.emplace(path, std::make_unique<agentView>(path, nowUs()));
+        }
+        catch (const std::exception &e) {
+            // Do not retry files which are not telemetry buffers
+            failed.insert(path);
+            if (explicit_path) {
+                std::cerr << "Cannot observe " << path << ": " << e.what() << std::endl;
+            }
+        }
+    }
+}
+
+void
+usage(const char *prog) {
+    std::cout << "Usage: " << prog << " [options] <telemetry_file_or_dir>..." << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  <telemetry_file_or_dir>  Telemetry file of an agent, or NIXL_TELEMETRY_DIR to"
+              << " observe all of its agents" << std::endl;
+    std::cout << "  -i, --interval <ms>      Refresh interval (default: 1000)" << std::endl;
+    std::cout << "  -w, --window <s>         Rolling window of the statistics (default: 10)"
+              << std::endl;
+    std::cout << "  -n, --iterations <n>     Exit after n refreshes (default: 0, run until Ctrl+C)"
+              << std::endl;
+    std::cout << "  -j, --json               Print a JSON line per agent per refresh" << std::endl;
+}
+
+[[nodiscard]] bool
+parseArgs(int argc, char *argv[], options &opts) {
+    const struct option long_options[] = {
+        {"interval", required_argument, nullptr, 'i'},
+        {"window", required_argument, nullptr, 'w'},
+        {"iterations", required_argument, nullptr, 'n'},
+        {"json", no_argument, nullptr, 'j'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    int opt;
+    try {
+        while ((opt = getopt_long(argc, argv, "i:w:n:jh", long_options, nullptr)) != -1) {
+            switch (opt) {
+            case 'i':
+                opts.interval = std::chrono::milliseconds(std::stoul(optarg));
+                break;
+            case 'w':
+                opts.window = std::chrono::seconds(std::stoul(optarg));
+                break;
+            case 'n':
+                opts.iterations = std::stoull(optarg);
+                break;
+            case 'j':
+                opts.json = true;
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Invalid value for option -" << static_cast<char>(opt) << ": " << optarg
+                  << std::endl;
+        return false;
+    }
+
+    for (int i = optind; i < argc; ++i) {
+        opts.paths.emplace_back(argv[i]);
+    }
+
+    return !opts.paths.empty() && opts.interval.count() > 0 && opts.window.count() > 0;
+}
+} // namespace
+
+int
+main(int argc, char *argv[]) {
+    options opts;
+    if (!parseArgs(argc, argv, opts)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
+
+    std::map<fs::path, std::unique_ptr<agentView>> agents;
+    std::set<fs::path> failed;
+    const uint64_t window_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(opts.window).count();
+
+    for (uint64_t iteration = 0; g_running; ++iteration) {
+        attach(opts, agents, failed);
+
+        const uint64_t now_us = nowUs();
+        std::vector<std::pair<const agentView *, agentStats>> view;
+        for (auto it = agents.begin(); it != agents.end();) {
+            // The agent is gone, its file was removed
+            if (!fs::exists(it->first)) {
+                it = agents.erase(it);
+                continue;
+            }
+
+            it->second->poll();
+            view.emplace_back(it->second.get(), it->second->stats(now_us, window_us));
+            ++it;
+        }
+
+        if (opts.json) {
+            for (const auto &[agent, stats] : view) {
+                printJson(*agent, stats, now_us);
+            }
+        } else {
+            printView(view, opts);
+        }
+
+        if (opts.iterations && iteration + 1 >= opts.iterations) {
+            break;
+        }
+
+        // Poll in short steps until the next refresh, to quit promptly and to observe the events
+        // before another reader consumes them
+        const auto wake = std::chrono::steady_clock::now() + opts.interval;
+        while (g_running && std::chrono::steady_clock::now() < wake) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                wake - std::chrono::steady_clock::now(), poll_interval));
+            for (auto &[path, agent] : agents) {
+                agent->poll();
+            }
+        }
+    }
+
+    return 0;
+}
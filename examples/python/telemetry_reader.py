@@ -34,7 +34,7 @@ logging.basicConfig(
 logger = logging.getLogger(__name__)
 
 # Constants from telemetry_event.h
-TELEMETRY_VERSION = 1
+TELEMETRY_VERSION = 2
 MAX_EVENT_NAME_LEN = 32
 
 # NIXL telemetry categories
@@ -90,7 +90,7 @@ class BufferHeader(ctypes.Structure):
 class SharedRingBuffer:
     """Python wrapper for the C++ SharedRingBuffer class"""
 
-    def __init__(self, file_path, version=1):
+    def __init__(self, file_path, version=TELEMETRY_VERSION):
         self.file_path = file_path
         self.version = version
         self.file_fd = -1
@@ -157,9 +157,9 @@ class SharedRingBuffer:
 
     def size(self):
         """Get the number of events in the buffer"""
-        write_pos = self.header.write_pos
         read_pos = self.header.read_pos
-        return (write_pos - read_pos) & self.header.mask
+        write_pos = self.header.write_pos
+        return min(write_pos - read_pos, self.header.mask)
 
     def get_capacity(self):
         """Get the buffer capacity"""
@@ -171,23 +171,25 @@ class SharedRingBuffer:
 
     def full(self):
         """Check if buffer is full"""
-        write_pos = self.header.write_pos
-        next_write = (write_pos + 1) & self.header.mask
-        return next_write == self.header.read_pos
+        return self.size() == self.header.mask
 
     def pop(self):
         """Pop an event from the buffer"""
-        read_pos = self.header.read_pos
-
-        if read_pos == self.header.write_pos:
-            return None
+        # Positions only grow, the agent drops the oldest event when the buffer is full
+        while True:
+            read_pos = self.header.read_pos
 
-        event = self.data[read_pos]
+            if read_pos == self.header.write_pos:
+                return None
 
-        next_read = (read_pos + 1) & self.header.mask
-        self.header.read_pos = next_read
+            event = NixlTelemetryEvent.from_buffer_copy(
+                self.data[read_pos & self.header.mask]
+            )
 
-        return event
+            # Retry if the agent dropped the event while it was copied
+            if self.header.read_pos == read_pos:
+                self.header.read_pos = read_pos + 1
+                return event
 
     def __del__(self):
         """Cleanup resources"""
@@ -17,7 +17,12 @@
 #ifndef __BACKEND_AUX_H_
 #define __BACKEND_AUX_H_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include "nixl_types.h"
 #include "nixl_descriptors.h"
@@ -55,11 +60,60 @@ class nixlBackendInitParams {
         bool enableTelemetry_;
 };
 
+// Latest of the times stamped into it, may be stamped concurrently by several threads
+class nixlCompletionStamp {
+public:
+    nixlCompletionStamp() = default;
+
+    // Copies the stamped time, so that handles remain copyable
+    nixlCompletionStamp(const nixlCompletionStamp &other) noexcept
+        : ticks_(other.ticks_.load(std::memory_order_relaxed)) {}
+
+    nixlCompletionStamp &
+    operator=(const nixlCompletionStamp &other) noexcept {
+        ticks_.store(other.ticks_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    void
+    mark(chrono_point_t time = std::chrono::steady_clock::now()) noexcept {
+        const auto ticks = time.time_since_epoch().count();
+        auto current = ticks_.load(std::memory_order_relaxed);
+        while ((current < ticks) &&
+               !ticks_.compare_exchange_weak(current, ticks, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] std::optional<chrono_point_t>
+    get() const noexcept {
+        const auto ticks = ticks_.load(std::memory_order_relaxed);
+        if (ticks == 0) {
+            return std::nullopt;
+        }
+        return chrono_point_t(chrono_point_t::duration(ticks));
+    }
+
+    void
+    reset() noexcept {
+        ticks_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<chrono_point_t::rep> ticks_{0};
+};
+
 // Pure virtual class to have a common pointer type
 class nixlBackendReqH {
 public:
     nixlBackendReqH() { }
     virtual ~nixlBackendReqH() { }
+
+    // Completion times stamped by the backend where it observes the completion, such as
+    // in a completion callback. They are reset by the agent before every post when
+    // telemetry is enabled. Phases which are not stamped are timed when the agent
+    // observes the completion through checkXfer.
+    nixlCompletionStamp xferDone; // All the data of the transfer was transferred
+    nixlCompletionStamp notifDone; // The notification of the transfer was delivered
 };
 
 // Pure virtual class to have a common pointer type for different backendMD.
@@ -134,4 +188,131 @@ operator==(const nixlRemoteMetaDesc &lhs, const nixlRemoteMetaDesc &rhs) {
 typedef nixlDescList<nixlMetaDesc> nixl_meta_dlist_t;
 using nixl_remote_meta_dlist_t = nixlDescList<nixlRemoteMetaDesc>;
 
+// Non-owning view of a flat array of descriptors, passed to the backends which support
+// descriptor spans on the transfer path. Unlike nixl_meta_dlist_t, it has no virtual methods
+// and views either a descriptor list or the inline descriptors of a transfer request.
+class nixlMetaSpan {
+public:
+    nixlMetaSpan(nixl_mem_t type, const nixlMetaDesc *descs, size_t count) noexcept
+        : type_(type),
+          descs_(descs),
+          count_(count) {}
+
+    // Implicit, so that backends can run their span path on descriptor lists as well
+    nixlMetaSpan(const nixl_meta_dlist_t &dlist) noexcept
+        : type_(dlist.getType()),
+          descs_(dlist.isEmpty() ? nullptr : &dlist[0]),
+          count_(dlist.descCount()) {}
+
+    nixl_mem_t
+    getType() const noexcept {
+        return type_;
+    }
+
+    int
+    descCount() const noexcept {
+        return static_cast<int>(count_);
+    }
+
+    bool
+    isEmpty() const noexcept {
+        return count_ == 0;
+    }
+
+    const nixlMetaDesc &
+    operator[](size_t index) const noexcept {
+        return descs_[index];
+    }
+
+    const nixlMetaDesc *
+    begin() const noexcept {
+        return descs_;
+    }
+
+    const nixlMetaDesc *
+    end() const noexcept {
+        return descs_ + count_;
+    }
+
+private:
+    nixl_mem_t type_;
+    const nixlMetaDesc *descs_;
+    size_t count_;
+};
+
+using nixl_meta_span_t = nixlMetaSpan;
+
+// Descriptors of a transfer request, inline up to kInlineDescs and on the heap beyond,
+// so that small requests need no allocation for their descriptors.
+class nixlMetaDescBuf {
+public:
+    static constexpr size_t kInlineDescs = 8;
+
+    explicit nixlMetaDescBuf(nixl_mem_t type, size_t count = 0) : type_(type) {
+        resize(count);
+    }
+
+    nixlMetaDescBuf(const nixlMetaDescBuf &) = delete;
+    nixlMetaDescBuf &
+    operator=(const nixlMetaDescBuf &) = delete;
+
+    nixl_mem_t
+    getType() const noexcept {
+        return type_;
+    }
+
+    int
+    descCount() const noexcept {
+        return static_cast<int>(count_);
+    }
+
+    bool
+    isEmpty() const noexcept {
+        return count_ == 0;
+    }
+
+    nixlMetaDesc &
+    operator[](size_t index) noexcept {
+        return descs_[index];
+    }
+
+    const nixlMetaDesc &
+    operator[](size_t index) const noexcept {
+        return descs_[index];
+    }
+
+    // Keeps the current descriptors, new ones are default constructed
+    void
+    resize(size_t count) {
+        if (count > capacity_) {
+            const size_t capacity = std::max(count, 2 * capacity_);
+            auto heap = std::make_unique<nixlMetaDesc[]>(capacity);
+            std::copy(descs_, descs_ + count_, heap.get());
+            heap_ = std::move(heap);
+            descs_ = heap_.get();
+            capacity_ = capacity;
+        }
+        std::fill(descs_ + std::min(count, count_), descs_ + count, nixlMetaDesc());
+        count_ = count;
+    }
+
+    void
+    clear() noexcept {
+        count_ = 0;
+    }
+
+    nixl_meta_span_t
+    span() const noexcept {
+        return nixl_meta_span_t(type_, descs_, count_);
+    }
+
+private:
+    nixl_mem_t type_;
+    size_t count_ = 0;
+    size_t capacity_ = kInlineDescs;
+    std::array<nixlMetaDesc, kInlineDescs> inline_;
+    std::unique_ptr<nixlMetaDesc[]> heap_;
+    nixlMetaDesc *descs_ = inline_.data();
+};
+
 #endif
@@ -19,13 +19,15 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <mutex>
 
 #include "nixl_types.h"
 #include "backend_aux.h"
 #include "telemetry_event.h"
+#include "telemetry_ring.h"
 
 constexpr size_t MAX_TELEMETRY_QUEUE_SIZE = 1000;
 
@@ -35,8 +37,13 @@ class nixlBackendEngine {
         // Members that cannot be modified by a child backend and parent bookkeep
         nixl_backend_t  backendType;
         nixl_b_params_t customParams;
-        std::vector<nixlTelemetryEvent> telemetryEvents_;
-        std::mutex telemetryEventsMutex_;
+        // Recording is thread safe, so that const data path methods can record events
+        mutable nixlTelemetryRings<> telemetryRings_{MAX_TELEMETRY_QUEUE_SIZE};
+        // Names are looked up under a shared lock and only added under an exclusive one
+        std::vector<std::string> telemetryNames_;
+        std::unordered_map<std::string, uint32_t> telemetryIds_;
+        std::shared_mutex telemetryNamesMutex_;
+        std::mutex telemetryDrainMutex_;
 
     protected:
         // Members that can be accessed by the child (localAgent cannot be modified)
@@ -61,17 +68,39 @@ class nixlBackendEngine {
             return NIXL_ERR_INVALID_PARAM;
         }
 
+        // Interns an event name, best registered once outside of the data path
+        [[nodiscard]] uint32_t
+        registerTelemetryEvent(const std::string &event_name) {
+            {
+                std::shared_lock<std::shared_mutex> lock(telemetryNamesMutex_);
+                const auto it = telemetryIds_.find(event_name);
+                if (it != telemetryIds_.end()) {
+                    return it->second;
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(telemetryNamesMutex_);
+            const auto [it, inserted] =
+                telemetryIds_.try_emplace(event_name, telemetryNames_.size());
+            if (inserted) {
+                telemetryNames_.push_back(event_name);
+            }
+            return it->second;
+        }
+
+        // Lock-free, records to a ring of the calling thread (dropped when full)
+        void
+        addTelemetryEvent(uint32_t event_id, uint64_t value) const {
+            if (!enableTelemetry_) return;
+            telemetryRings_.record(event_id, value);
+        }
+
+        // Looks the name up under a shared lock on every event, data path events are
+        // registered once when the backend is created and recorded by id
         void
         addTelemetryEvent(const std::string &event_name, uint64_t value) {
             if (!enableTelemetry_) return;
-            if (telemetryEvents_.size() >= MAX_TELEMETRY_QUEUE_SIZE) return;
-            std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
-            telemetryEvents_.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(
-                                              std::chrono::system_clock::now().time_since_epoch())
-                                              .count(),
-                                          nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
-                                          event_name,
-                                          value);
+            addTelemetryEvent(registerTelemetryEvent(event_name), value);
         }
 
     public:
@@ -91,8 +120,17 @@ class nixlBackendEngine {
 
         std::vector<nixlTelemetryEvent>
         getTelemetryEvents() {
-            std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
-            return std::move(telemetryEvents_);
+            std::vector<nixlTelemetryEvent> events;
+            const nixlTelemetryTimeBase time_base;
+            std::lock_guard<std::mutex> drain_lock(telemetryDrainMutex_);
+            std::shared_lock<std::shared_mutex> names_lock(telemetryNamesMutex_);
+            telemetryRings_.drain([&](const nixlTelemetryRecord &record) {
+                events.emplace_back(time_base.toSystemUs(record.timestampNs_),
+                                    nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
+                                    telemetryNames_[record.id_],
+                                    record.value_);
+            });
+            return events;
         }
 
         bool getInitErr() const noexcept { return initErr; }
@@ -236,6 +274,36 @@ class nixlBackendEngine {
             return NIXL_ERR_NOT_SUPPORTED;
         }
 
+        // Determines if a backend takes the descriptors of its transfer requests as spans,
+        // through prepXferSpans and postXferSpans instead of prepXfer and postXfer. The
+        // agent then keeps them inline in the request, without descriptor lists.
+        virtual bool
+        supportsXferSpans() const {
+            return false;
+        }
+
+        // Same as prepXfer, the spans are valid until the handle is released
+        virtual nixl_status_t
+        prepXferSpans(const nixl_xfer_op_t &operation,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote,
+                      const std::string &remote_agent,
+                      nixlBackendReqH *&handle,
+                      const nixl_opt_b_args_t *opt_args = nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Same as postXfer, on the spans given to prepXferSpans
+        virtual nixl_status_t
+        postXferSpans(const nixl_xfer_op_t &operation,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote,
+                      const std::string &remote_agent,
+                      nixlBackendReqH *&handle,
+                      const nixl_opt_b_args_t *opt_args = nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
         // Estimate the cost (duration) of a transfer operation.
         virtual nixl_status_t
         estimateXferCost(const nixl_xfer_op_t &operation,
@@ -249,5 +317,19 @@ class nixlBackendEngine {
                          const nixl_opt_args_t *extra_params = nullptr) const {
             return NIXL_ERR_NOT_SUPPORTED;
         }
+
+        // Same as estimateXferCost, on the spans given to prepXferSpans
+        virtual nixl_status_t
+        estimateXferCostSpans(const nixl_xfer_op_t &operation,
+                              const nixl_meta_span_t &local,
+                              const nixl_meta_span_t &remote,
+                              const std::string &remote_agent,
+                              nixlBackendReqH *const &handle,
+                              std::chrono::microseconds &duration,
+                              std::chrono::microseconds &err_margin,
+                              nixl_cost_t &method,
+                              const nixl_opt_args_t *extra_params = nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
 };
 #endif
@@ -255,6 +255,36 @@ class nixlAgent {
                        nixlXferReqH* &req_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Create a pipelined transfer request, which moves the data of `src_descs` to
+         *         `dst_descs` through the stages of bounce buffers of `cfg`. The data is cut into
+         *         chunks, and every chunk is moved by one transfer per hop: a read from the
+         *         source into the first stage, writes from stage to stage within this agent,
+         *         and a write from the last stage to the destination. Chunks flow independently,
+         *         so that the hop of a chunk overlaps the previous hop of the next one.
+         *         E.g., a file is sent to a peer with POSIX reads into DRAM bounce buffers
+         *         and UCX writes from them. The request is posted, checked and released as any
+         *         other; its progress is driven by getXferStatus. An optional notification
+         *         (via extra_params) is sent to `dst_agent` once all chunks are completed.
+         *
+         * @param  src_descs      Source descriptor list, on `src_agent`
+         * @param  src_agent      Agent holding the source, the local agent name for local data
+         * @param  dst_descs      Destination descriptor list, with the lengths of `src_descs`
+         * @param  dst_agent      Agent holding the destination, the local agent name for local data
+         * @param  cfg            Bounce stages, per-hop backends and chunk size of the pipeline
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters, only the notification is used
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createPipelineXferReq(const nixl_xfer_dlist_t &src_descs,
+                              const std::string &src_agent,
+                              const nixl_xfer_dlist_t &dst_descs,
+                              const std::string &dst_agent,
+                              const nixlPipelineConfig &cfg,
+                              nixlXferReqH *&req_hndl,
+                              const nixl_opt_args_t *extra_params = nullptr) const;
+
         /*** Operations on prepared Transfer Request ***/
 
         /**
@@ -535,6 +565,21 @@ class nixlAgent {
         fetchRemoteMD (const std::string remote_name,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Fetch the metadata of all the agents from the central metadata server with a
+         *         single request, then unpack it internally. The agents which send their metadata
+         *         later are also fetched, until this agent is destroyed. Fetches are asynchronous,
+         *         checkRemoteMD tells when the metadata of an agent is available.
+         *
+         * @param  extra_params  If metadataLabel is specified, it will be used as the label of the
+         *                       metadata to be fetched. Otherwise, the default label of the full
+         *                       metadata will be used for fetching.
+         *
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        fetchAllRemoteMD(const nixl_opt_args_t *extra_params = nullptr);
+
         /**
          * @brief  Invalidate your own memory in one/all remote agent(s).
          *
@@ -19,7 +19,9 @@
 
 #include <string>
 #include <cstdint>
+#include <vector>
 #include "nixl_types.h"
+#include "nixl_descriptors.h"
 
 /**
  * @struct nixlAgentConfig
@@ -37,6 +39,7 @@ struct nixlAgentConfig {
     static constexpr uint64_t kDefaultLthrDelayUs = 100000;
     static constexpr std::chrono::microseconds kDefaultEtcdWatchTimeout =
         std::chrono::microseconds(5000000);
+    static constexpr unsigned int kDefaultGossipFanout = 0;
 
     /** @var Enable progress thread */
     bool useProgThread = kDefaultUseProgThread;
@@ -68,6 +71,15 @@ struct nixlAgentConfig {
      */
     std::chrono::microseconds etcdWatchTimeout = kDefaultEtcdWatchTimeout;
 
+    /**
+     * @var Metadata gossip fan-out, 0 disables gossip
+     *      With the listener thread, metadata sent to a peer by sendLocalMD is relayed by the
+     *      listener threads of the agents to this many random peers, so that every agent of
+     *      the service receives it in O(log N) rounds. Around log2 of the number of agents
+     *      is advised. All the agents of the service must enable gossip.
+     */
+    unsigned int gossipFanout = kDefaultGossipFanout;
+
     /**
      * @brief  Default constructor.
      */
@@ -105,4 +117,32 @@ struct nixlAgentConfig {
           etcdWatchTimeout(etcd_watch_timeout) {}
 };
 
+/**
+ * @struct nixlPipelineConfig
+ * @brief Configuration of a pipelined transfer, which moves data from a source to a destination
+ *        through one or more stages of local bounce buffers, one hop per stage boundary.
+ *        Chunks of the transfer flow through the stages independently, so that a hop of a
+ *        chunk overlaps the previous hop of the next chunk.
+ */
+struct nixlPipelineConfig {
+    static constexpr size_t kDefaultChunkSize = 1024 * 1024;
+
+    /**
+     * @var Bounce buffers of every intermediate stage, ordered from the source to the
+     *      destination. Each descriptor is one buffer of at least chunkSize bytes in memory
+     *      registered with this agent, the number of buffers of a stage is the number of chunks
+     *      it can hold at once (2 for double buffering).
+     */
+    std::vector<nixl_xfer_dlist_t> bounceStages;
+
+    /**
+     * @var Backend of every hop, bounceStages.size() + 1 entries when not empty. A null entry
+     *      lets NIXL select the backend of the hop, as for createXferReq.
+     */
+    std::vector<nixlBackendH *> hopBackends;
+
+    /** @var Largest amount of data moved by one hop of a chunk */
+    size_t chunkSize = kDefaultChunkSize;
+};
+
 #endif
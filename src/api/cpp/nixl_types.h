@@ -270,11 +270,24 @@ struct nixlXferTelemetry {
     chrono_period_us_t postDuration;
 
     /**
-     * @var xferDuration Time it took to complete the transfer
-     *      if checkXferReq is called late, that might impact this result
+     * @var xferDuration Time it took to complete the transfer, including its notification.
+     *      Backends which stamp their completions exclude the delay until the status is
+     *      checked, otherwise calling checkXferReq late might impact this result
      */
     chrono_period_us_t xferDuration;
 
+    /**
+     * @var wireDuration Time from the end of the post operation to the completion of the
+     *      data transfer
+     */
+    chrono_period_us_t wireDuration;
+
+    /**
+     * @var notifDuration Time from the completion of the data transfer to the completion
+     *      of its notification, zero for transfers without notification
+     */
+    chrono_period_us_t notifDuration;
+
     /**
      * @var totalBytes Amount of bytes transferred in the request
      */
@@ -19,8 +19,11 @@
 
 #include "nixl_types.h"
 #include "telemetry_event.h"
+#include "telemetry_histogram.h"
+#include "telemetry_span.h"
 
 #include <string>
+#include <vector>
 
 inline constexpr char telemetryExporterVar[] = "NIXL_TELEMETRY_EXPORTER";
 
@@ -63,6 +66,34 @@ public:
     virtual nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) = 0;
 
+    /**
+     * @brief Export the transfer latency histograms, called once per telemetry interval
+     *        with the histograms which got samples since the previous call.
+     *        Exporters which do not support histograms can ignore them.
+     */
+    virtual nixl_status_t
+    exportHistograms(const std::vector<nixlTelemetryHistogram> & /* histograms */) {
+        return NIXL_SUCCESS;
+    }
+
+    /**
+     * @brief Whether the exporter exports trace spans. The agent only records the spans
+     *        of transfer requests for exporters which do.
+     */
+    [[nodiscard]] virtual bool
+    exportsSpans() const noexcept {
+        return false;
+    }
+
+    /**
+     * @brief Export the trace spans recorded since the previous call, called once per
+     *        telemetry interval. Span start times are in system clock nanoseconds.
+     */
+    virtual nixl_status_t
+    exportSpans(const std::vector<nixlTelemetrySpan> & /* spans */) {
+        return NIXL_SUCCESS;
+    }
+
 private:
     const size_t maxEventsBuffered_;
 };
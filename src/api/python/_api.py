@@ -129,6 +129,8 @@ nixl_backend_handle = int
 @param backends List of backend names for agent to initialize.
         Default is UCX, other backends can be added to the list, or after
         agent creation, can be initialized with create_backend.
+@param gossip_fanout Number of peers the listener thread relays received metadata to, 0 disables
+        gossip. Requires the listener thread.
 """
 
 
@@ -141,6 +143,7 @@ class nixl_agent_config:
         capture_telemetry: bool = False,
         num_threads: int = 0,
         backends: list[str] = ["UCX"],
+        gossip_fanout: int = 0,
     ):
         # TODO: add backend init parameters
         self.backends = backends
@@ -149,6 +152,7 @@ class nixl_agent_config:
         self.port = listen_port
         self.capture_telemetry = capture_telemetry
         self.num_threads = num_threads
+        self.gossip_fanout = gossip_fanout
 
 
 """
@@ -192,6 +196,7 @@ class nixl_agent:
         agent_config.pthrDelay = 0
         agent_config.lthrDelay = 100000
         agent_config.captureTelemetry = nixl_conf.capture_telemetry
+        agent_config.gossipFanout = nixl_conf.gossip_fanout
         self.agent = nixlBind.nixlAgent(agent_name, agent_config)
 
         self.name = agent_name
@@ -626,8 +631,9 @@ class nixl_agent:
 
     """
     @brief Get telemetry information of a transfer request.
-           The output object has three time values fields in microseconds
-           (startTime, postDuration, xferDuration), as well as integer totalBytes transferred
+           The output object has five time values fields in microseconds
+           (startTime, postDuration, xferDuration, wireDuration, notifDuration),
+           as well as integer totalBytes transferred
            for the request, and integer descCount representing number of descriptors involved
            (for example if there was some merging of descriptors).
 
@@ -873,6 +879,16 @@ class nixl_agent:
     ):
         self.agent.fetchRemoteMD(remote_agent, ip_addr, port, label)
 
+    """
+    @brief Request the metadata of all the agents from the central metadata server, including
+           the agents which send their metadata later.
+
+    @param label If specified, the label of the metadata to be fetched.
+    """
+
+    def fetch_all_remote_metadata(self, label: str = ""):
+        self.agent.fetchAllRemoteMD(label)
+
     """
     @brief Invalidate your own metadata in the central metadata server, or from a specific peer.
 
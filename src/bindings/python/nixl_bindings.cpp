@@ -198,6 +198,10 @@ PYBIND11_MODULE(_bindings, m) {
                                [](const nixl_xfer_telem_t &t) { return t.postDuration.count(); })
         .def_property_readonly("xferDuration",
                                [](const nixl_xfer_telem_t &t) { return t.xferDuration.count(); })
+        .def_property_readonly("wireDuration",
+                               [](const nixl_xfer_telem_t &t) { return t.wireDuration.count(); })
+        .def_property_readonly("notifDuration",
+                               [](const nixl_xfer_telem_t &t) { return t.notifDuration.count(); })
         .def_readonly("totalBytes", &nixl_xfer_telem_t::totalBytes)
         .def_readonly("descCount", &nixl_xfer_telem_t::descCount);
 
@@ -431,7 +435,8 @@ PYBIND11_MODULE(_bindings, m) {
         .def_readwrite("captureTelemetry", &nixlAgentConfig::captureTelemetry)
         .def_readwrite("pthrDelay", &nixlAgentConfig::pthrDelay)
         .def_readwrite("lthrDelay", &nixlAgentConfig::lthrDelay)
-        .def_readwrite("etcdWatchTimeout", &nixlAgentConfig::etcdWatchTimeout);
+        .def_readwrite("etcdWatchTimeout", &nixlAgentConfig::etcdWatchTimeout)
+        .def_readwrite("gossipFanout", &nixlAgentConfig::gossipFanout);
 
     // note: pybind will automatically convert notif_map to python types:
     // so, a Dictionary of string: List<string>
@@ -680,6 +685,44 @@ PYBIND11_MODULE(_bindings, m) {
             py::arg("notif_msg") = std::string(""),
             py::arg("backend") = std::vector<uintptr_t>({}),
             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "createPipelineXferReq",
+            [](nixlAgent &agent,
+               const nixl_xfer_dlist_t &src_descs,
+               const std::string &src_agent,
+               const nixl_xfer_dlist_t &dst_descs,
+               const std::string &dst_agent,
+               const std::vector<nixl_xfer_dlist_t> &bounce_stages,
+               const std::vector<uintptr_t> &hop_backends,
+               size_t chunk_size,
+               const std::string &notif_msg) -> uintptr_t {
+                nixlXferReqH *handle = nullptr;
+                nixl_opt_args_t extra_params;
+                nixlPipelineConfig cfg;
+
+                cfg.bounceStages = bounce_stages;
+                for (uintptr_t backend : hop_backends)
+                    cfg.hopBackends.push_back((nixlBackendH *)backend);
+                cfg.chunkSize = chunk_size;
+
+                if (notif_msg.size() > 0) {
+                    extra_params.notif = notif_msg;
+                }
+                nixl_status_t ret = agent.createPipelineXferReq(
+                    src_descs, src_agent, dst_descs, dst_agent, cfg, handle, &extra_params);
+
+                throw_nixl_exception(ret);
+                return (uintptr_t)handle;
+            },
+            py::arg("src_descs"),
+            py::arg("src_agent"),
+            py::arg("dst_descs"),
+            py::arg("dst_agent"),
+            py::arg("bounce_stages"),
+            py::arg("hop_backends") = std::vector<uintptr_t>({}),
+            py::arg("chunk_size") = nixlPipelineConfig::kDefaultChunkSize,
+            py::arg("notif_msg") = std::string(""),
+            py::call_guard<py::gil_scoped_release>())
         .def(
             "estimateXferCost",
             [](nixlAgent &agent, uintptr_t reqh) -> std::tuple<int64_t, int64_t, int> {
@@ -892,6 +935,17 @@ PYBIND11_MODULE(_bindings, m) {
             py::arg("port") = 0,
             py::arg("label") = std::string(""),
             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "fetchAllRemoteMD",
+            [](nixlAgent &agent, std::string label) {
+                nixl_opt_args_t extra_params;
+
+                extra_params.metadataLabel = label;
+
+                throw_nixl_exception(agent.fetchAllRemoteMD(&extra_params));
+            },
+            py::arg("label") = std::string(""),
+            py::call_guard<py::gil_scoped_release>())
         .def(
             "invalidateLocalMD",
             [](nixlAgent &agent, std::string ip_addr, int port) {
@@ -21,14 +21,16 @@
 #include "telemetry.h"
 #include "stream/metadata_stream.h"
 #include "sync.h"
+#include "serdes/serdes.h"
+#include "metadata_cache.h"
 
 #include <memory>
 
 #if HAVE_ETCD
-#include <etcd/SyncClient.hpp>
+#include <etcd/Client.hpp>
 
 namespace etcd {
-class SyncClient;
+class Client;
 }
 
 #define NIXL_ETCD_NAMESPACE_DEFAULT "/nixl/agents/"
@@ -46,6 +48,7 @@ enum nixl_comm_t {
 #if HAVE_ETCD
     ETCD_SEND,
     ETCD_FETCH,
+    ETCD_FETCH_ALL,
     ETCD_INVAL
 #endif // HAVE_ETCD
 };
@@ -68,6 +71,7 @@ class nixlAgentData {
         nixlLock        lock;
         bool telemetryEnabled = false;
         bool efaWarningChecked = false;
+        nixl_serdes_codec_t metadataCodec_ = nixl_serdes_codec_t::NONE;
 
         // some handle that can be used to instantiate an object from the lib
         std::map<std::string, void*> backendLibs;
@@ -100,6 +104,7 @@ class nixlAgentData {
         backend_map_t backendEngines_;
         std::unordered_map<std::string, nixlRemoteSection> remoteSections_;
         std::unique_ptr<nixlTelemetry> telemetry_;
+        std::unique_ptr<nixlMetadataCache> metadataCache_;
         nixlLocalSection localSection_;
 
         void
@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "metadata_cache.h"
+#include "common/nixl_log.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+constexpr char cache_magic[8] = {'N', 'I', 'X', 'L', 'M', 'D', 'C', '1'};
+
+// Header of a cache file, followed by the agent name and the metadata blob
+struct cacheHeader {
+    char magic[sizeof(cache_magic)];
+    uint64_t version;
+    uint64_t nameLen;
+    uint64_t mdLen;
+};
+
+// FNV-1a, which is stable across processes unlike std::hash
+uint64_t
+fnv1a(const char *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Read-only mapping of a cache file
+class cacheFile {
+public:
+    explicit cacheFile(const std::string &path) {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(cacheHeader)) {
+            void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                addr_ = static_cast<const char *>(addr);
+                size_ = st.st_size;
+            }
+        }
+        close(fd);
+    }
+
+    ~cacheFile() {
+        if (addr_) {
+            munmap(const_cast<char *>(addr_), size_);
+        }
+    }
+
+    cacheFile(const cacheFile &) = delete;
+    cacheFile &
+    operator=(const cacheFile &) = delete;
+
+    // Header and agent name of a well-formed file
+    bool
+    parse(cacheHeader &header, std::string &agent) const {
+        if (!addr_) {
+            return false;
+        }
+
+        std::memcpy(&header, addr_, sizeof(header));
+        if (std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+            header.nameLen > size_ - sizeof(header) ||
+            header.mdLen != size_ - sizeof(header) - header.nameLen) {
+            return false;
+        }
+
+        agent.assign(addr_ + sizeof(header), header.nameLen);
+        return true;
+    }
+
+    const char *
+    md(const cacheHeader &header) const {
+        return addr_ + sizeof(header) + header.nameLen;
+    }
+
+private:
+    const char *addr_ = nullptr;
+    size_t size_ = 0;
+};
+} // namespace
+
+nixlMetadataCache::nixlMetadataCache(const std::string &dir) : dir_(dir) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir_, ec);
+    if (ec) {
+        NIXL_WARN << "Failed to create the metadata cache directory " << dir_ << ": "
+                  << ec.message();
+        return;
+    }
+
+    for (const auto &entry : std::filesystem::directory_iterator(dir_, ec)) {
+        if (entry.path().extension() != ".md") {
+            continue;
+        }
+
+        const cacheFile file(entry.path().string());
+        cacheHeader header;
+        std::string agent;
+        if (file.parse(header, agent) && path(agent) == entry.path().string()) {
+            versions_[agent] = header.version;
+        } else {
+            NIXL_WARN << "Ignoring invalid metadata cache file " << entry.path();
+        }
+    }
+
+    NIXL_DEBUG << "Metadata cache " << dir_ << " has " << versions_.size() << " agents";
+}
+
+uint64_t
+nixlMetadataCache::version(const nixl_blob_t &md) noexcept {
+    return fnv1a(md.data(), md.size());
+}
+
+bool
+nixlMetadataCache::getVersion(const std::string &agent, uint64_t &version) const {
+    const std::lock_guard<std::mutex> guard(lock_);
+    const auto it = versions_.find(agent);
+    if (it == versions_.end()) {
+        return false;
+    }
+
+    version = it->second;
+    return true;
+}
+
+nixl_status_t
+nixlMetadataCache::load(const std::string &agent, uint64_t version, nixl_blob_t &md) const {
+    const std::lock_guard<std::mutex> guard(lock_);
+    const cacheFile file(path(agent));
+    cacheHeader header;
+    std::string file_agent;
+    if (!file.parse(header, file_agent) || file_agent != agent || header.version != version) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // Checked against the version, a corrupted blob must not reach the backends
+    if (fnv1a(file.md(header), header.mdLen) != version) {
+        NIXL_WARN << "Corrupted metadata cache file for agent " << agent;
+        return NIXL_ERR_MISMATCH;
+    }
+
+    md.assign(file.md(header), header.mdLen);
+    return NIXL_SUCCESS;
+}
+
+void
+nixlMetadataCache::store(const std::string &agent, const nixl_blob_t &md) {
+    cacheHeader header;
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = version(md);
+    header.nameLen = agent.size();
+    header.mdLen = md.size();
+
+    const std::lock_guard<std::mutex> guard(lock_);
+    const auto it = versions_.find(agent);
+    if (it != versions_.end() && it->second == header.version) {
+        return;
+    }
+
+    // Written aside then renamed, readers never see a partial file
+    const std::string final_path = path(agent);
+    const std::string tmp_path = final_path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(agent.data(), agent.size());
+        out.write(md.data(), md.size());
+        if (!out) {
+            NIXL_WARN << "Failed to write the metadata cache file " << tmp_path;
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmp_path.c_str(), final_path.c_str()) != 0) {
+        NIXL_PERROR << "Failed to rename the metadata cache file " << tmp_path;
+        std::remove(tmp_path.c_str());
+        return;
+    }
+
+    versions_[agent] = header.version;
+}
+
+void
+nixlMetadataCache::remove(const std::string &agent) {
+    const std::lock_guard<std::mutex> guard(lock_);
+    if (versions_.erase(agent) > 0) {
+        std::remove(path(agent).c_str());
+    }
+}
+
+std::string
+nixlMetadataCache::path(const std::string &agent) const {
+    // Agent names are not valid file names, the name in the file resolves hash collisions
+    char name[17];
+    snprintf(name, sizeof(name), "%016" PRIx64, fnv1a(agent.data(), agent.size()));
+    return (std::filesystem::path(dir_) / (std::string(name) + ".md")).string();
+}
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_METADATA_CACHE_H
+#define NIXL_SRC_CORE_METADATA_CACHE_H
+
+#include "nixl_types.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Directory of the cache of remote metadata, the cache is disabled when unset
+constexpr char METADATA_CACHE_DIR_VAR[] = "NIXL_METADATA_CACHE_DIR";
+
+/**
+ * @class nixlMetadataCache
+ * @brief On-disk cache of the latest full metadata blob fetched from each remote agent, keyed
+ *        by the agent name and the version (hash) of the blob. It survives restarts of the
+ *        agent, so that peers whose metadata did not change are loaded from disk after a
+ *        version probe, instead of sending their metadata again. Written by the listener
+ *        thread only.
+ */
+class nixlMetadataCache {
+public:
+    explicit nixlMetadataCache(const std::string &dir);
+
+    [[nodiscard]] static uint64_t
+    version(const nixl_blob_t &md) noexcept;
+
+    [[nodiscard]] bool
+    getVersion(const std::string &agent, uint64_t &version) const;
+
+    nixl_status_t
+    load(const std::string &agent, uint64_t version, nixl_blob_t &md) const;
+
+    void
+    store(const std::string &agent, const nixl_blob_t &md);
+
+    void
+    remove(const std::string &agent);
+
+private:
+    [[nodiscard]] std::string
+    path(const std::string &agent) const;
+
+    const std::string dir_;
+    mutable std::mutex lock_;
+    // Versions of the cached blobs, read from the headers of the files at start-up
+    std::unordered_map<std::string, uint64_t> versions_;
+};
+
+#endif
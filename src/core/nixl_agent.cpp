@@ -32,8 +32,10 @@
 #include "common/hw_info.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
+#include "xfer_pipeline.h"
 
 constexpr char TELEMETRY_ENABLED_VAR[] = "NIXL_TELEMETRY_ENABLE";
+constexpr char METADATA_COMPRESSION_VAR[] = "NIXL_METADATA_COMPRESSION";
 static const std::vector<std::vector<std::string>> illegal_plugin_combinations = {
     {"GDS", "GDS_MT"},
 };
@@ -93,36 +95,143 @@ nixlEngineDeleter::operator()(nixlBackendEngine *engine) const noexcept {
 nixlXferReqH::nixlXferReqH(const std::string &remote_agent,
                            const nixl_xfer_op_t backend_op,
                            const nixl_mem_t local_type,
-                           const nixl_mem_t remote_type,
-                           const size_t desc_count)
-    : initiatorDescs(std::make_unique<nixl_meta_dlist_t>(local_type, desc_count)),
-      targetDescs(std::make_unique<nixl_meta_dlist_t>(remote_type, desc_count)),
+                           const nixl_mem_t remote_type)
+    : initiatorBuf(local_type),
+      targetBuf(remote_type),
       remoteAgent(remote_agent),
       backendOp(backend_op) {}
 
+nixlXferReqH::~nixlXferReqH() {
+    if ((backendHandle != nullptr) && (engine != nullptr)) {
+        engine->releaseReqH(backendHandle);
+    }
+}
+
+void
+nixlXferReqH::initDescs(nixlBackendEngine *backend, size_t desc_count) {
+    spans = backend->supportsXferSpans();
+    if (spans) {
+        initiatorBuf.resize(desc_count);
+        targetBuf.resize(desc_count);
+        return;
+    }
+
+    if (!initiatorDescs) {
+        initiatorDescs = std::make_unique<nixl_meta_dlist_t>(initiatorBuf.getType());
+        targetDescs = std::make_unique<nixl_meta_dlist_t>(targetBuf.getType());
+    }
+    initiatorDescs->resize(desc_count);
+    targetDescs->resize(desc_count);
+}
+
+int
+nixlXferReqH::descCount() const {
+    return spans ? initiatorBuf.descCount() : initiatorDescs->descCount();
+}
+
+nixl_status_t
+nixlXferReqH::prepBackendXfer(const nixl_opt_b_args_t *opt_args) {
+    if (spans) {
+        return engine->prepXferSpans(backendOp,
+                                     initiatorBuf.span(),
+                                     targetBuf.span(),
+                                     remoteAgent,
+                                     backendHandle,
+                                     opt_args);
+    }
+    return engine->prepXfer(
+        backendOp, *initiatorDescs, *targetDescs, remoteAgent, backendHandle, opt_args);
+}
+
+nixl_status_t
+nixlXferReqH::postBackendXfer(const nixl_opt_b_args_t *opt_args) {
+    if (spans) {
+        return engine->postXferSpans(backendOp,
+                                     initiatorBuf.span(),
+                                     targetBuf.span(),
+                                     remoteAgent,
+                                     backendHandle,
+                                     opt_args);
+    }
+    return engine->postXfer(
+        backendOp, *initiatorDescs, *targetDescs, remoteAgent, backendHandle, opt_args);
+}
+
+const std::string &
+nixlXferReqH::getBackendName() const {
+    static const std::string pipeline_backend = "PIPELINE";
+    return engine ? engine->getType() : pipeline_backend;
+}
+
 void
 nixlXferReqH::updateRequestStats(nixlTelemetry *telemetry_pub,
                                  nixl_telemetry_stat_status_t stat_status) {
 
     static const std::array<std::string, 3> nixl_post_status_str = {
         " Posted", " Posted and Completed", " Completed"};
-    auto duration = std::chrono::duration_cast<chrono_period_us_t>(
-        std::chrono::steady_clock::now() - telemetry.startTime);
-    if (stat_status == NIXL_TELEMETRY_POST) {
-        telemetry.postDuration = duration;
-    } else if (stat_status == NIXL_TELEMETRY_POST_AND_FINISH) {
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = now - telemetry.startTime;
+    auto duration = std::chrono::duration_cast<chrono_period_us_t>(elapsed);
+    if (stat_status != NIXL_TELEMETRY_FINISH) {
         telemetry.postDuration = duration;
-        telemetry.xferDuration = duration;
-    } else { // stat_status == NIXL_TELEMETRY_FINISH
-        telemetry.xferDuration = duration;
+        postElapsed = elapsed;
+        if (traced && telemetry_pub) {
+            telemetry_pub->addSpan(nixl_telemetry_span_kind_t::POST_XFER_REQ,
+                                   telemetry.startTime,
+                                   now,
+                                   this,
+                                   getBackendName());
+        }
     }
 
-    if (telemetry_pub && (stat_status != NIXL_TELEMETRY_POST)) {
-        telemetry_pub->addPostTime(telemetry.postDuration);
-        telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+    if (stat_status != NIXL_TELEMETRY_POST) {
+        // Prefer the completion times stamped by the backend to the time of this check
+        const auto post_end = telemetry.startTime + postElapsed;
+        auto xfer_done = now;
+        auto notif_done = now;
+        if (backendHandle) {
+            xfer_done = backendHandle->xferDone.get().value_or(now);
+            notif_done = hasNotif ? backendHandle->notifDone.get().value_or(now) : xfer_done;
+        }
+        xfer_done = std::max(xfer_done, post_end);
+        notif_done = std::max(notif_done, xfer_done);
+
+        const auto xfer_elapsed = notif_done - telemetry.startTime;
+        duration = std::chrono::duration_cast<chrono_period_us_t>(xfer_elapsed);
+        telemetry.xferDuration = duration;
+        telemetry.wireDuration =
+            std::chrono::duration_cast<chrono_period_us_t>(xfer_done - post_end);
+        telemetry.notifDuration =
+            std::chrono::duration_cast<chrono_period_us_t>(notif_done - xfer_done);
+
+        if (traced && telemetry_pub) {
+            telemetry_pub->addSpan(nixl_telemetry_span_kind_t::XFER,
+                                   telemetry.startTime,
+                                   xfer_done,
+                                   this,
+                                   getBackendName());
+            if (hasNotif) {
+                telemetry_pub->addSpan(nixl_telemetry_span_kind_t::NOTIF,
+                                       xfer_done,
+                                       notif_done,
+                                       this,
+                                       getBackendName());
+            }
+        }
+
+        if (telemetry_pub) {
+            telemetry_pub->addPostTime(telemetry.postDuration);
+            telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+            if (histograms) {
+                histograms->post.record(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(postElapsed).count());
+                histograms->xfer.record(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(xfer_elapsed).count());
+            }
+        }
     }
 
-    NIXL_TRACE << "[NIXL TELEMETRY]: From backend " << engine->getType()
+    NIXL_TRACE << "[NIXL TELEMETRY]: From backend " << getBackendName()
                << nixl_post_status_str[stat_status] << " Xfer with " << telemetry.descCount
                << " descriptors of total size " << telemetry.totalBytes << "B in "
                << duration.count() << "us.";
@@ -169,6 +278,25 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &con
         telemetryEnabled = true;
         NIXL_DEBUG << "Capturing NIXL telemetry based on config (without an output file)";
     }
+
+    // Metadata is only compressed for the peers which advertise the codec when fetching it,
+    // and stays opt-in
+    const auto codec_name = nixl::config::getValueOptional<std::string>(METADATA_COMPRESSION_VAR);
+    if (codec_name) {
+        if (nixlSerDes::parseCodec(*codec_name, metadataCodec_) != NIXL_SUCCESS) {
+            NIXL_WARN << "Unknown " << METADATA_COMPRESSION_VAR << " codec '" << *codec_name
+                      << "', metadata will not be compressed";
+        } else if (!nixlSerDes::isCodecAvailable(metadataCodec_)) {
+            NIXL_WARN << "NIXL was built without the '" << *codec_name
+                      << "' codec, metadata will not be compressed";
+            metadataCodec_ = nixl_serdes_codec_t::NONE;
+        }
+    }
+
+    const auto cache_dir = nixl::config::getValueOptional<std::string>(METADATA_CACHE_DIR_VAR);
+    if (cache_dir) {
+        metadataCache_ = std::make_unique<nixlMetadataCache>(*cache_dir);
+    }
 }
 
 /*** nixlAgent implementation ***/
@@ -328,7 +456,7 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     init_params.enableProgTh = data->config_.useProgThread;
     init_params.pthrDelay = data->config_.pthrDelay;
     init_params.syncMode = data->config_.syncMode;
-    init_params.enableTelemetry_ = (data->telemetry_ != nullptr);
+    init_params.enableTelemetry_ = data->telemetry_ && data->telemetry_->isExporting();
 
     // First, try to load the backend as a plugin
     auto& plugin_manager = nixlPluginManager::getInstance();
@@ -396,6 +524,11 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     NIXL_ASSERT(inserted);
     bknd_hndl = it->second.get();
 
+    // The engines are destroyed after the telemetry, see nixlAgentData
+    if (init_params.enableTelemetry_) {
+        data->telemetry_->addBackend(backend.get());
+    }
+
     data->backendEngines_.try_emplace(type, std::move(backend));
 
     // TODO: Check if backend supports ProgThread
@@ -654,6 +787,65 @@ nixlAgent::prepXferDlist(const nixl_xfer_dlist_t &descs,
     return prepXferDlist(NIXL_INIT_AGENT, descs, dlist_hndl, extra_params);
 }
 
+namespace {
+// Fills the descriptors of a transfer request from the selected indices of prepped lists,
+// merging the descriptors which are back to back in memory unless skip_merge is set
+template<typename desc_list_t>
+void
+fillXferDescs(const nixl_meta_dlist_t &local_descs,
+              const std::vector<int> &local_indices,
+              const nixl_meta_dlist_t &remote_descs,
+              const std::vector<int> &remote_indices,
+              bool skip_merge,
+              desc_list_t &initiator,
+              desc_list_t &target) {
+    const int desc_count = static_cast<int>(local_indices.size());
+    if (skip_merge) {
+        for (int i=0; i<desc_count; ++i) {
+            initiator[i] = local_descs[local_indices[i]];
+            target[i] = remote_descs[remote_indices[i]];
+        }
+        return;
+    }
+
+    int i = 0, j = 0; //final list size
+    while (i<(desc_count)) {
+        nixlMetaDesc local_desc1 = local_descs[local_indices[i]];
+        nixlMetaDesc remote_desc1 = remote_descs[remote_indices[i]];
+
+        if(i != (desc_count-1) ) {
+            const nixlMetaDesc *local_desc2 = &(local_descs[local_indices[i + 1]]);
+            const nixlMetaDesc *remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
+
+            while (((local_desc1.addr + local_desc1.len) == local_desc2->addr) &&
+                   ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr) &&
+                   (local_desc1.metadataP == local_desc2->metadataP) &&
+                   (remote_desc1.metadataP == remote_desc2->metadataP) &&
+                   (local_desc1.devId == local_desc2->devId) &&
+                   (remote_desc1.devId == remote_desc2->devId)) {
+
+                local_desc1.len += local_desc2->len;
+                remote_desc1.len += remote_desc2->len;
+
+                i++;
+                if(i == (desc_count-1)) break;
+
+                local_desc2 = &(local_descs[local_indices[i + 1]]);
+                remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
+            }
+        }
+
+        initiator[j] = local_desc1;
+        target[j] = remote_desc1;
+        j++;
+        i++;
+    }
+    NIXL_DEBUG << "reqH descList size down to " << j;
+    initiator.resize(j);
+    target.resize(j);
+}
+} // namespace
+
 nixl_status_t
 nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                         const nixlDlistH* local_side,
@@ -667,6 +859,9 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     nixl_status_t      ret;
     int                desc_count = (int) local_indices.size();
     nixlBackendEngine* backend    = nullptr;
+    const bool trace_create = data->telemetry_ && data->telemetry_->sampleSpan();
+    const chrono_point_t create_start =
+        trace_create ? std::chrono::steady_clock::now() : chrono_point_t();
 
     req_hndl = nullptr;
 
@@ -764,53 +959,27 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_BACKEND;
     }
 
-    auto handle = std::make_unique<nixlXferReqH>(remote_side->remoteAgent,
-                                                 operation,
-                                                 local_descs.getType(),
-                                                 remote_descs.getType(),
-                                                 desc_count);
+    auto handle = std::make_unique<nixlXferReqH>(
+        remote_side->remoteAgent, operation, local_descs.getType(), remote_descs.getType());
+    handle->initDescs(backend, desc_count);
 
-    if (extra_params && extra_params->skipDescMerge) {
-        for (int i=0; i<desc_count; ++i) {
-            (*handle->initiatorDescs)[i] = local_descs[local_indices[i]];
-            (*handle->targetDescs)[i] = remote_descs[remote_indices[i]];
-        }
+    const bool skip_merge = extra_params && extra_params->skipDescMerge;
+    if (handle->spans) {
+        fillXferDescs(local_descs,
+                      local_indices,
+                      remote_descs,
+                      remote_indices,
+                      skip_merge,
+                      handle->initiatorBuf,
+                      handle->targetBuf);
     } else {
-        int i = 0, j = 0; //final list size
-        while (i<(desc_count)) {
-            nixlMetaDesc local_desc1 = local_descs[local_indices[i]];
-            nixlMetaDesc remote_desc1 = remote_descs[remote_indices[i]];
-
-            if(i != (desc_count-1) ) {
-                const nixlMetaDesc *local_desc2 = &(local_descs[local_indices[i + 1]]);
-                const nixlMetaDesc *remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
-
-                while (((local_desc1.addr + local_desc1.len) == local_desc2->addr) &&
-                       ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr) &&
-                       (local_desc1.metadataP == local_desc2->metadataP) &&
-                       (remote_desc1.metadataP == remote_desc2->metadataP) &&
-                       (local_desc1.devId == local_desc2->devId) &&
-                       (remote_desc1.devId == remote_desc2->devId)) {
-
-                    local_desc1.len += local_desc2->len;
-                    remote_desc1.len += remote_desc2->len;
-
-                    i++;
-                    if(i == (desc_count-1)) break;
-
-                    local_desc2 = &(local_descs[local_indices[i + 1]]);
-                    remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
-                }
-            }
-
-            (*handle->initiatorDescs)[j] = local_desc1;
-            (*handle->targetDescs)   [j] = remote_desc1;
-            j++;
-            i++;
-        }
-        NIXL_DEBUG << "reqH descList size down to " << j;
-        handle->initiatorDescs->resize(j);
-        handle->targetDescs->resize(j);
+        fillXferDescs(local_descs,
+                      local_indices,
+                      remote_descs,
+                      remote_indices,
+                      skip_merge,
+                      *handle->initiatorDescs,
+                      *handle->targetDescs);
     }
 
     handle->engine = backend;
@@ -819,15 +988,14 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
 
     if (data->telemetryEnabled) {
         handle->telemetry.totalBytes = total_bytes;
-        handle->telemetry.descCount = handle->initiatorDescs->descCount();
+        handle->telemetry.descCount = handle->descCount();
+        if (data->telemetry_) {
+            handle->histograms = data->telemetry_->getXferHistograms(
+                handle->engine->getType(), handle->backendOp, total_bytes, handle->remoteAgent);
+        }
     }
 
-    ret = handle->engine->prepXfer (handle->backendOp,
-                                    *handle->initiatorDescs,
-                                    *handle->targetDescs,
-                                    handle->remoteAgent,
-                                    handle->backendHandle,
-                                    &opt_args);
+    ret = handle->prepBackendXfer(&opt_args);
     if (ret != NIXL_SUCCESS) {
         NIXL_ERROR_FUNC << "backend '" << backend->getType()
                         << "' failed to prepare the transfer request with status " << ret;
@@ -835,6 +1003,16 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return ret;
     }
 
+    // All the spans of a request are traced or none, so that its traces are complete
+    handle->traced = trace_create;
+    if (trace_create) {
+        data->telemetry_->addSpan(nixl_telemetry_span_kind_t::CREATE_XFER_REQ,
+                                  create_start,
+                                  std::chrono::steady_clock::now(),
+                                  handle.get(),
+                                  handle->engine->getType());
+    }
+
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
@@ -849,6 +1027,9 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
     nixl_status_t ret1, ret2;
     nixl_opt_b_args_t opt_args;
     backend_set_t backend_set;
+    const bool trace_create = data->telemetry_ && data->telemetry_->sampleSpan();
+    const chrono_point_t create_start =
+        trace_create ? std::chrono::steady_clock::now() : chrono_point_t();
 
     req_hndl = nullptr;
 
@@ -903,7 +1084,6 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
     // TODO: when central KV is supported, add a call to fetchRemoteMD
     // TODO: merge descriptors back to back in memory (like makeXferReq).
-    // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
 
     std::unique_ptr<nixlXferReqH> handle = std::make_unique<nixlXferReqH>(
         remote_agent, operation, local_descs.getType(), remote_descs.getType());
@@ -912,8 +1092,14 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
     // preference list or more exhaustive search.
     for (auto &backend : backend_set) {
         // If populate fails, it clears the resp before return
-        ret1 = data->localSection_.populate(local_descs, backend, *handle->initiatorDescs);
-        ret2 = rem_sec_it->second.populate(remote_descs, backend, *handle->targetDescs);
+        handle->initDescs(backend, 0);
+        if (handle->spans) {
+            ret1 = data->localSection_.populate(local_descs, backend, handle->initiatorBuf);
+            ret2 = rem_sec_it->second.populate(remote_descs, backend, handle->targetBuf);
+        } else {
+            ret1 = data->localSection_.populate(local_descs, backend, *handle->initiatorDescs);
+            ret2 = rem_sec_it->second.populate(remote_descs, backend, *handle->targetDescs);
+        }
 
         if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
             NIXL_INFO << "Selected backend: " << backend->getType();
@@ -954,15 +1140,14 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
     if (data->telemetryEnabled) {
         handle->telemetry.totalBytes = total_bytes;
-        handle->telemetry.descCount = handle->initiatorDescs->descCount();
+        handle->telemetry.descCount = handle->descCount();
+        if (data->telemetry_) {
+            handle->histograms = data->telemetry_->getXferHistograms(
+                handle->engine->getType(), handle->backendOp, total_bytes, handle->remoteAgent);
+        }
     }
 
-    ret1 = handle->engine->prepXfer (handle->backendOp,
-                                     *handle->initiatorDescs,
-                                     *handle->targetDescs,
-                                     handle->remoteAgent,
-                                     handle->backendHandle,
-                                     &opt_args);
+    ret1 = handle->prepBackendXfer(&opt_args);
     if (ret1 != NIXL_SUCCESS) {
         NIXL_ERROR_FUNC << "backend '" << handle->engine->getType()
                         << "' failed to prepare the transfer request with status " << ret1;
@@ -970,6 +1155,78 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
         return ret1;
     }
 
+    // All the spans of a request are traced or none, so that its traces are complete
+    handle->traced = trace_create;
+    if (trace_create) {
+        data->telemetry_->addSpan(nixl_telemetry_span_kind_t::CREATE_XFER_REQ,
+                                  create_start,
+                                  std::chrono::steady_clock::now(),
+                                  handle.get(),
+                                  handle->engine->getType());
+    }
+
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::createPipelineXferReq(const nixl_xfer_dlist_t &src_descs,
+                                 const std::string &src_agent,
+                                 const nixl_xfer_dlist_t &dst_descs,
+                                 const std::string &dst_agent,
+                                 const nixlPipelineConfig &cfg,
+                                 nixlXferReqH *&req_hndl,
+                                 const nixl_opt_args_t *extra_params) const {
+    const bool trace_create = data->telemetry_ && data->telemetry_->sampleSpan();
+    const chrono_point_t create_start =
+        trace_create ? std::chrono::steady_clock::now() : chrono_point_t();
+
+    req_hndl = nullptr;
+
+    std::unique_ptr<nixlXferPipeline> pipeline;
+    const nixl_status_t ret = nixlXferPipeline::create(
+        *this, data->name_, src_descs, src_agent, dst_descs, dst_agent, cfg, pipeline);
+    if (ret != NIXL_SUCCESS) {
+        data->addErrorTelemetry(ret);
+        return ret;
+    }
+
+    // The hops hold the descriptors and the backends, the request only drives them
+    auto handle = std::make_unique<nixlXferReqH>(
+        dst_agent, NIXL_WRITE, src_descs.getType(), dst_descs.getType());
+    handle->pipeline = std::move(pipeline);
+
+    if (extra_params) {
+        if (extra_params->notif) {
+            handle->notifMsg = *extra_params->notif;
+            handle->hasNotif = true;
+        } else if (extra_params->hasNotif) {
+            handle->notifMsg = extra_params->notifMsg;
+            handle->hasNotif = true;
+        }
+    }
+
+    if (data->telemetryEnabled) {
+        handle->telemetry.totalBytes = handle->pipeline->getTotalBytes();
+        handle->telemetry.descCount = handle->pipeline->getChunkCount();
+        if (data->telemetry_) {
+            handle->histograms =
+                data->telemetry_->getXferHistograms(handle->getBackendName(),
+                                                    handle->backendOp,
+                                                    handle->telemetry.totalBytes,
+                                                    handle->remoteAgent);
+        }
+    }
+
+    handle->traced = trace_create;
+    if (trace_create) {
+        data->telemetry_->addSpan(nixl_telemetry_span_kind_t::CREATE_XFER_REQ,
+                                  create_start,
+                                  std::chrono::steady_clock::now(),
+                                  handle.get(),
+                                  handle->getBackendName());
+    }
+
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
@@ -982,6 +1239,12 @@ nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
                             const nixl_opt_args_t* extra_params) const
 {
     nixl_status_t ret;
+
+    if (req_hndl->pipeline) {
+        NIXL_ERROR_FUNC << "cost estimation is not supported for pipelined requests";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
 
     // Check if the remote agent connection info is still valid
@@ -1000,15 +1263,27 @@ nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
         return NIXL_ERR_UNKNOWN;
     }
 
-    ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
-                                             *req_hndl->initiatorDescs,
-                                             *req_hndl->targetDescs,
-                                             req_hndl->remoteAgent,
-                                             req_hndl->backendHandle,
-                                             duration,
-                                             err_margin,
-                                             method,
-                                             extra_params);
+    if (req_hndl->spans) {
+        ret = req_hndl->engine->estimateXferCostSpans(req_hndl->backendOp,
+                                                      req_hndl->initiatorBuf.span(),
+                                                      req_hndl->targetBuf.span(),
+                                                      req_hndl->remoteAgent,
+                                                      req_hndl->backendHandle,
+                                                      duration,
+                                                      err_margin,
+                                                      method,
+                                                      extra_params);
+    } else {
+        ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
+                                                 *req_hndl->initiatorDescs,
+                                                 *req_hndl->targetDescs,
+                                                 req_hndl->remoteAgent,
+                                                 req_hndl->backendHandle,
+                                                 duration,
+                                                 err_margin,
+                                                 method,
+                                                 extra_params);
+    }
     if (ret != NIXL_SUCCESS) {
         NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
                         << "' failed to estimate the transfer cost with status " << ret;
@@ -1029,8 +1304,61 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    // Pipelines post their hops through this agent, so they run outside of its lock
+    if (req_hndl->pipeline) {
+        if (req_hndl->status == NIXL_IN_PROG) {
+            req_hndl->status = req_hndl->pipeline->progress();
+            if (req_hndl->status == NIXL_IN_PROG) {
+                NIXL_ERROR_FUNC << "transfer request is still in progress and cannot be reposted";
+                return NIXL_ERR_REPOST_ACTIVE;
+            }
+        }
+
+        if (extra_params) {
+            if (extra_params->notif) {
+                req_hndl->notifMsg = *extra_params->notif;
+                req_hndl->hasNotif = true;
+            } else if (extra_params->hasNotif) {
+                req_hndl->notifMsg = extra_params->notifMsg;
+                req_hndl->hasNotif = true;
+            } else {
+                req_hndl->hasNotif = false;
+            }
+        }
+
+        if (data->telemetryEnabled) {
+            req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+        }
+
+        std::optional<nixl_blob_t> notif;
+        if (req_hndl->hasNotif) {
+            notif = req_hndl->notifMsg;
+        }
+        req_hndl->status = req_hndl->pipeline->post(notif);
+        if (req_hndl->status < 0) {
+            NIXL_ERROR_FUNC << "failed to post the pipelined transfer request with status "
+                            << req_hndl->status;
+        }
+
+        if (data->telemetryEnabled) {
+            if (req_hndl->status < 0) {
+                data->addErrorTelemetry(req_hndl->status);
+            } else if (req_hndl->status == NIXL_IN_PROG) {
+                req_hndl->updateRequestStats(data->telemetry_.get(), NIXL_TELEMETRY_POST);
+            } else {
+                req_hndl->updateRequestStats(data->telemetry_.get(),
+                                             NIXL_TELEMETRY_POST_AND_FINISH);
+            }
+        }
+        return req_hndl->status;
+    }
+
     if (data->telemetryEnabled) {
         req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+        if (req_hndl->backendHandle) {
+            req_hndl->backendHandle->xferDone.reset();
+            req_hndl->backendHandle->notifDone.reset();
+        }
     }
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
@@ -1090,13 +1418,19 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         return NIXL_ERR_BACKEND;
     }
 
+    const chrono_point_t backend_start =
+        req_hndl->traced ? std::chrono::steady_clock::now() : chrono_point_t();
+
     // If status is not NIXL_IN_PROG we can repost,
-    req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
-                                                  *req_hndl->initiatorDescs,
-                                                  *req_hndl->targetDescs,
-                                                  req_hndl->remoteAgent,
-                                                  req_hndl->backendHandle,
-                                                  &opt_args);
+    req_hndl->status = req_hndl->postBackendXfer(&opt_args);
+
+    if (req_hndl->traced) {
+        data->telemetry_->addSpan(nixl_telemetry_span_kind_t::BACKEND_POST,
+                                  backend_start,
+                                  std::chrono::steady_clock::now(),
+                                  req_hndl,
+                                  req_hndl->engine->getType());
+    }
 
     if (req_hndl->status < 0) {
         if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
@@ -1112,7 +1446,9 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
     }
 
     if (data->telemetryEnabled) {
-        NIXL_DEBUG << req_hndl->initiatorDescs->to_string(true);
+        if (!req_hndl->spans) {
+            NIXL_DEBUG << req_hndl->initiatorDescs->to_string(true);
+        }
 
         if (req_hndl->status < 0) {
             data->addErrorTelemetry(req_hndl->status);
@@ -1129,6 +1465,25 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
 nixl_status_t
 nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
 
+    if (req_hndl->pipeline) {
+        if (req_hndl->status == NIXL_IN_PROG) {
+            req_hndl->status = req_hndl->pipeline->progress();
+            if (req_hndl->status < 0) {
+                NIXL_ERROR_FUNC << "pipelined transfer request failed with status "
+                                << req_hndl->status;
+            }
+
+            if (data->telemetryEnabled) {
+                if (req_hndl->status == NIXL_SUCCESS) {
+                    req_hndl->updateRequestStats(data->telemetry_.get(), NIXL_TELEMETRY_FINISH);
+                } else if (req_hndl->status < 0) {
+                    data->addErrorTelemetry(req_hndl->status);
+                }
+            }
+        }
+        return req_hndl->status;
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
     // If the status is done, no need to recheck and no state changes.
     // Same for users incorrectly recalling this method in error/done.
@@ -1183,6 +1538,11 @@ nixlAgent::getXferTelemetry(const nixlXferReqH *req_hndl, nixl_xfer_telem_t &tel
 nixl_status_t
 nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
                             nixlBackendH* &backend) const {
+    if (req_hndl->pipeline) {
+        NIXL_ERROR_FUNC << "pipelined requests use a backend per hop";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
     NIXL_LOCK_GUARD(data->lock);
     backend = data->backendHandles_[req_hndl->engine->getType()].get();
     return NIXL_SUCCESS;
@@ -1191,6 +1551,15 @@ nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
 nixl_status_t
 nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
 
+    if (req_hndl->pipeline) {
+        if (req_hndl->pipeline->release() != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "could not release the hops of the pipelined transfer request";
+            return NIXL_ERR_REPOST_ACTIVE;
+        }
+        delete req_hndl;
+        return NIXL_SUCCESS;
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
     //attempt to cancel request
     if(req_hndl->status == NIXL_IN_PROG) {
@@ -1567,6 +1936,10 @@ nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
         ret = NIXL_SUCCESS;
     }
 
+    if (data->metadataCache_) {
+        data->metadataCache_->remove(remote_agent);
+    }
+
     if (ret == NIXL_ERR_NOT_FOUND)
         NIXL_INFO << __FUNCTION__ << ": remote metadata for agent '" << remote_agent
                   << "' not found.";
@@ -1645,7 +2018,9 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
                           const nixl_opt_args_t* extra_params) {
     // If IP is provided, use socket-based communication
     if (extra_params && !extra_params->ipAddr.empty()) {
-        data->enqueueCommWork(std::make_tuple(SOCK_FETCH, extra_params->ipAddr, extra_params->port, ""));
+        // The name selects the cached metadata whose version is probed
+        data->enqueueCommWork(
+            std::make_tuple(SOCK_FETCH, extra_params->ipAddr, extra_params->port, remote_name));
         return NIXL_SUCCESS;
     }
 
@@ -1666,6 +2041,25 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
 #endif // HAVE_ETCD
 }
 
+nixl_status_t
+nixlAgent::fetchAllRemoteMD(const nixl_opt_args_t *extra_params) {
+#if HAVE_ETCD
+    if (data->useEtcd) {
+        std::string metadata_label = extra_params && !extra_params->metadataLabel.empty() ?
+            extra_params->metadataLabel :
+            default_metadata_label;
+        data->enqueueCommWork(
+            std::make_tuple(ETCD_FETCH_ALL, std::move(metadata_label), 0, ""));
+        return NIXL_SUCCESS;
+    }
+    NIXL_ERROR_FUNC << "fetching all the metadata requires ETCD";
+    return NIXL_ERR_INVALID_PARAM;
+#else
+    NIXL_ERROR_FUNC << "ETCD is not supported";
+    return NIXL_ERR_NOT_SUPPORTED;
+#endif // HAVE_ETCD
+}
+
 nixl_status_t
 nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
     // If IP is provided, use socket-based communication
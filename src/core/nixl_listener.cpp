@@ -22,13 +22,21 @@
 #include "agent_data.h"
 #include "common/nixl_log.h"
 #if HAVE_ETCD
-#include <etcd/SyncClient.hpp>
+#include <etcd/Client.hpp>
 #include <etcd/Watcher.hpp>
-#include <future>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <optional>
+#include <set>
+#include <unordered_set>
 #endif // HAVE_ETCD
+#include <absl/strings/numbers.h>
 #include <absl/strings/str_format.h>
 #include <absl/strings/str_split.h>
 #include <poll.h>
+#include <algorithm>
+#include <random>
 
 const std::string default_metadata_label = "metadata";
 
@@ -36,6 +44,28 @@ namespace {
 
 static const std::string invalid_label = "invalid";
 
+// Metadata fetch request, with the version probe of the cached metadata of the peer and the
+// codecs which this agent can import. Older peers ignore what follows the header.
+std::string
+makeFetchMessage(const std::string &probe) {
+    return "NIXLCOMM:SEND" + probe + "|" + std::to_string(nixlSerDes::getCodecMask());
+}
+
+// Metadata reply, compressed only if the peer advertised the codec in its fetch request
+std::string
+makeLoadMessage(const nixl_blob_t &md, nixl_serdes_codec_t codec, uint32_t peer_codecs) {
+    if (codec == nixl_serdes_codec_t::NONE ||
+        !(peer_codecs & (1U << static_cast<uint8_t>(codec)))) {
+        return "NIXLCOMM:LOAD" + md;
+    }
+
+    nixlSerDes sd;
+    if (sd.importStr(md) != NIXL_SUCCESS) {
+        return "NIXLCOMM:LOAD" + md;
+    }
+    return "NIXLCOMM:LOAD" + sd.exportStr(codec);
+}
+
 int connectToIP(std::string ip_addr, int port) {
 
     struct sockaddr_in listenerAddr;
@@ -190,16 +220,470 @@ recvCommMessage(int fd, std::string &msg) {
     return recvCommMessageType(fd, msg.data(), size, true);
 }
 
+// Dissemination of metadata by gossip between the listener threads. Metadata received from a
+// peer is relayed to a bounded fan-out of random peers, and each agent periodically exchanges
+// digests with a random peer to get what the relays missed. Versions of the metadata of each
+// agent drop the stale copies. Messages:
+//   GOSP  entries to merge and relay
+//   GPUL  entries to merge, in reply to a digest
+//   GDIG  digest of a pull, answered with the newer entries and the digest of the receiver
+//   GDIR  digest in reply to a pull, answered with the newer entries
+//   GMEM  addresses of some agents, in reply to a direct send of metadata
+class nixlGossip {
+public:
+    // Message to send to a peer by its listener address
+    struct outMessage {
+        std::string ip;
+        int port;
+        std::string msg;
+    };
+
+private:
+    // Latest metadata known for an agent, version 0 when only its address is known
+    struct gossipEntry {
+        std::string ip;
+        int port = 0;
+        uint64_t version = 0;
+        bool invalidated = false;
+        nixl_blob_t md;
+    };
+
+    // Address of the sender, resolved by the receiver from the socket peer
+    static constexpr char senderAddr_[] = "0.0.0.0";
+    // Maximum number of entries or addresses in a reply
+    static constexpr size_t maxReplyEntries_ = 64;
+    static constexpr std::chrono::milliseconds pullInterval_{500};
+
+    const std::string myName_;
+    const int myPort_;
+    const unsigned fanout_;
+    std::unordered_map<std::string, gossipEntry> entries_;
+    uint64_t myVersion_ = 0;
+    std::chrono::steady_clock::time_point nextPull_;
+    std::mt19937 rng_;
+
+    static void
+    addEntry(nixlSerDes &sd, const std::string &name, const gossipEntry &entry, bool with_md) {
+        const uint8_t invalidated = entry.invalidated;
+        sd.addStr("name", name);
+        sd.addStr("ip", entry.ip);
+        sd.addBuf("port", &entry.port, sizeof(entry.port));
+        sd.addBuf("version", &entry.version, sizeof(entry.version));
+        sd.addBuf("invalidated", &invalidated, sizeof(invalidated));
+        if (with_md && !entry.invalidated) {
+            sd.addStr("md", entry.md);
+        }
+    }
+
+    static nixl_status_t
+    getEntry(nixlSerDes &sd, std::string &name, gossipEntry &entry, bool with_md) {
+        uint8_t invalidated;
+        name = sd.getStr("name");
+        entry.ip = sd.getStr("ip");
+        if (name.empty() || entry.ip.empty() ||
+            sd.getBuf("port", &entry.port, sizeof(entry.port)) != NIXL_SUCCESS ||
+            sd.getBuf("version", &entry.version, sizeof(entry.version)) != NIXL_SUCCESS ||
+            sd.getBuf("invalidated", &invalidated, sizeof(invalidated)) != NIXL_SUCCESS) {
+            return NIXL_ERR_MISMATCH;
+        }
+
+        entry.invalidated = invalidated;
+        if (with_md && !entry.invalidated) {
+            entry.md = sd.getStr("md");
+            if (entry.md.empty()) {
+                return NIXL_ERR_MISMATCH;
+            }
+        }
+        return NIXL_SUCCESS;
+    }
+
+    std::string
+    makeMessage(const std::string &header, const std::vector<std::string> &names) const {
+        const bool with_md = (header == "GOSP" || header == "GPUL");
+        const size_t count = names.size();
+        nixlSerDes sd;
+        sd.addStr("sender", myName_);
+        sd.addBuf("count", &count, sizeof(count));
+        for (const auto &name : names) {
+            addEntry(sd, name, entries_.at(name), with_md);
+        }
+        return "NIXLCOMM:" + header + sd.exportStr();
+    }
+
+    std::string
+    makeDigest(const std::string &header) const {
+        std::vector<std::string> names;
+        for (const auto &entry : entries_) {
+            names.push_back(entry.first);
+        }
+        return makeMessage(header, names);
+    }
+
+    // Names of up to count random peers, other than the excluded one
+    std::vector<std::string>
+    pickPeers(size_t count, const std::string &excluded) {
+        std::vector<std::string> peers;
+        for (const auto &[name, entry] : entries_) {
+            if (name != myName_ && name != excluded && !entry.invalidated) {
+                peers.push_back(name);
+            }
+        }
+
+        std::shuffle(peers.begin(), peers.end(), rng_);
+        peers.resize(std::min(count, peers.size()));
+        return peers;
+    }
+
+    std::string
+    publish(const nixl_blob_t &md, bool invalidated) {
+        const uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+        // Versions exceed the ones of a previous instance of this agent
+        myVersion_ = std::max(myVersion_ + 1, now);
+
+        gossipEntry &mine = entries_[myName_];
+        mine.ip = senderAddr_;
+        mine.port = myPort_;
+        mine.version = myVersion_;
+        mine.invalidated = invalidated;
+        mine.md = invalidated ? nixl_blob_t() : md;
+
+        return makeMessage("GOSP", {myName_});
+    }
+
+    // Merge the entries into the agent, returns the newer ones
+    std::vector<std::string>
+    mergeEntries(nixlSerDes &sd,
+                 size_t count,
+                 const std::string &sender,
+                 const std::string &peer_ip,
+                 nixlAgent *agent) {
+        std::vector<std::string> accepted;
+        for (size_t i = 0; i < count; i++) {
+            std::string name;
+            gossipEntry entry;
+            if (getEntry(sd, name, entry, true) != NIXL_SUCCESS) {
+                NIXL_ERROR << "Received bad gossip entry from agent " << sender;
+                break;
+            }
+
+            auto known = entries_.find(name);
+            if (name == myName_ ||
+                (known != entries_.end() && known->second.version >= entry.version)) {
+                continue; // Stale copy
+            }
+
+            if (entry.ip == senderAddr_) {
+                entry.ip = peer_ip;
+            }
+
+            if (entry.invalidated) {
+                if (known != entries_.end() && !known->second.md.empty()) {
+                    agent->invalidateRemoteMD(name);
+                }
+            } else {
+                std::string remote_name;
+                const nixl_status_t ret = agent->loadRemoteMD(entry.md, remote_name);
+                if (ret != NIXL_SUCCESS || remote_name != name) {
+                    NIXL_ERROR << "loadRemoteMD in listener thread failed for gossiped md of "
+                               << name << " with error " << ret;
+                    continue;
+                }
+            }
+
+            entries_[name] = std::move(entry);
+            accepted.push_back(name);
+        }
+        return accepted;
+    }
+
+    // Merge the addresses of a digest, returns the versions of the digest
+    std::unordered_map<std::string, uint64_t>
+    mergeDigest(nixlSerDes &sd, size_t count, const std::string &sender, const std::string &peer_ip) {
+        std::unordered_map<std::string, uint64_t> versions;
+        for (size_t i = 0; i < count; i++) {
+            std::string name;
+            gossipEntry entry;
+            if (getEntry(sd, name, entry, false) != NIXL_SUCCESS) {
+                NIXL_ERROR << "Received bad gossip digest entry from agent " << sender;
+                break;
+            }
+
+            versions[name] = entry.version;
+            // Only the address, the metadata comes from relays and digest exchanges
+            if (name != myName_ && !entry.invalidated && entries_.count(name) == 0) {
+                gossipEntry &address = entries_[name];
+                address.ip = (entry.ip == senderAddr_) ? peer_ip : entry.ip;
+                address.port = entry.port;
+            }
+        }
+        return versions;
+    }
+
+public:
+    nixlGossip(const std::string &name, int port, unsigned fanout)
+        : myName_(name),
+          myPort_(port),
+          fanout_(fanout),
+          nextPull_(std::chrono::steady_clock::now() + pullInterval_),
+          rng_(std::random_device{}()) {}
+
+    static bool
+    isGossipHeader(const std::string &header) {
+        return header == "GOSP" || header == "GPUL" || header == "GDIG" || header == "GDIR" ||
+            header == "GMEM";
+    }
+
+    // Message to send to a peer with the metadata of this agent
+    std::string
+    sendLocalMD(const nixl_blob_t &md) {
+        return publish(md, false);
+    }
+
+    // Message to send to a peer with the invalidation of the metadata of this agent
+    std::string
+    invalidateLocalMD() {
+        return publish({}, true);
+    }
+
+    /**
+     * Process a gossip message received from the peer at peer_ip. The reply is sent back on the
+     * same socket, the relays to the peers by their listener addresses.
+     */
+    void
+    receive(const std::string &header,
+            const std::string &payload,
+            const std::string &peer_ip,
+            nixlAgent *agent,
+            std::string &reply,
+            std::vector<outMessage> &relays) {
+        nixlSerDes sd;
+        std::string sender;
+        size_t count;
+        if (sd.importStr(payload) != NIXL_SUCCESS || (sender = sd.getStr("sender")).empty() ||
+            sd.getBuf("count", &count, sizeof(count)) != NIXL_SUCCESS) {
+            NIXL_ERROR << "Received bad gossip message from peer " << peer_ip;
+            return;
+        }
+
+        if (header == "GOSP" || header == "GPUL") {
+            const auto accepted = mergeEntries(sd, count, sender, peer_ip, agent);
+            if (header == "GPUL" || accepted.empty()) {
+                return;
+            }
+
+            // A sender sending its own metadata learns some agents to exchange digests with
+            if (count == 1 && accepted.front() == sender) {
+                reply = makeMessage("GMEM", pickPeers(maxReplyEntries_, sender));
+            }
+
+            // The entries are not sent back to their agent nor to the sender
+            for (const auto &peer : pickPeers(fanout_, sender)) {
+                std::vector<std::string> names;
+                for (const auto &name : accepted) {
+                    if (name != peer) {
+                        names.push_back(name);
+                    }
+                }
+
+                if (!names.empty()) {
+                    const gossipEntry &entry = entries_.at(peer);
+                    relays.push_back({entry.ip, entry.port, makeMessage("GOSP", names)});
+                }
+            }
+            return;
+        }
+
+        const auto versions = mergeDigest(sd, count, sender, peer_ip);
+        if (header == "GMEM") {
+            return;
+        }
+
+        std::vector<std::string> newer;
+        bool sender_newer = false;
+        for (const auto &[name, entry] : entries_) {
+            const auto version = versions.find(name);
+            if (name != sender && entry.version != 0 &&
+                (version == versions.end() || version->second < entry.version) &&
+                newer.size() < maxReplyEntries_) {
+                newer.push_back(name);
+            }
+        }
+        for (const auto &[name, version] : versions) {
+            const auto entry = entries_.find(name);
+            sender_newer |= (name != myName_ && version != 0 &&
+                             (entry == entries_.end() || entry->second.version < version));
+        }
+
+        if (!newer.empty()) {
+            reply = makeMessage("GPUL", newer);
+        }
+
+        // Push-pull, the entries which only the sender has come back in reply to this digest
+        if (header == "GDIG" && sender_newer) {
+            reply += makeDigest("GDIR");
+        }
+    }
+
+    // Periodic digest exchange with a random peer
+    bool
+    pull(outMessage &out) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now < nextPull_ || myVersion_ == 0) {
+            return false;
+        }
+        nextPull_ = now + pullInterval_;
+
+        const auto peers = pickPeers(1, "");
+        if (peers.empty()) {
+            return false;
+        }
+
+        const gossipEntry &entry = entries_.at(peers.front());
+        out = {entry.ip, entry.port, makeDigest("GDIG")};
+        return true;
+    }
+};
+
 #if HAVE_ETCD
 class nixlEtcdClient {
 private:
-    std::unique_ptr<etcd::SyncClient> etcd;
+    // Metadata value received from etcd
+    struct etcdValue {
+        nixl_blob_t data;
+        int64_t revision;
+    };
+
+    // Watcher of a key or of a prefix. It is re-created from the last revision it saw when it
+    // fails, by the commWorker thread which owns it.
+    class etcdWatch {
+    public:
+        using callback_t = std::function<void(const etcd::Event &)>;
+
+        etcdWatch(etcd::Client &client,
+                  const std::string &key,
+                  int64_t from_revision,
+                  bool recursive,
+                  callback_t callback)
+            : client_(client),
+              key_(key),
+              recursive_(recursive),
+              callback_(std::move(callback)),
+              lastRevision_(from_revision - 1) {
+            start();
+        }
+
+        ~etcdWatch() {
+            stop();
+        }
+
+        etcdWatch(const etcdWatch &) = delete;
+        etcdWatch &
+        operator=(const etcdWatch &) = delete;
+
+        void
+        restartIfFailed() {
+            if (!failed_.exchange(false)) {
+                return;
+            }
+            stop();
+            NIXL_INFO << "Restarting the etcd watcher of " << key_ << " from revision "
+                      << lastRevision_ + 1;
+            try {
+                start();
+            }
+            catch (const std::exception &e) {
+                NIXL_ERROR << "Error restarting the etcd watcher of " << key_ << ": " << e.what();
+                failed_ = true;
+            }
+        }
+
+    private:
+        void
+        start() {
+            watcher_ = std::make_unique<etcd::Watcher>(
+                client_,
+                key_,
+                lastRevision_ + 1,
+                [this](etcd::Response response) { processResponse(response); },
+                recursive_);
+            watcher_->Wait([this](bool cancelled) {
+                if (!cancelled) {
+                    failed_ = true;
+                }
+            });
+        }
+
+        void
+        stop() {
+            if (watcher_) {
+                watcher_->Cancel();
+                watcher_.reset();
+            }
+        }
+
+        void
+        processResponse(const etcd::Response &response) {
+            if (!response.is_ok()) {
+                NIXL_ERROR << "Watcher of " << key_ << " failed: " << response.error_message();
+                failed_ = true;
+                return;
+            }
+            for (const auto &event : response.events()) {
+                lastRevision_ = std::max(lastRevision_.load(), event.kv().modified_index());
+                callback_(event);
+            }
+        }
+
+        etcd::Client &client_;
+        const std::string key_;
+        const bool recursive_;
+        const callback_t callback_;
+        std::atomic<int64_t> lastRevision_;
+        std::atomic<bool> failed_{false};
+        std::unique_ptr<etcd::Watcher> watcher_;
+    };
+
+    // Fetch of one agent's metadata, completed by its get or by the watcher of its key
+    struct pendingFetch {
+        std::string agent;
+        std::string label;
+        std::string key;
+        std::optional<pplx::task<etcd::Response>> get;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    // Fetch of the metadata of all the agents in the namespace, by a single range get
+    struct pendingBulkFetch {
+        std::string label;
+        pplx::task<etcd::Response> get;
+    };
+
+    std::unique_ptr<etcd::Client> etcd;
     const std::string namespace_prefix;
-    std::vector<std::string> invalidated_agents;
-    std::mutex invalidated_agents_mutex;
-    std::unordered_map<std::string, std::unique_ptr<etcd::Watcher>> agentWatchers;
+    const std::string myName_;
     std::chrono::microseconds watchTimeout_;
 
+    // Owned by the commWorker thread
+    std::list<pendingFetch> pendingFetches_;
+    std::list<pendingBulkFetch> pendingBulkFetches_;
+    std::unordered_map<std::string, int64_t> loadedRevisions_;
+    std::unordered_set<std::string> subscribedLabels_;
+
+    // Watchers only cover what this agent needs: the keys of the fetches which did not find
+    // them yet (with the number of such fetches), the prefix key of every loaded agent for its
+    // invalidation, and the namespace once labels are subscribed to by bulk fetches
+    std::unordered_map<std::string, size_t> waitingKeys_;
+    std::unordered_map<std::string, std::unique_ptr<etcdWatch>> keyWatchers_;
+    std::unordered_map<std::string, std::unique_ptr<etcdWatch>> agentWatchers_;
+    std::unique_ptr<etcdWatch> namespaceWatcher_;
+
+    // Shared with the callbacks of the watchers
+    std::mutex watchMutex_;
+    std::vector<std::pair<std::string, etcdValue>> receivedValues_;
+    std::vector<std::string> invalidated_agents;
+
     // Helper function to create etcd key
     std::string makeKey(const std::string& agent_name,
                         const std::string& metadata_type) {
@@ -208,6 +692,130 @@ private:
         return ss.str();
     }
 
+    // Prefix of the keys of all the agents
+    std::string
+    namespaceKey() const {
+        return namespace_prefix + "/";
+    }
+
+    // Split a key of the namespace into agent name and metadata label
+    bool
+    parseKey(const std::string &key, std::string &agent_name, std::string &metadata_type) {
+        const std::string prefix = namespaceKey();
+        if (key.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        const size_t sep = key.find('/', prefix.size());
+        if (sep == std::string::npos) {
+            return false;
+        }
+        agent_name = key.substr(prefix.size(), sep - prefix.size());
+        metadata_type = key.substr(sep + 1);
+        return !agent_name.empty();
+    }
+
+    // Queue the values put to a watched key, to be processed by the commWorker thread
+    void
+    receiveValue(const etcd::Event &event) {
+        if (event.event_type() != etcd::Event::EventType::PUT) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(watchMutex_);
+        receivedValues_.emplace_back(
+            event.kv().key(), etcdValue{event.kv().as_string(), event.kv().modified_index()});
+    }
+
+    void
+    releaseWaitingKey(const std::string &key) {
+        auto it = waitingKeys_.find(key);
+        if (it != waitingKeys_.end() && --it->second == 0) {
+            waitingKeys_.erase(it);
+            keyWatchers_.erase(key);
+        }
+    }
+
+    // Watch a key which a fetch did not find, from the revision of its get
+    void
+    watchWaitingKey(const std::string &key, int64_t from_revision) {
+        if (keyWatchers_.count(key) > 0) {
+            return;
+        }
+        try {
+            keyWatchers_[key] = std::make_unique<etcdWatch>(
+                *etcd, key, from_revision, false, [this](const etcd::Event &event) {
+                    receiveValue(event);
+                });
+        }
+        catch (const std::exception &e) {
+            NIXL_ERROR << "Error watching key: " << key << " in etcd: " << e.what();
+        }
+    }
+
+    // Watch the prefix key of a loaded agent, which is removed last by invalidateLocalMD
+    void
+    watchAgent(const std::string &agent_name, int64_t from_revision) {
+        if (agentWatchers_.count(agent_name) > 0) {
+            return;
+        }
+
+        // DELETE events are enqueued to be processed in commWorker
+        auto process_event = [this, agent_name](const etcd::Event &event) {
+            if (event.event_type() != etcd::Event::EventType::DELETE_) {
+                return;
+            }
+            NIXL_DEBUG << "Watcher DELETE: " << event.kv().key() << " (rev "
+                       << event.kv().modified_index() << ")";
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            invalidated_agents.push_back(agent_name);
+        };
+
+        try {
+            agentWatchers_[agent_name] = std::make_unique<etcdWatch>(
+                *etcd, makeKey(agent_name, ""), from_revision, false, process_event);
+        }
+        catch (const std::exception &e) {
+            NIXL_ERROR << "Error watching agent " << agent_name << " in etcd: " << e.what();
+        }
+    }
+
+    // Load the metadata of a remote agent, and watch for its invalidation
+    nixl_status_t
+    loadMetadata(nixlAgent *my_agent,
+                 const std::string &remote_agent,
+                 const std::string &key,
+                 const etcdValue &value) {
+        std::string remote_agent_from_md;
+        nixl_status_t ret = my_agent->loadRemoteMD(value.data, remote_agent_from_md);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to load remote metadata: " << ret;
+            return ret;
+        } else if (remote_agent_from_md != remote_agent) {
+            NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
+                       << " from md: " << remote_agent_from_md;
+            return NIXL_ERR_MISMATCH;
+        }
+        NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent << " (rev "
+                   << value.revision << ")";
+
+        loadedRevisions_[key] = std::max(loadedRevisions_[key], value.revision);
+        watchAgent(remote_agent, value.revision + 1);
+        return NIXL_SUCCESS;
+    }
+
+    // Load the metadata of a subscribed label, unless this revision was loaded already
+    void
+    loadSubscribedMetadata(nixlAgent *my_agent, const std::string &key, const etcdValue &value) {
+        std::string agent_name, metadata_type;
+        if (!parseKey(key, agent_name, metadata_type) || agent_name == myName_) {
+            return;
+        }
+        auto it = loadedRevisions_.find(key);
+        if (it != loadedRevisions_.end() && it->second >= value.revision) {
+            return;
+        }
+        loadMetadata(my_agent, agent_name, key, value);
+    }
+
 public:
     explicit nixlEtcdClient(
         const std::string &my_agent_name,
@@ -215,11 +823,12 @@ public:
         : namespace_prefix(
               nixl::config::getValueDefaulted<std::string>("NIXL_ETCD_NAMESPACE",
                                                            NIXL_ETCD_NAMESPACE_DEFAULT)),
+          myName_(my_agent_name),
           watchTimeout_(timeout) {
         const auto etcd_endpoints = nixl::config::getNonEmptyString("NIXL_ETCD_ENDPOINTS");
 
         try {
-            etcd = std::make_unique<etcd::SyncClient>(etcd_endpoints);
+            etcd = std::make_unique<etcd::Client>(etcd_endpoints);
         }
         catch (const std::exception &e) {
             NIXL_ERROR << "Error creating etcd client: " << e.what();
@@ -229,13 +838,28 @@ public:
         NIXL_DEBUG << "Using etcd namespace for agents: " << namespace_prefix;
 
         std::string agent_prefix = makeKey(my_agent_name, "");
-        etcd::Response response = etcd->put(agent_prefix, "");
+        etcd::Response response = etcd->put(agent_prefix, "").get();
         if (!response.is_ok()) {
             throw std::runtime_error("Failed to store agent " + my_agent_name +
                                      " prefix key in etcd: " + response.error_message());
         }
     }
 
+    ~nixlEtcdClient() {
+        // The callbacks of the watchers use the members of this client
+        namespaceWatcher_.reset();
+        keyWatchers_.clear();
+        agentWatchers_.clear();
+        for (auto &fetch : pendingFetches_) {
+            if (fetch.get) {
+                fetch.get->wait();
+            }
+        }
+        for (auto &fetch : pendingBulkFetches_) {
+            fetch.get.wait();
+        }
+    }
+
     // Store metadata in etcd
     nixl_status_t storeMetadataInEtcd(const std::string& agent_name,
                                       const std::string& metadata_type,
@@ -247,7 +871,7 @@ public:
 
         try {
             std::string metadata_key = makeKey(agent_name, metadata_type);
-            etcd::Response response = etcd->put(metadata_key, metadata);
+            etcd::Response response = etcd->put(metadata_key, metadata).get();
 
             if (response.is_ok()) {
                 NIXL_DEBUG << "Successfully stored " << metadata_type
@@ -274,7 +898,7 @@ public:
 
         try {
             std::string agent_prefix = makeKey(agent_name, "");
-            etcd::Response response = etcd->rmdir(agent_prefix, true);
+            etcd::Response response = etcd->rmdir(agent_prefix, true).get();
 
             if (response.is_ok()) {
                 NIXL_DEBUG << "Successfully removed " << response.values().size()
@@ -292,147 +916,202 @@ public:
         }
     }
 
-    // Fetch metadata from etcd
-    nixl_status_t fetchMetadataFromEtcd(const std::string& agent_name,
-                                        const std::string& metadata_type,
-                                        nixl_blob_t& metadata) {
+    // Start fetching an agent's metadata, without waiting for it. The fetch completes in
+    // processFetches, once the key is read or put, or fails after the watch timeout.
+    nixl_status_t
+    startFetch(const std::string &remote_agent, const std::string &metadata_label) {
         if (!etcd) {
             NIXL_ERROR << "ETCD client not available";
             return NIXL_ERR_NOT_SUPPORTED;
         }
 
-        std::string metadata_key = makeKey(agent_name, metadata_type);
-        try {
-            etcd::Response response = etcd->get(metadata_key);
+        pendingFetch fetch{remote_agent,
+                           metadata_label,
+                           makeKey(remote_agent, metadata_label),
+                           std::nullopt,
+                           std::chrono::steady_clock::now() + watchTimeout_};
+        waitingKeys_[fetch.key]++;
 
-            if (response.is_ok()) {
-                metadata = response.value().as_string();
-                NIXL_DEBUG << "Successfully fetched key: " << metadata_key
-                           << " (rev " << response.value().modified_index() << ")";
-                return NIXL_SUCCESS;
-            } else {
-                NIXL_INFO << "Failed to fetch key: " << metadata_key
-                          << " from etcd: " << response.error_message();
-                return NIXL_ERR_NOT_FOUND;
-            }
+        try {
+            fetch.get = etcd->get(fetch.key);
         }
         catch (const std::exception &e) {
-            NIXL_ERROR << "Error fetching key: " << metadata_key << " from etcd: " << e.what();
+            NIXL_ERROR << "Error fetching key: " << fetch.key << " from etcd: " << e.what();
+            releaseWaitingKey(fetch.key);
             return NIXL_ERR_UNKNOWN;
         }
-    }
-
-    nixl_status_t waitForMetadataFromEtcd(const std::string& metadata_key,
-                                          nixl_blob_t& remote_metadata) {
-        try {
 
-            // Get current index to watch from
-            etcd::Response response = etcd->get(metadata_key);
-            int64_t watch_index = response.index();
-            std::promise<nixl_status_t> ret_prom;
-            auto future = ret_prom.get_future();
-            std::atomic<bool> promise_set{false};
-
-            // This lambda assumes lifetime only inside this method
-            auto watcher_callback = [&](etcd::Response response) -> void {
-                if (promise_set.exchange(true)) {
-                    NIXL_DEBUG << "Ignoring subsequent watch event for key: " << metadata_key;
-                    return;
-                }
+        pendingFetches_.push_back(std::move(fetch));
+        return NIXL_SUCCESS;
+    }
 
-                if (!response.is_ok()) {
-                    NIXL_ERROR << "Watch failed for key: " << metadata_key << " : "
-                               << response.error_message();
-                    ret_prom.set_value(NIXL_ERR_BACKEND);
-                    return;
-                }
-                if (response.action() == "delete") {
-                    NIXL_ERROR << "Watch response: metadata key deleted: " << metadata_key;
-                    ret_prom.set_value(NIXL_ERR_INVALID_PARAM);
-                    return;
-                }
-                remote_metadata = response.value().as_string();
-                NIXL_DEBUG << "Watch response: metadata key fetched: " << metadata_key;
-                ret_prom.set_value(NIXL_SUCCESS);
-            };
+    // Start fetching the metadata of all the agents in the namespace with a single range get,
+    // and keep loading the metadata of agents which later put it with the same label
+    nixl_status_t
+    startBulkFetch(const std::string &metadata_label) {
+        if (!etcd) {
+            NIXL_ERROR << "ETCD client not available";
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
 
-            auto watcher = etcd::Watcher(*etcd, metadata_key, watch_index, watcher_callback);
+        subscribedLabels_.insert(metadata_label);
 
-            auto status = future.wait_for(watchTimeout_);
-            if (status == std::future_status::timeout) {
-                NIXL_ERROR << "Watch timed out for key: " << metadata_key;
-                return NIXL_ERR_BACKEND;
-            }
-            watcher.Cancel();
-            return future.get();
+        try {
+            pendingBulkFetches_.push_back(
+                {metadata_label,
+                 etcd->ls(namespaceKey())});
         }
         catch (const std::exception &e) {
-            NIXL_ERROR << "Error watching etcd for key: " << metadata_key << " : " << e.what();
-            return NIXL_ERR_BACKEND;
+            NIXL_ERROR << "Error listing namespace: " << namespace_prefix
+                       << " from etcd: " << e.what();
+            return NIXL_ERR_UNKNOWN;
         }
+        return NIXL_SUCCESS;
     }
 
-    // Fetch metadata from etcd or wait for it to be available
-    nixl_status_t fetchOrWaitForMetadataFromEtcd(const std::string& remote_agent,
-                                                 const std::string& metadata_label,
-                                                 nixl_blob_t& remote_metadata) {
-        nixl_status_t ret = fetchMetadataFromEtcd(remote_agent, metadata_label, remote_metadata);
-        if (ret == NIXL_SUCCESS) {
-            return NIXL_SUCCESS;
+    // Complete the fetches whose get returned or whose key was put, without blocking
+    void
+    processFetches(nixlAgent *my_agent) {
+        if (namespaceWatcher_) {
+            namespaceWatcher_->restartIfFailed();
+        }
+        for (auto &[key, watcher] : keyWatchers_) {
+            watcher->restartIfFailed();
+        }
+        for (auto &[agent_name, watcher] : agentWatchers_) {
+            watcher->restartIfFailed();
         }
 
-        std::string metadata_key = makeKey(remote_agent, metadata_label);
-        NIXL_DEBUG << "Metadata not found, setting up watch for: " << metadata_key;
+        std::vector<std::pair<std::string, etcdValue>> received;
+        {
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            received = std::move(receivedValues_);
+            receivedValues_.clear();
+        }
 
-        return waitForMetadataFromEtcd(metadata_key, remote_metadata);
-    }
+        for (auto it = pendingBulkFetches_.begin(); it != pendingBulkFetches_.end();) {
+            if (!it->get.is_done()) {
+                ++it;
+                continue;
+            }
 
-    // Setup a watcher for an agent's metadata invalidation if it doesn't already exist
-    void setupAgentWatcher(const std::string &agent_name) {
-        if (agentWatchers.find(agent_name) != agentWatchers.end()) {
-            return;
+            try {
+                etcd::Response response = it->get.get();
+                if (response.is_ok()) {
+                    size_t num_agents = 0;
+                    for (const auto &value : response.values()) {
+                        std::string agent_name, metadata_type;
+                        if (parseKey(value.key(), agent_name, metadata_type) &&
+                            metadata_type == it->label) {
+                            loadSubscribedMetadata(
+                                my_agent,
+                                value.key(),
+                                etcdValue{value.as_string(), value.modified_index()});
+                            num_agents++;
+                        }
+                    }
+                    NIXL_DEBUG << "Bulk fetch of label " << it->label << " found " << num_agents
+                               << " agents (rev " << response.index() << ")";
+
+                    // Agents which put their metadata after the range get are seen by the
+                    // namespace watcher, from now on
+                    if (!namespaceWatcher_) {
+                        namespaceWatcher_ = std::make_unique<etcdWatch>(
+                            *etcd,
+                            namespaceKey(),
+                            response.index() + 1,
+                            true,
+                            [this](const etcd::Event &event) { receiveValue(event); });
+                    }
+                } else {
+                    NIXL_INFO << "Failed to list namespace: " << namespace_prefix
+                              << " from etcd: " << response.error_message();
+                }
+            }
+            catch (const std::exception &e) {
+                NIXL_ERROR << "Error listing namespace: " << namespace_prefix
+                           << " from etcd: " << e.what();
+            }
+            it = pendingBulkFetches_.erase(it);
         }
 
-        // DELETE events are enqueued to be deleted in commWorker (can't be done inside the Watcher callback)
-        auto process_response = [this, agent_name](etcd::Response response) -> void {
-            if (!response.is_ok()) {
-                NIXL_ERROR << "Watcher failed to watch agent " << agent_name
-                           << " from etcd: " << response.error_message();
-                return;
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = pendingFetches_.begin(); it != pendingFetches_.end();) {
+            std::optional<etcdValue> value;
+
+            if (it->get && it->get->is_done()) {
+                try {
+                    etcd::Response response = it->get->get();
+                    if (response.is_ok()) {
+                        value = etcdValue{response.value().as_string(),
+                                          response.value().modified_index()};
+                        NIXL_DEBUG << "Successfully fetched key: " << it->key << " (rev "
+                                   << value->revision << ")";
+                    } else {
+                        NIXL_DEBUG << "Metadata not found, waiting for a watch event for: "
+                                   << it->key;
+                        watchWaitingKey(it->key, response.index() + 1);
+                    }
+                }
+                catch (const std::exception &e) {
+                    NIXL_ERROR << "Error fetching key: " << it->key << " from etcd: " << e.what();
+                }
+                it->get.reset();
             }
-            NIXL_DEBUG << "Watcher received " << response.events().size() << " events from etcd";
-            if (response.events().size() != 1) {
-                NIXL_ERROR << "Watcher agent " << agent_name << " received unexpected number of events from etcd: "
-                           << response.events().size();
-                return;
+
+            if (!value) {
+                for (const auto &[key, received_value] : received) {
+                    if (key == it->key) {
+                        NIXL_DEBUG << "Watch response: metadata key fetched: " << key;
+                        value = received_value;
+                    }
+                }
             }
-            const auto &event = response.events()[0];
-            if (event.event_type() == etcd::Event::EventType::DELETE_) {
-                NIXL_DEBUG << "Watcher DELETE: " << event.kv().key()
-                           << " (rev " << event.kv().modified_index() << ")";
-                std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
-                invalidated_agents.push_back(agent_name);
+
+            if (value) {
+                releaseWaitingKey(it->key);
+                loadMetadata(my_agent, it->agent, it->key, *value);
+                it = pendingFetches_.erase(it);
+            } else if (now >= it->deadline) {
+                NIXL_ERROR << "Watch timed out for key: " << it->key;
+                NIXL_ERROR << "Failed to fetch metadata from etcd: " << NIXL_ERR_BACKEND;
+                releaseWaitingKey(it->key);
+                it = pendingFetches_.erase(it);
             } else {
-                NIXL_ERROR << "Watcher for " << event.kv().key()
-                           << " received unexpected event from etcd: "
-                           << static_cast<int>(event.event_type());
+                ++it;
             }
-        };
+        }
 
-        std::string agent_prefix = makeKey(agent_name, "");
-        agentWatchers[agent_name] = std::make_unique<etcd::Watcher>(*etcd, agent_prefix, process_response);
+        for (const auto &[key, value] : received) {
+            std::string agent_name, metadata_type;
+            if (!parseKey(key, agent_name, metadata_type)) {
+                continue;
+            }
+            if (subscribedLabels_.count(metadata_type) > 0) {
+                loadSubscribedMetadata(my_agent, key, value);
+            }
+        }
     }
 
-    // Process invalidated agents from watchers
+    // Process invalidated agents from the watcher
     void processInvalidatedAgents(nixlAgent* my_agent) {
         std::vector<std::string> tmp_invalidated_agents;
         {
-            std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
+            std::lock_guard<std::mutex> lock(watchMutex_);
             tmp_invalidated_agents = std::move(invalidated_agents);
+            invalidated_agents.clear();
         }
         for (const auto &agent : tmp_invalidated_agents) {
             NIXL_DEBUG << "Invalidated agent: " << agent;
-            agentWatchers.erase(agent);
+            agentWatchers_.erase(agent);
+            for (auto it = loadedRevisions_.begin(); it != loadedRevisions_.end();) {
+                std::string agent_name, metadata_type;
+                if (parseKey(it->first, agent_name, metadata_type) && agent_name == agent) {
+                    it = loadedRevisions_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
             nixl_status_t ret = my_agent->invalidateRemoteMD(agent);
             if (ret != NIXL_SUCCESS)
                 NIXL_ERROR << "Failed to invalidate remote metadata for agent: " << agent << ": " << ret;
@@ -465,6 +1144,42 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
     }
 #endif // HAVE_ETCD
 
+    std::unique_ptr<nixlGossip> gossip = nullptr;
+    if (config_.gossipFanout > 0) {
+        const int my_port = config_.listenPort ? config_.listenPort : default_comm_port;
+        gossip = std::make_unique<nixlGossip>(name_, my_port, config_.gossipFanout);
+    }
+    std::vector<nixlGossip::outMessage> gossip_out;
+
+    // Peers whose reply to a metadata fetch is expected, which is their full metadata
+    std::set<nixl_socket_peer_t> pending_fetches;
+
+    // Send to a peer by its listener address, connecting to it if needed
+    auto send_to_peer = [this, &pending_fetches](
+                            const std::string &ip, int port, const std::string &msg) {
+        const nixl_socket_peer_t peer = std::make_pair(ip, port);
+        auto client = remoteSockets.find(peer);
+        if (client == remoteSockets.end()) {
+            const int new_client = connectToIP(ip, port);
+            if (new_client == -1) {
+                NIXL_ERROR << "Listener thread could not connect to IP " << ip << " and port "
+                           << port;
+                return;
+            }
+            client = remoteSockets.emplace(peer, new_client).first;
+        }
+
+        try {
+            sendCommMessage(client->second, msg);
+        }
+        catch (const std::runtime_error &e) {
+            NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
+            close(client->second);
+            pending_fetches.erase(client->first);
+            remoteSockets.erase(client);
+        }
+    };
+
     while(!(commThreadStop)) {
         std::vector<nixl_comm_req_t> work_queue;
 
@@ -534,7 +1249,9 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
             switch(req_command) {
             case SOCK_SEND: {
                 try {
-                    sendCommMessage(client->second, "NIXLCOMM:LOAD" + my_MD);
+                    sendCommMessage(client->second,
+                                    gossip ? gossip->sendLocalMD(my_MD) :
+                                             "NIXLCOMM:LOAD" + my_MD);
                 }
                 catch (const std::runtime_error &e) {
                     NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
@@ -543,8 +1260,17 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                 break;
             }
             case SOCK_FETCH: {
+                // Version of the cached metadata of the agent, the peer replies SAME if its
+                // metadata did not change, older peers ignore it and send their metadata
+                std::string probe;
+                uint64_t version;
+                if (metadataCache_ && metadataCache_->getVersion(my_MD, version)) {
+                    probe = std::to_string(version);
+                }
+
                 try {
-                    sendCommMessage(client->second, "NIXLCOMM:SEND");
+                    sendCommMessage(client->second, makeFetchMessage(probe));
+                    pending_fetches.insert(req_sock);
                 }
                 catch (const std::runtime_error &e) {
                     NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
@@ -554,7 +1280,9 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
             }
             case SOCK_INVAL: {
                 try {
-                    sendCommMessage(client->second, "NIXLCOMM:INVL" + name_);
+                    sendCommMessage(client->second,
+                                    gossip ? gossip->invalidateLocalMD() :
+                                             "NIXLCOMM:INVL" + name_);
                 }
                 catch (const std::runtime_error &e) {
                     NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
@@ -590,28 +1318,25 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                     const std::string &metadata_label = req_ip;
                     const std::string &remote_agent = my_MD;
 
-                    // First try a direct get
-                    nixl_blob_t remote_metadata;
-                    nixl_status_t ret = etcdClient->fetchOrWaitForMetadataFromEtcd(remote_agent, metadata_label,
-                                                                                   remote_metadata);
+                    // Completed in processFetches, other requests don't wait for it
+                    const nixl_status_t ret =
+                        etcdClient->startFetch(remote_agent, metadata_label);
                     if (ret != NIXL_SUCCESS) {
                         NIXL_ERROR << "Failed to fetch metadata from etcd: " << ret;
-                        break;
+                    }
+                    break;
+                }
+                case ETCD_FETCH_ALL:
+                {
+                    if (!useEtcd) {
+                        throw std::runtime_error("ETCD is not enabled");
                     }
 
-                    std::string remote_agent_from_md;
-                    ret = myAgent->loadRemoteMD(remote_metadata, remote_agent_from_md);
+                    const std::string &metadata_label = req_ip;
+                    const nixl_status_t ret = etcdClient->startBulkFetch(metadata_label);
                     if (ret != NIXL_SUCCESS) {
-                        NIXL_ERROR << "Failed to load remote metadata: " << ret;
-                        break;
-                    } else if (remote_agent_from_md != remote_agent) {
-                        NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
-                                   << " from md: " << remote_agent_from_md;
-                        break;
+                        NIXL_ERROR << "Failed to fetch all metadata from etcd: " << ret;
                     }
-                    NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent;
-
-                    etcdClient->setupAgentWatcher(remote_agent);
                     break;
                 }
                 case ETCD_INVAL:
@@ -635,6 +1360,7 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
             }
             if (needs_disconnect) {
                 close(client->second);
+                pending_fetches.erase(client->first);
                 client = remoteSockets.erase(client);
             }
         }
@@ -659,6 +1385,7 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
             catch (const std::runtime_error &e) {
                 NIXL_ERROR << "Failed to receive message from peer, disconnecting: " << e.what();
                 close(socket_iter->second);
+                pending_fetches.erase(socket_iter->first);
                 socket_iter = remoteSockets.erase(socket_iter);
                 continue;
             }
@@ -680,15 +1407,64 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                         NIXL_ERROR << "loadRemoteMD in listener thread failed for md from peer "
                                    << socket_iter->first.first << ":" << socket_iter->first.second
                                    << " with error " << ret;
+                        pending_fetches.erase(socket_iter->first);
                         continue;
                     }
-                    // not sure what to do with remote_agent
+
+                    // Only replies to our fetches are full metadata, others can be partial.
+                    // Cached uncompressed, as the peers version their uncompressed metadata
+                    if (pending_fetches.erase(socket_iter->first) && metadataCache_) {
+                        nixlSerDes sd;
+                        if (sd.importStr(remote_md) == NIXL_SUCCESS) {
+                            metadataCache_->store(remote_agent, sd.exportStr());
+                        }
+                    }
                 } else if(header == "SEND") {
                     nixl_blob_t my_MD;
                     myAgent->getLocalMD(my_MD);
 
+                    // Version probe of the cached metadata of the peer, and its codecs
+                    const std::vector<std::string> fields =
+                        absl::StrSplit(command.substr(4), absl::MaxSplits('|', 1));
+                    const std::string &probe = fields[0];
+                    uint32_t peer_codecs = 0;
+                    if (fields.size() < 2 || !absl::SimpleAtoi(fields[1], &peer_codecs)) {
+                        peer_codecs = 0;
+                    }
+                    const bool same = !probe.empty() &&
+                        probe == std::to_string(nixlMetadataCache::version(my_MD));
+
                     try {
-                        sendCommMessage(socket_iter->second, std::string("NIXLCOMM:LOAD" + my_MD));
+                        sendCommMessage(socket_iter->second,
+                                        same ? "NIXLCOMM:SAME" + probe + "|" + name_ :
+                                               makeLoadMessage(my_MD, metadataCodec_, peer_codecs));
+                    }
+                    catch (const std::runtime_error &e) {
+                        NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
+                        disconnected = true;
+                        break;
+                    }
+                } else if (header == "SAME") {
+                    const std::vector<std::string> fields =
+                        absl::StrSplit(command.substr(4), absl::MaxSplits('|', 1));
+                    uint64_t version;
+                    nixl_blob_t cached_md;
+                    std::string remote_agent;
+                    if (fields.size() == 2 && absl::SimpleAtoi(fields[0], &version) &&
+                        metadataCache_ &&
+                        metadataCache_->load(fields[1], version, cached_md) == NIXL_SUCCESS &&
+                        myAgent->loadRemoteMD(cached_md, remote_agent) == NIXL_SUCCESS) {
+                        pending_fetches.erase(socket_iter->first);
+                        continue;
+                    }
+
+                    // The cached metadata is gone, fetch it without the probe
+                    NIXL_WARN << "Failed to load cached metadata of peer "
+                              << socket_iter->first.first << ":" << socket_iter->first.second
+                              << ", fetching it";
+                    try {
+                        sendCommMessage(socket_iter->second, makeFetchMessage(""));
+                        pending_fetches.insert(socket_iter->first);
                     }
                     catch (const std::runtime_error &e) {
                         NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
@@ -699,6 +1475,26 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                     std::string remote_agent = command.substr(4);
                     myAgent->invalidateRemoteMD(remote_agent);
                     break;
+                } else if (gossip && nixlGossip::isGossipHeader(header)) {
+                    std::string reply;
+                    gossip->receive(header,
+                                    command.substr(4),
+                                    socket_iter->first.first,
+                                    myAgent,
+                                    reply,
+                                    gossip_out);
+                    if (reply.empty()) {
+                        continue;
+                    }
+
+                    try {
+                        sendCommMessage(socket_iter->second, reply);
+                    }
+                    catch (const std::runtime_error &e) {
+                        NIXL_ERROR << "Failed to send message to peer, disconnecting: " << e.what();
+                        disconnected = true;
+                        break;
+                    }
                 } else {
                     NIXL_ERROR << "Received socket message with bad header" + header + " from peer "
                                << socket_iter->first.first << ":" << socket_iter->first.second;
@@ -707,14 +1503,29 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
 
             if (disconnected) {
                 close(socket_iter->second);
+                pending_fetches.erase(socket_iter->first);
                 socket_iter = remoteSockets.erase(socket_iter);
             } else {
                 socket_iter++;
             }
         }
 
+        // fourth, relay gossip, not while iterating over the sockets
+        if (gossip) {
+            nixlGossip::outMessage pull;
+            if (gossip->pull(pull)) {
+                gossip_out.push_back(std::move(pull));
+            }
+
+            for (const auto &out : gossip_out) {
+                send_to_peer(out.ip, out.port, out.msg);
+            }
+            gossip_out.clear();
+        }
+
 #if HAVE_ETCD
         if (etcdClient) {
+            etcdClient->processFetches(myAgent);
             etcdClient->processInvalidatedAgents(myAgent);
         }
 #endif // HAVE_ETCD
@@ -659,6 +659,18 @@ void nixlPluginManager::registerBuiltinPlugins() {
     NIXL_REGISTER_STATIC_PLUGIN(Backend, POSIX)
 #endif
 
+#ifdef STATIC_PLUGIN_SHM
+    NIXL_REGISTER_STATIC_PLUGIN(Backend, SHM)
+#endif
+
+#ifdef STATIC_PLUGIN_TCP
+    NIXL_REGISTER_STATIC_PLUGIN(Backend, TCP)
+#endif
+
+#ifdef STATIC_PLUGIN_LOCAL
+    NIXL_REGISTER_STATIC_PLUGIN(Backend, LOCAL)
+#endif
+
 #ifdef STATIC_PLUGIN_GPUNETIO
     NIXL_REGISTER_STATIC_PLUGIN(Backend, GPUNETIO)
 #endif
@@ -18,6 +18,10 @@
 #include "common/configuration.h"
 #include "common/nixl_log.h"
 
+#include <chrono>
+#include <map>
+#include <tuple>
+
 namespace {
 [[nodiscard]] std::filesystem::path
 getFilePath(const nixlTelemetryExporterInitParams &init_params) {
@@ -38,9 +42,56 @@ nixlTelemetryBufferExporter::nixlTelemetryBufferExporter(
 
 nixl_status_t
 nixlTelemetryBufferExporter::exportEvent(const nixlTelemetryEvent &event) {
-    if (!buffer_.push(event)) {
+    // Overwrite the oldest events when nobody consumes them, they stay observable
+    if (!buffer_.push(event, true)) {
         return NIXL_ERR_UNKNOWN;
     }
 
     return NIXL_SUCCESS;
 }
+
+nixl_status_t
+nixlTelemetryBufferExporter::exportHistograms(
+    const std::vector<nixlTelemetryHistogram> &histograms) {
+    using summaryKey = std::tuple<std::string, std::string, uint64_t>;
+    std::map<summaryKey, std::pair<nixlLatencyHistogram::snapshot, nixlLatencyHistogram::snapshot>>
+        summaries;
+    for (const auto &histogram : histograms) {
+        auto &summary = summaries[{histogram.backend, histogram.op, histogram.sizeBucket}];
+        summary.first.merge(histogram.post);
+        summary.second.merge(histogram.xfer);
+    }
+
+    const uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch())
+                                   .count();
+    nixl_status_t status = NIXL_SUCCESS;
+    for (const auto &[key, summary] : summaries) {
+        const auto &[backend, op, size_bucket] = key;
+        const auto &[post, xfer] = summary;
+        // Named <backend>/<op>/<size>/<stat>, latencies are in nanoseconds
+        const std::string prefix =
+            backend + "/" + op + "/" + nixlTelemetryHistogram::sizeLabel(size_bucket) + "/";
+        const std::pair<const char *, uint64_t> stats[] = {
+            {"xfer_n", xfer.count()},
+            {"xfer_p50", xfer.percentile(0.5)},
+            {"xfer_p99", xfer.percentile(0.99)},
+            {"xfer_p999", xfer.percentile(0.999)},
+            {"xfer_max", xfer.max()},
+            {"post_p50", post.percentile(0.5)},
+            {"post_p99", post.percentile(0.99)},
+        };
+
+        for (const auto &[stat, value] : stats) {
+            const nixlTelemetryEvent event(timestamp,
+                                           nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                           prefix + stat,
+                                           value);
+            if (exportEvent(event) != NIXL_SUCCESS) {
+                status = NIXL_ERR_UNKNOWN;
+            }
+        }
+    }
+
+    return status;
+}
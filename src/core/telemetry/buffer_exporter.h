@@ -44,6 +44,10 @@ public:
     nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) override;
 
+    // Exports summary records per backend, operation and size, merged over remote agents
+    nixl_status_t
+    exportHistograms(const std::vector<nixlTelemetryHistogram> &histograms) override;
+
 private:
     std::filesystem::path filePath_;
     sharedRingBuffer<nixlTelemetryEvent> buffer_;
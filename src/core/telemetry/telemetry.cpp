@@ -19,10 +19,13 @@
 #include <thread>
 #include <filesystem>
 #include <unistd.h>
+#include <sys/syscall.h>
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <array>
 
+#include "backend/backend_engine.h"
 #include "common/configuration.h"
 #include "common/nixl_log.h"
 #include "telemetry.h"
@@ -36,6 +39,7 @@ namespace fs = std::filesystem;
 
 constexpr std::chrono::milliseconds DEFAULT_TELEMETRY_RUN_INTERVAL = 100ms;
 constexpr size_t DEFAULT_TELEMETRY_BUFFER_SIZE = 4096;
+constexpr uint64_t DEFAULT_TELEMETRY_TRACE_SAMPLING = 1;
 constexpr const char *defaultTelemetryPlugin = "BUFFER";
 
 nixlTelemetry::nixlTelemetry(const std::string &agent_name)
@@ -60,10 +64,18 @@ nixlTelemetry::~nixlTelemetry() {
         // continue anyway since it's not critical
     }
 
-    if (buffer_) {
+    if (rings_) {
         writeEventHelper();
-        buffer_.reset();
+        if (const size_t dropped = rings_->dropped()) {
+            NIXL_DEBUG << "Dropped " << dropped << " telemetry events on full rings";
+        }
+    }
+    if (spanRings_) {
+        if (const size_t dropped = spanRings_->dropped()) {
+            NIXL_DEBUG << "Dropped " << dropped << " trace spans on full rings";
+        }
     }
+    buffer_.reset();
 }
 
 namespace {
@@ -87,6 +99,50 @@ getExporterName() {
     return defaultTelemetryPlugin;
 }
 
+struct agentEventInfo {
+    const char *name;
+    nixl_telemetry_category_t category;
+};
+
+// Indexed by nixl_telemetry_event_id_t
+constexpr std::array<agentEventInfo, 9> agentEvents = {{
+    {"agent_tx_bytes", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER},
+    {"agent_rx_bytes", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER},
+    {"agent_tx_requests_num", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER},
+    {"agent_rx_requests_num", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER},
+    {nullptr, nixl_telemetry_category_t::NIXL_TELEMETRY_ERROR},
+    {"agent_memory_registered", nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY},
+    {"agent_memory_deregistered", nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY},
+    {"agent_xfer_time", nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE},
+    {"agent_xfer_post_time", nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE},
+}};
+
+[[nodiscard]] uint32_t
+getThreadId() noexcept {
+    thread_local const uint32_t thread_id = static_cast<uint32_t>(syscall(SYS_gettid));
+    return thread_id;
+}
+
+[[nodiscard]] uint64_t
+toSteadyNs(chrono_point_t time) noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+[[nodiscard]] nixlTelemetryEvent
+makeEvent(const nixlTelemetryRecord &record, const nixlTelemetryTimeBase &time_base) {
+    const auto &info = agentEvents[record.id_];
+    const auto timestamp = time_base.toSystemUs(record.timestampNs_);
+    if (static_cast<nixl_telemetry_event_id_t>(record.id_) ==
+        nixl_telemetry_event_id_t::AGENT_ERROR) {
+        return nixlTelemetryEvent(timestamp,
+                                  info.category,
+                                  nixlEnumStrings::statusStr(
+                                      static_cast<nixl_status_t>(record.arg_)),
+                                  record.value_);
+    }
+    return nixlTelemetryEvent(timestamp, info.category, info.name, record.value_);
+}
+
 } // namespace
 
 void
@@ -121,6 +177,19 @@ nixlTelemetry::initializeTelemetry() {
 
     NIXL_DEBUG << "NIXL telemetry is enabled with exporter: " << *exporter_name;
 
+    // Every recording thread gets a ring as large as the exporter buffer
+    rings_ = std::make_unique<nixlTelemetryRings<>>(buffer_size);
+    histogramTable_ = std::make_unique<std::atomic<histogramSet *>[]>(histogramTableSize_);
+
+    if (exporter_->exportsSpans()) {
+        spanSampling_ = nixl::config::getValueDefaulted<uint64_t>(
+            TELEMETRY_TRACE_SAMPLING_VAR, DEFAULT_TELEMETRY_TRACE_SAMPLING);
+        if (spanSampling_ > 0) {
+            spanRings_ = std::make_unique<nixlTelemetryRings<nixlTelemetrySpan>>(buffer_size);
+            NIXL_DEBUG << "Tracing one in " << spanSampling_ << " transfer request operations";
+        }
+    }
+
     const auto run_interval =
         nixl::config::getValueDefaulted(TELEMETRY_RUN_INTERVAL_VAR, DEFAULT_TELEMETRY_RUN_INTERVAL);
 
@@ -133,22 +202,270 @@ nixlTelemetry::initializeTelemetry() {
 
 bool
 nixlTelemetry::writeEventHelper() {
-    std::vector<nixlTelemetryEvent> next_queue;
-    // assume next buffer will be the same size as the current one
-    next_queue.reserve(exporter_->getMaxEventsBuffered());
+    const nixlTelemetryTimeBase time_base;
+    rings_->drain([this, &time_base](const nixlTelemetryRecord &record) {
+        // if full, ignore
+        exporter_->exportEvent(makeEvent(record, time_base));
+    });
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        events_.swap(next_queue);
+        std::lock_guard<std::mutex> lock(backendsMutex_);
+        for (nixlBackendEngine *backend : backends_) {
+            for (const auto &event : backend->getTelemetryEvents()) {
+                exporter_->exportEvent(event);
+            }
+        }
     }
-
-    for (auto &event : next_queue) {
-        // if full, ignore
-        exporter_->exportEvent(event);
+    exportHistograms();
+    if (spanRings_) {
+        exportSpans(time_base);
     }
 
     return true;
 }
 
+class nixlTelemetry::histogramSet {
+public:
+    struct entry {
+        nixlXferHistograms histograms;
+        // Snapshots at the previous export, only used by the export task
+        nixlLatencyHistogram::snapshot lastPost;
+        nixlLatencyHistogram::snapshot lastXfer;
+    };
+
+    histogramSet(const std::string &backend, nixl_xfer_op_t op, const std::string &remote_agent)
+        : backend_(backend),
+          op_(op),
+          remoteAgent_(remote_agent) {}
+
+    ~histogramSet() {
+        for (auto &size : sizes_) {
+            delete size.load(std::memory_order_relaxed);
+        }
+    }
+
+    histogramSet(const histogramSet &) = delete;
+    histogramSet &
+    operator=(const histogramSet &) = delete;
+
+    [[nodiscard]] bool
+    matches(const std::string &backend,
+            nixl_xfer_op_t op,
+            const std::string &remote_agent) const noexcept {
+        return (op_ == op) && (backend_ == backend) && (remoteAgent_ == remote_agent);
+    }
+
+    // Allocates the histograms on the first transfer of their size range
+    [[nodiscard]] nixlXferHistograms *
+    get(size_t bytes) {
+        auto &size = sizes_[sizeIndex(bytes)];
+        entry *current = size.load(std::memory_order_acquire);
+        if (current == nullptr) {
+            auto created = std::make_unique<entry>();
+            if (size.compare_exchange_strong(current,
+                                             created.get(),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+                current = created.release();
+            }
+        }
+        return &current->histograms;
+    }
+
+    template<typename Fn>
+    void
+    forEach(Fn &&fn) {
+        for (size_t i = 0; i < sizes_.size(); ++i) {
+            if (entry *size = sizes_[i].load(std::memory_order_acquire)) {
+                fn(sizeBucket(i), *size);
+            }
+        }
+    }
+
+    [[nodiscard]] const std::string &
+    backend() const noexcept {
+        return backend_;
+    }
+
+    [[nodiscard]] nixl_xfer_op_t
+    op() const noexcept {
+        return op_;
+    }
+
+    [[nodiscard]] const std::string &
+    remoteAgent() const noexcept {
+        return remoteAgent_;
+    }
+
+private:
+    // Index 0 holds empty transfers, index i the sizes in [2^(i-1), 2^i)
+    [[nodiscard]] static size_t
+    sizeIndex(size_t bytes) noexcept {
+        return bytes ? (64 - __builtin_clzll(bytes)) : 0;
+    }
+
+    [[nodiscard]] static uint64_t
+    sizeBucket(size_t index) noexcept {
+        return index ? (uint64_t(1) << (index - 1)) : 0;
+    }
+
+    const std::string backend_;
+    const nixl_xfer_op_t op_;
+    const std::string remoteAgent_;
+    std::array<std::atomic<entry *>, 65> sizes_{};
+};
+
+size_t
+nixlTelemetry::histogramHash(const std::string &backend,
+                             nixl_xfer_op_t op,
+                             const std::string &remote_agent) noexcept {
+    const size_t hash = std::hash<std::string>{}(backend) * 31 + static_cast<size_t>(op);
+    return hash * 31 + std::hash<std::string>{}(remote_agent);
+}
+
+nixlTelemetry::histogramSet *
+nixlTelemetry::findHistogramSet(size_t hash,
+                                const std::string &backend,
+                                nixl_xfer_op_t op,
+                                const std::string &remote_agent) const noexcept {
+    for (size_t i = 0; i < histogramTableSize_; ++i) {
+        histogramSet *set =
+            histogramTable_[(hash + i) % histogramTableSize_].load(std::memory_order_acquire);
+        if (set == nullptr) {
+            return nullptr;
+        }
+        if (set->matches(backend, op, remote_agent)) {
+            return set;
+        }
+    }
+    return nullptr;
+}
+
+nixlTelemetry::histogramSet *
+nixlTelemetry::addHistogramSet(size_t hash,
+                               const std::string &backend,
+                               nixl_xfer_op_t op,
+                               const std::string &remote_agent) {
+    const std::lock_guard lock(histogramsMutex_);
+    if (histogramSet *set = findHistogramSet(hash, backend, op, remote_agent)) {
+        return set;
+    }
+
+    // Sets beyond the table capacity are only found under the lock
+    for (const auto &set : histogramSets_) {
+        if (set->matches(backend, op, remote_agent)) {
+            return set.get();
+        }
+    }
+
+    histogramSet *set =
+        histogramSets_.emplace_back(std::make_unique<histogramSet>(backend, op, remote_agent))
+            .get();
+    // Keep the table at most 3/4 full, so that the lookups of missing sets stay short
+    if (histogramTableUsed_ < histogramTableSize_ / 4 * 3) {
+        size_t i = hash % histogramTableSize_;
+        while (histogramTable_[i].load(std::memory_order_relaxed) != nullptr) {
+            i = (i + 1) % histogramTableSize_;
+        }
+        histogramTable_[i].store(set, std::memory_order_release);
+        ++histogramTableUsed_;
+    }
+    return set;
+}
+
+nixlXferHistograms *
+nixlTelemetry::getXferHistograms(const std::string &backend,
+                                 nixl_xfer_op_t op,
+                                 size_t bytes,
+                                 const std::string &remote_agent) {
+    if (!exporter_) {
+        return nullptr;
+    }
+
+    const size_t hash = histogramHash(backend, op, remote_agent);
+    histogramSet *set = findHistogramSet(hash, backend, op, remote_agent);
+    if (set == nullptr) {
+        set = addHistogramSet(hash, backend, op, remote_agent);
+    }
+    return set->get(bytes);
+}
+
+void
+nixlTelemetry::exportHistograms() {
+    std::vector<nixlTelemetryHistogram> histograms;
+    {
+        const std::lock_guard lock(histogramsMutex_);
+        for (auto &set : histogramSets_) {
+            set->forEach([&](uint64_t size_bucket, histogramSet::entry &entry) {
+                auto xfer = entry.histograms.xfer.getSnapshot();
+                if (xfer.count() == entry.lastXfer.count()) {
+                    return;
+                }
+                auto post = entry.histograms.post.getSnapshot();
+
+                auto &histogram = histograms.emplace_back();
+                histogram.backend = set->backend();
+                histogram.op = nixlEnumStrings::xferOpStr(set->op());
+                histogram.sizeBucket = size_bucket;
+                histogram.remoteAgent = set->remoteAgent();
+                histogram.post = post;
+                histogram.post.subtract(entry.lastPost);
+                histogram.xfer = xfer;
+                histogram.xfer.subtract(entry.lastXfer);
+
+                entry.lastPost = post;
+                entry.lastXfer = xfer;
+            });
+        }
+    }
+
+    if (!histograms.empty()) {
+        exporter_->exportHistograms(histograms);
+    }
+}
+
+bool
+nixlTelemetry::sampleSpan() noexcept {
+    if (!spanRings_) {
+        return false;
+    }
+
+    // Counted per thread, sampling does not add contention between posting threads
+    thread_local uint64_t operations = 0;
+    return (operations++ % spanSampling_) == 0;
+}
+
+void
+nixlTelemetry::addSpan(nixl_telemetry_span_kind_t kind,
+                       chrono_point_t start,
+                       chrono_point_t end,
+                       const void *request,
+                       const std::string &backend) {
+    if (!spanRings_) {
+        return;
+    }
+
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    spanRings_->record({toSteadyNs(start),
+                        static_cast<uint64_t>(std::max<int64_t>(0, duration.count())),
+                        reinterpret_cast<uintptr_t>(request),
+                        getThreadId(),
+                        kind,
+                        backend});
+}
+
+void
+nixlTelemetry::exportSpans(const nixlTelemetryTimeBase &time_base) {
+    std::vector<nixlTelemetrySpan> spans;
+    spanRings_->drain([&spans, &time_base](const nixlTelemetrySpan &span) {
+        auto &exported = spans.emplace_back(span);
+        exported.startNs_ = time_base.toSystemNs(span.startNs_);
+    });
+
+    if (!spans.empty()) {
+        exporter_->exportSpans(spans);
+    }
+}
+
 void
 nixlTelemetry::registerPeriodicTask(periodicTask &task) {
     task.timer_.expires_after(task.interval_);
@@ -167,89 +484,78 @@ nixlTelemetry::registerPeriodicTask(periodicTask &task) {
 }
 
 void
-nixlTelemetry::updateData(const std::string &event_name,
-                          nixl_telemetry_category_t category,
-                          uint64_t value) {
-    // agent can be multi-threaded
-    std::lock_guard<std::mutex> lock(mutex_);
-    events_.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(
-                             std::chrono::system_clock::now().time_since_epoch())
-                             .count(),
-                         category,
-                         event_name,
-                         value);
+nixlTelemetry::addBackend(nixlBackendEngine *backend) {
+    std::lock_guard<std::mutex> lock(backendsMutex_);
+    backends_.push_back(backend);
+}
+
+void
+nixlTelemetry::updateData(nixl_telemetry_event_id_t id, uint64_t value, int32_t arg) {
+    // agent can be multi-threaded, every thread records to its own ring
+    if (rings_) {
+        rings_->record(static_cast<uint32_t>(id), value, arg);
+    }
 }
 
 // The next 4 methods might be removed, as addXferTime covers them.
 void
 nixlTelemetry::updateTxBytes(uint64_t tx_bytes) {
-    updateData("agent_tx_bytes", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, tx_bytes);
+    updateData(nixl_telemetry_event_id_t::AGENT_TX_BYTES, tx_bytes);
 }
 
 void
 nixlTelemetry::updateRxBytes(uint64_t rx_bytes) {
-    updateData("agent_rx_bytes", nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, rx_bytes);
+    updateData(nixl_telemetry_event_id_t::AGENT_RX_BYTES, rx_bytes);
 }
 
 void
 nixlTelemetry::updateTxRequestsNum(uint32_t tx_requests_num) {
-    updateData("agent_tx_requests_num",
-               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
-               tx_requests_num);
+    updateData(nixl_telemetry_event_id_t::AGENT_TX_REQUESTS_NUM, tx_requests_num);
 }
 
 void
 nixlTelemetry::updateRxRequestsNum(uint32_t rx_requests_num) {
-    updateData("agent_rx_requests_num",
-               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
-               rx_requests_num);
+    updateData(nixl_telemetry_event_id_t::AGENT_RX_REQUESTS_NUM, rx_requests_num);
 }
 
 void
 nixlTelemetry::updateErrorCount(nixl_status_t error_type) {
-    updateData(
-        nixlEnumStrings::statusStr(error_type), nixl_telemetry_category_t::NIXL_TELEMETRY_ERROR, 1);
+    updateData(nixl_telemetry_event_id_t::AGENT_ERROR, 1, error_type);
 }
 
 void
 nixlTelemetry::updateMemoryRegistered(uint64_t memory_registered) {
-    updateData("agent_memory_registered",
-               nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY,
-               memory_registered);
+    updateData(nixl_telemetry_event_id_t::AGENT_MEMORY_REGISTERED, memory_registered);
 }
 
 void
 nixlTelemetry::updateMemoryDeregistered(uint64_t memory_deregistered) {
-    updateData("agent_memory_deregistered",
-               nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY,
-               memory_deregistered);
+    updateData(nixl_telemetry_event_id_t::AGENT_MEMORY_DEREGISTERED, memory_deregistered);
 }
 
 void
 nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, uint64_t bytes) {
-    const char *bytes_name = is_write ? "agent_tx_bytes" : "agent_rx_bytes";
-    const char *requests_name = is_write ? "agent_tx_requests_num" : "agent_rx_requests_num";
-
-    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
-                          std::chrono::system_clock::now().time_since_epoch())
-                          .count();
-
-    const std::lock_guard lock(mutex_);
-    events_.emplace_back(time,
-                         nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
-                         "agent_xfer_time",
-                         xfer_time.count());
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_name, bytes);
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_name, 1);
+    if (!rings_) {
+        return;
+    }
+
+    const auto bytes_id = is_write ? nixl_telemetry_event_id_t::AGENT_TX_BYTES :
+                                     nixl_telemetry_event_id_t::AGENT_RX_BYTES;
+    const auto requests_id = is_write ? nixl_telemetry_event_id_t::AGENT_TX_REQUESTS_NUM :
+                                        nixl_telemetry_event_id_t::AGENT_RX_REQUESTS_NUM;
+    const uint64_t time = nixlTelemetryNowNs();
+
+    rings_->record({time,
+                    static_cast<uint64_t>(xfer_time.count()),
+                    static_cast<uint32_t>(nixl_telemetry_event_id_t::AGENT_XFER_TIME),
+                    0});
+    rings_->record({time, bytes, static_cast<uint32_t>(bytes_id), 0});
+    rings_->record({time, 1, static_cast<uint32_t>(requests_id), 0});
 }
 
 void
 nixlTelemetry::addPostTime(std::chrono::microseconds post_time) {
-    updateData("agent_xfer_post_time",
-               nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
-               post_time.count());
+    updateData(nixl_telemetry_event_id_t::AGENT_XFER_POST_TIME, post_time.count());
 }
 
 std::string
@@ -20,19 +20,26 @@
 #include "common/cyclic_buffer.h"
 #include "telemetry/telemetry_exporter.h"
 #include "telemetry_event.h"
+#include "telemetry_histogram.h"
+#include "telemetry_ring.h"
+#include "telemetry_span.h"
 #include "mem_section.h"
 #include "nixl_types.h"
 
 #include <string>
 #include <vector>
-#include <mutex>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <chrono>
 #include <functional>
 #include <atomic>
 
 #include <asio.hpp>
 
+class nixlBackendEngine;
+
 struct periodicTask {
     asio::steady_timer timer_;
     std::function<bool()> callback_;
@@ -48,6 +55,31 @@ struct periodicTask {
           enabled_(enabled) {}
 };
 
+/**
+ * @enum nixl_telemetry_event_id_t
+ * @brief Interned agent telemetry events, translated to their names when exported
+ */
+enum class nixl_telemetry_event_id_t : uint32_t {
+    AGENT_TX_BYTES,
+    AGENT_RX_BYTES,
+    AGENT_TX_REQUESTS_NUM,
+    AGENT_RX_REQUESTS_NUM,
+    AGENT_ERROR, // Named after the status passed as argument
+    AGENT_MEMORY_REGISTERED,
+    AGENT_MEMORY_DEREGISTERED,
+    AGENT_XFER_TIME,
+    AGENT_XFER_POST_TIME,
+};
+
+/**
+ * @struct nixlXferHistograms
+ * @brief Latency histograms of the transfers sharing the same telemetry key
+ */
+struct nixlXferHistograms {
+    nixlLatencyHistogram post;
+    nixlLatencyHistogram xfer;
+};
+
 class nixlTelemetry {
 public:
     explicit nixlTelemetry(const std::string &agent_name);
@@ -73,19 +105,99 @@ public:
     void
     addPostTime(std::chrono::microseconds post_time);
 
+    /**
+     * @brief Get the histograms of transfers with the given backend, operation, size range
+     *        and remote agent. Meant to be resolved when the transfer request is created,
+     *        the returned histograms remain valid for the lifetime of the telemetry.
+     *        Only the first transfer of a backend, operation and remote agent locks, later
+     *        ones find their histograms without locking nor allocating.
+     *        Returns nullptr when there is no exporter.
+     */
+    [[nodiscard]] nixlXferHistograms *
+    getXferHistograms(const std::string &backend,
+                      nixl_xfer_op_t op,
+                      size_t bytes,
+                      const std::string &remote_agent);
+
+    /**
+     * @brief Whether the next transfer request created by the calling thread is traced,
+     *        per the sampling period. Always false when the exporter does not export spans.
+     */
+    [[nodiscard]] bool
+    sampleSpan() noexcept;
+
+    void
+    addSpan(nixl_telemetry_span_kind_t kind,
+            chrono_point_t start,
+            chrono_point_t end,
+            const void *request,
+            const std::string &backend);
+
+    /**
+     * @brief Whether the events are exported. Backends only record their events when they
+     *        are, as nothing drains them otherwise.
+     */
+    [[nodiscard]] bool
+    isExporting() const noexcept {
+        return exporter_ != nullptr;
+    }
+
+    /**
+     * @brief Export the events recorded by the backend along with the agent events.
+     *        The backend must outlive the telemetry.
+     */
+    void
+    addBackend(nixlBackendEngine *backend);
+
 private:
+    // Histograms of a backend, operation and remote agent, per power of 2 size range
+    class histogramSet;
+
+    // Sets are looked up without locking in an insert-only open addressing table, they
+    // are added under histogramsMutex_ and only removed with the telemetry
+    static constexpr size_t histogramTableSize_ = 4096;
+
+    [[nodiscard]] static size_t
+    histogramHash(const std::string &backend,
+                  nixl_xfer_op_t op,
+                  const std::string &remote_agent) noexcept;
+    [[nodiscard]] histogramSet *
+    findHistogramSet(size_t hash,
+                     const std::string &backend,
+                     nixl_xfer_op_t op,
+                     const std::string &remote_agent) const noexcept;
+    [[nodiscard]] histogramSet *
+    addHistogramSet(size_t hash,
+                    const std::string &backend,
+                    nixl_xfer_op_t op,
+                    const std::string &remote_agent);
+
+    void
+    exportHistograms();
+    void
+    exportSpans(const nixlTelemetryTimeBase &time_base);
+
     void
     initializeTelemetry();
     void
     registerPeriodicTask(periodicTask &task);
     void
-    updateData(const std::string &event_name, nixl_telemetry_category_t category, uint64_t value);
+    updateData(nixl_telemetry_event_id_t id, uint64_t value, int32_t arg = 0);
     bool
     writeEventHelper();
     std::unique_ptr<nixlTelemetryExporter> exporter_;
     std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
-    std::vector<nixlTelemetryEvent> events_;
-    std::mutex mutex_;
+    // Only allocated when there is an exporter to drain the events
+    std::unique_ptr<nixlTelemetryRings<>> rings_;
+    // Only allocated when the exporter exports spans and tracing is not disabled
+    std::unique_ptr<nixlTelemetryRings<nixlTelemetrySpan>> spanRings_;
+    uint64_t spanSampling_ = 0;
+    std::unique_ptr<std::atomic<histogramSet *>[]> histogramTable_;
+    size_t histogramTableUsed_ = 0;
+    std::vector<std::unique_ptr<histogramSet>> histogramSets_;
+    std::mutex histogramsMutex_;
+    std::vector<nixlBackendEngine *> backends_;
+    std::mutex backendsMutex_;
     asio::thread_pool pool_;
     periodicTask writeTask_;
     std::string agentName_;
@@ -27,7 +27,7 @@
 constexpr char TELEMETRY_BUFFER_SIZE_VAR[] = "NIXL_TELEMETRY_BUFFER_SIZE";
 constexpr char TELEMETRY_RUN_INTERVAL_VAR[] = "NIXL_TELEMETRY_RUN_INTERVAL";
 
-constexpr inline int TELEMETRY_VERSION = 1;
+constexpr inline int TELEMETRY_VERSION = 2;
 constexpr inline size_t MAX_EVENT_NAME_LEN = 32;
 
 /**
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_TELEMETRY_TELEMETRY_HISTOGRAM_H
+#define NIXL_SRC_CORE_TELEMETRY_TELEMETRY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class nixlLatencyHistogram
+ * @brief Log-linear (HDR-style) histogram of latencies in nanoseconds. Every power of 2
+ *        range is split into subBuckets linear buckets, which bounds the relative error
+ *        to 1 / subBuckets. Recording is two relaxed atomic increments, without locking
+ *        nor allocation, and may be done concurrently by several threads.
+ */
+class nixlLatencyHistogram {
+public:
+    static constexpr unsigned subBucketBits = 4;
+    static constexpr uint64_t subBuckets = 1 << subBucketBits;
+    // Values from 2^maxValueBits ns (~18 minutes) are counted in the last bucket
+    static constexpr unsigned maxValueBits = 40;
+    static constexpr size_t numBuckets = (maxValueBits - subBucketBits + 1) * subBuckets;
+
+    /**
+     * @class snapshot
+     * @brief Copy of the histogram counts, which can be merged with or subtracted from
+     *        other snapshots, and queried for percentiles.
+     */
+    class snapshot {
+    public:
+        void
+        merge(const snapshot &other) noexcept {
+            for (size_t i = 0; i < numBuckets; ++i) {
+                counts_[i] += other.counts_[i];
+            }
+            count_ += other.count_;
+            sum_ += other.sum_;
+        }
+
+        // Keeps the samples recorded after the other snapshot of the same histogram
+        void
+        subtract(const snapshot &other) noexcept {
+            for (size_t i = 0; i < numBuckets; ++i) {
+                counts_[i] -= other.counts_[i];
+            }
+            count_ -= other.count_;
+            sum_ -= other.sum_;
+        }
+
+        [[nodiscard]] uint64_t
+        count() const noexcept {
+            return count_;
+        }
+
+        [[nodiscard]] uint64_t
+        sum() const noexcept {
+            return sum_;
+        }
+
+        [[nodiscard]] uint64_t
+        bucketCount(size_t idx) const noexcept {
+            return counts_[idx];
+        }
+
+        // Upper bound of the bucket of the sample at quantile q (0 <= q <= 1)
+        [[nodiscard]] uint64_t
+        percentile(double q) const noexcept {
+            if (count_ == 0) {
+                return 0;
+            }
+
+            const uint64_t rank =
+                std::max<uint64_t>(1, static_cast<uint64_t>(q * count_ + 0.5));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < numBuckets; ++i) {
+                seen += counts_[i];
+                if (seen >= rank) {
+                    return bucketUpperBound(i);
+                }
+            }
+            return bucketUpperBound(numBuckets - 1);
+        }
+
+        [[nodiscard]] uint64_t
+        max() const noexcept {
+            return percentile(1.0);
+        }
+
+    private:
+        friend class nixlLatencyHistogram;
+
+        std::array<uint64_t, numBuckets> counts_{};
+        uint64_t count_ = 0;
+        uint64_t sum_ = 0;
+    };
+
+    void
+    record(uint64_t value_ns) noexcept {
+        counts_[bucketIndex(value_ns)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value_ns, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] snapshot
+    getSnapshot() const noexcept {
+        snapshot snap;
+        for (size_t i = 0; i < numBuckets; ++i) {
+            snap.counts_[i] = counts_[i].load(std::memory_order_relaxed);
+            snap.count_ += snap.counts_[i];
+        }
+        snap.sum_ = sum_.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+    [[nodiscard]] static size_t
+    bucketIndex(uint64_t value) noexcept {
+        if (value < subBuckets) {
+            return value;
+        }
+
+        const unsigned msb = 63 - __builtin_clzll(value);
+        const unsigned shift = msb - subBucketBits;
+        const size_t idx = (shift + 1) * subBuckets + ((value >> shift) - subBuckets);
+        return std::min(idx, numBuckets - 1);
+    }
+
+    [[nodiscard]] static uint64_t
+    bucketLowerBound(size_t idx) noexcept {
+        if (idx < subBuckets) {
+            return idx;
+        }
+
+        const unsigned shift = idx / subBuckets - 1;
+        return (idx % subBuckets + subBuckets) << shift;
+    }
+
+    // Exclusive upper bound
+    [[nodiscard]] static uint64_t
+    bucketUpperBound(size_t idx) noexcept {
+        const unsigned shift = (idx < 2 * subBuckets) ? 0 : idx / subBuckets - 1;
+        return bucketLowerBound(idx) + (uint64_t(1) << shift);
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, numBuckets> counts_{};
+    std::atomic<uint64_t> sum_{0};
+};
+
+/**
+ * @struct nixlTelemetryHistogram
+ * @brief Latency samples of the transfers sharing the same backend, operation, size
+ *        range and remote agent, recorded since the previous export.
+ */
+struct nixlTelemetryHistogram {
+    std::string backend;
+    std::string op;
+    uint64_t sizeBucket; // Lower bound of the power of 2 range of the transfer sizes in bytes
+    std::string remoteAgent;
+    nixlLatencyHistogram::snapshot post; // Start to posting to the backend
+    nixlLatencyHistogram::snapshot xfer; // Start to completion
+
+    [[nodiscard]] static uint64_t
+    getSizeBucket(uint64_t bytes) noexcept {
+        return bytes ? (uint64_t(1) << (63 - __builtin_clzll(bytes))) : 0;
+    }
+
+    // Short size label, e.g. "512", "4K" or "16M"
+    [[nodiscard]] static std::string
+    sizeLabel(uint64_t size_bucket) {
+        static constexpr std::array<const char *, 5> units = {"", "K", "M", "G", "T"};
+        size_t unit = 0;
+        while (size_bucket >= 1024 && unit < units.size() - 1) {
+            size_bucket /= 1024;
+            ++unit;
+        }
+        return std::to_string(size_bucket) + units[unit];
+    }
+};
+
+#endif
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_TELEMETRY_TELEMETRY_RING_H
+#define NIXL_SRC_CORE_TELEMETRY_TELEMETRY_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @struct nixlTelemetryRecord
+ * @brief Fixed-size binary telemetry event, as recorded on the data path. The event id is
+ *        interned by the recorder, which translates it to a name when the record is drained.
+ */
+struct nixlTelemetryRecord {
+    uint64_t timestampNs_; // Steady clock, see nixlTelemetryTimeBase
+    uint64_t value_;
+    uint32_t id_;
+    int32_t arg_; // Event specific argument, e.g. the status of an error event
+};
+
+[[nodiscard]] inline uint64_t
+nixlTelemetryNowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @class nixlTelemetryTimeBase
+ * @brief Translates record timestamps to the system clock microseconds of exported events.
+ */
+class nixlTelemetryTimeBase {
+public:
+    nixlTelemetryTimeBase() noexcept
+        : steadyNs_(nixlTelemetryNowNs()),
+          systemUs_(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count()) {}
+
+    [[nodiscard]] uint64_t
+    toSystemUs(uint64_t steady_ns) const noexcept {
+        return systemUs_ + (static_cast<int64_t>(steady_ns - steadyNs_) / 1000);
+    }
+
+    [[nodiscard]] uint64_t
+    toSystemNs(uint64_t steady_ns) const noexcept {
+        return systemUs_ * 1000 + static_cast<int64_t>(steady_ns - steadyNs_);
+    }
+
+private:
+    const uint64_t steadyNs_;
+    const uint64_t systemUs_;
+};
+
+/**
+ * @class nixlTelemetryRing
+ * @brief Single producer, single consumer ring of fixed-size telemetry records. Records
+ *        are dropped when the ring is full.
+ */
+template<typename Record = nixlTelemetryRecord> class nixlTelemetryRing {
+public:
+    nixlTelemetryRing(const void *owner, size_t capacity)
+        : owner_(owner),
+          mask_(roundUpPow2(capacity) - 1),
+          records_(mask_ + 1) {}
+
+    nixlTelemetryRing(const nixlTelemetryRing &) = delete;
+    nixlTelemetryRing &
+    operator=(const nixlTelemetryRing &) = delete;
+
+    // Producer side
+    bool
+    push(const Record &record) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ > mask_) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ > mask_) {
+                dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                               std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        records_[tail & mask_] = record;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns the number of drained records
+    template<typename Fn>
+    size_t
+    drain(Fn &&fn) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        for (size_t pos = head; pos != tail; ++pos) {
+            fn(records_[pos & mask_]);
+        }
+        head_.store(tail, std::memory_order_release);
+        return tail - head;
+    }
+
+    [[nodiscard]] bool
+    empty() const noexcept {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] size_t
+    dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const void *
+    owner() const noexcept {
+        return owner_;
+    }
+
+    [[nodiscard]] bool
+    detached() const noexcept {
+        return detached_.load(std::memory_order_relaxed);
+    }
+
+    void
+    detach() noexcept {
+        detached_.store(true, std::memory_order_relaxed);
+    }
+
+private:
+    [[nodiscard]] static size_t
+    roundUpPow2(size_t value) noexcept {
+        size_t pow2 = 1;
+        while (pow2 < value) {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+
+    const void *const owner_;
+    const size_t mask_;
+    std::vector<Record> records_;
+    std::atomic<bool> detached_{false};
+
+    // Producer and consumer positions live on separate cache lines
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t headCache_ = 0;
+    std::atomic<size_t> dropped_{0};
+    alignas(64) std::atomic<size_t> head_{0};
+};
+
+/**
+ * @class nixlTelemetryRings
+ * @brief Telemetry records of all the threads of a recorder. Every recording thread gets
+ *        its own ring on its first record, later records only touch that ring. The rings
+ *        are drained by a single consumer.
+ */
+template<typename Record = nixlTelemetryRecord> class nixlTelemetryRings {
+public:
+    explicit nixlTelemetryRings(size_t ring_capacity) : ringCapacity_(ring_capacity) {}
+
+    ~nixlTelemetryRings() {
+        // Threads keep a reference to their ring, it must not be matched with a later
+        // recorder allocated at the same address
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &ring : rings_) {
+            ring->detach();
+        }
+    }
+
+    nixlTelemetryRings(const nixlTelemetryRings &) = delete;
+    nixlTelemetryRings &
+    operator=(const nixlTelemetryRings &) = delete;
+
+    void
+    record(const Record &record) {
+        getRing().push(record);
+    }
+
+    void
+    record(uint32_t id, uint64_t value, int32_t arg = 0) {
+        record({nixlTelemetryNowNs(), value, id, arg});
+    }
+
+    // Records are drained in order per thread, there is no order between threads
+    template<typename Fn>
+    size_t
+    drain(Fn &&fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t drained = 0;
+        for (auto &ring : rings_) {
+            drained += ring->drain(fn);
+        }
+
+        // Rings of exited threads are only referenced here, release them once empty
+        rings_.erase(std::remove_if(rings_.begin(),
+                                    rings_.end(),
+                                    [this](const std::shared_ptr<ring_t> &ring) {
+                                        if (ring.use_count() > 1 || !ring->empty()) {
+                                            return false;
+                                        }
+                                        droppedReleased_ += ring->dropped();
+                                        return true;
+                                    }),
+                     rings_.end());
+        return drained;
+    }
+
+    [[nodiscard]] size_t
+    dropped() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t dropped = droppedReleased_;
+        for (const auto &ring : rings_) {
+            dropped += ring->dropped();
+        }
+        return dropped;
+    }
+
+private:
+    using ring_t = nixlTelemetryRing<Record>;
+
+    ring_t &
+    getRing() {
+        thread_local std::vector<std::shared_ptr<ring_t>> thread_rings;
+        for (const auto &ring : thread_rings) {
+            if (ring->owner() == this && !ring->detached()) {
+                return *ring;
+            }
+        }
+
+        // First record of this thread, also forget the rings of destroyed recorders
+        thread_rings.erase(std::remove_if(thread_rings.begin(),
+                                          thread_rings.end(),
+                                          [](const std::shared_ptr<ring_t> &ring) {
+                                              return ring->detached();
+                                          }),
+                           thread_rings.end());
+
+        auto ring = std::make_shared<ring_t>(this, ringCapacity_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            rings_.push_back(ring);
+        }
+        thread_rings.push_back(ring);
+        return *ring;
+    }
+
+    const size_t ringCapacity_;
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ring_t>> rings_;
+    size_t droppedReleased_ = 0;
+};
+
+#endif
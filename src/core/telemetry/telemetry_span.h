@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_TELEMETRY_TELEMETRY_SPAN_H
+#define NIXL_SRC_CORE_TELEMETRY_TELEMETRY_SPAN_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Trace one in every N transfer request operations of a thread, 0 disables tracing
+constexpr char TELEMETRY_TRACE_SAMPLING_VAR[] = "NIXL_TELEMETRY_TRACE_SAMPLING";
+
+constexpr inline size_t MAX_SPAN_BACKEND_LEN = 16;
+
+/**
+ * @enum nixl_telemetry_span_kind_t
+ * @brief Steps of the lifetime of a transfer request which are traced as spans
+ */
+enum class nixl_telemetry_span_kind_t : uint32_t {
+    CREATE_XFER_REQ = 0, // createXferReq or makeXferReq
+    POST_XFER_REQ = 1, // postXferReq, including the backend post
+    BACKEND_POST = 2, // postXfer of the backend
+    XFER = 3, // Start of the post to the completion of the data transfer
+    NOTIF = 4, // Completion of the data transfer to the delivery of the notification
+};
+
+/**
+ * @struct nixlTelemetrySpan
+ * @brief A fixed-size span of a transfer request. Spans of the same request share its id,
+ *        spans are recorded by the thread which observed their end.
+ */
+struct nixlTelemetrySpan {
+    uint64_t startNs_; // Steady clock when recorded, system clock when exported
+    uint64_t durationNs_;
+    uint64_t requestId_;
+    uint32_t threadId_;
+    nixl_telemetry_span_kind_t kind_;
+    char backend_[MAX_SPAN_BACKEND_LEN];
+
+    nixlTelemetrySpan() noexcept = default;
+
+    nixlTelemetrySpan(uint64_t start_ns,
+                      uint64_t duration_ns,
+                      uint64_t request_id,
+                      uint32_t thread_id,
+                      nixl_telemetry_span_kind_t kind,
+                      const std::string &backend) noexcept
+        : startNs_(start_ns),
+          durationNs_(duration_ns),
+          requestId_(request_id),
+          threadId_(thread_id),
+          kind_(kind) {
+        strncpy(backend_, backend.c_str(), MAX_SPAN_BACKEND_LEN - 1);
+        backend_[MAX_SPAN_BACKEND_LEN - 1] = '\0';
+    }
+};
+
+namespace nixlEnumStrings {
+[[nodiscard]] inline const char *
+telemetrySpanKindStr(nixl_telemetry_span_kind_t kind) {
+    switch (kind) {
+    case nixl_telemetry_span_kind_t::CREATE_XFER_REQ:
+        return "createXferReq";
+    case nixl_telemetry_span_kind_t::POST_XFER_REQ:
+        return "postXferReq";
+    case nixl_telemetry_span_kind_t::BACKEND_POST:
+        return "backendPost";
+    case nixl_telemetry_span_kind_t::XFER:
+        return "xfer";
+    case nixl_telemetry_span_kind_t::NOTIF:
+        return "notif";
+    }
+    return "BAD_SPAN";
+}
+} // namespace nixlEnumStrings
+
+#endif
@@ -26,6 +26,8 @@
 #include "backend_engine.h"
 #include "telemetry.h"
 
+class nixlXferPipeline;
+
 enum nixl_telemetry_stat_status_t {
     NIXL_TELEMETRY_POST = 0,
     NIXL_TELEMETRY_POST_AND_FINISH = 1,
@@ -39,26 +41,43 @@ public:
     nixlXferReqH(const std::string &remote_agent,
                  const nixl_xfer_op_t backend_op,
                  const nixl_mem_t local_type,
-                 const nixl_mem_t remote_type,
-                 const size_t desc_count = 0);
+                 const nixl_mem_t remote_type);
 
-    ~nixlXferReqH() {
-        if ((backendHandle != nullptr) && (engine != nullptr)) {
-            engine->releaseReqH(backendHandle);
-        }
-    }
+    ~nixlXferReqH();
 
     void
     updateRequestStats(nixlTelemetry *telemetry, nixl_telemetry_stat_status_t stat_status);
 
+    // Backend of the request in telemetry, "PIPELINE" for multi-hop pipelines
+    [[nodiscard]] const std::string &
+    getBackendName() const;
+
     friend class nixlAgent;
 
 private:
+    // Selects the descriptors for the backend and sizes them to desc_count
+    void
+    initDescs(nixlBackendEngine *backend, size_t desc_count);
+
+    int
+    descCount() const;
+
+    nixl_status_t
+    prepBackendXfer(const nixl_opt_b_args_t *opt_args);
+
+    nixl_status_t
+    postBackendXfer(const nixl_opt_b_args_t *opt_args);
+
     nixlBackendEngine *engine = nullptr;
     nixlBackendReqH *backendHandle = nullptr;
 
-    const std::unique_ptr<nixl_meta_dlist_t> initiatorDescs;
-    const std::unique_ptr<nixl_meta_dlist_t> targetDescs;
+    // Descriptors of the request, inline for the backends which support descriptor spans,
+    // in descriptor lists otherwise
+    bool spans = false;
+    nixlMetaDescBuf initiatorBuf;
+    nixlMetaDescBuf targetBuf;
+    std::unique_ptr<nixl_meta_dlist_t> initiatorDescs;
+    std::unique_ptr<nixl_meta_dlist_t> targetDescs;
 
     const std::string remoteAgent;
     nixl_blob_t notifMsg;
@@ -68,6 +87,14 @@ private:
     nixl_status_t status = NIXL_ERR_NOT_POSTED;
 
     nixl_xfer_telem_t telemetry;
+    // Resolved at creation when telemetry is exported, recorded on completion
+    nixlXferHistograms *histograms = nullptr;
+    std::chrono::steady_clock::duration postElapsed{};
+    // Whether the spans of the request are traced, sampled once at its creation
+    bool traced = false;
+
+    // Set for the requests of multi-hop pipelines, which have no backend of their own
+    std::unique_ptr<nixlXferPipeline> pipeline;
 };
 
 struct nixlDlistH {
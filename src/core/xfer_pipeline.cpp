@@ -0,0 +1,332 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "xfer_pipeline.h"
+
+#include <algorithm>
+
+#include "common/nixl_log.h"
+
+nixlXferPipeline::nixlXferPipeline(const nixlAgent &agent,
+                                   const std::string &local_agent,
+                                   const nixl_xfer_dlist_t &src_descs,
+                                   const std::string &src_agent,
+                                   const nixl_xfer_dlist_t &dst_descs,
+                                   const std::string &dst_agent,
+                                   const nixlPipelineConfig &cfg)
+    : agent_(agent),
+      localAgent_(local_agent),
+      srcAgent_(src_agent),
+      dstAgent_(dst_agent),
+      srcType_(src_descs.getType()),
+      dstType_(dst_descs.getType()),
+      stages_(cfg.bounceStages),
+      hopBackends_(cfg.hopBackends) {
+    // Pieces never cross a chunk, and chunks gather consecutive descriptors
+    size_t fill = 0;
+    for (int i = 0; i < src_descs.descCount(); ++i) {
+        const nixlBasicDesc &src = src_descs[i];
+        const nixlBasicDesc &dst = dst_descs[i];
+        for (size_t offset = 0; offset < src.len;) {
+            if (chunks_.empty() || (fill == cfg.chunkSize)) {
+                chunks_.push_back({pieces_.size(), pieces_.size(), 0, -1, -1});
+                fill = 0;
+            }
+            const size_t len = std::min(src.len - offset, cfg.chunkSize - fill);
+            pieces_.push_back(
+                {src.addr + offset, src.devId, dst.addr + offset, dst.devId, len, fill});
+            chunks_.back().last = pieces_.size();
+            chunks_.back().len += len;
+            fill += len;
+            offset += len;
+        }
+        totalBytes_ += src.len;
+    }
+}
+
+nixl_status_t
+nixlXferPipeline::create(const nixlAgent &agent,
+                         const std::string &local_agent,
+                         const nixl_xfer_dlist_t &src_descs,
+                         const std::string &src_agent,
+                         const nixl_xfer_dlist_t &dst_descs,
+                         const std::string &dst_agent,
+                         const nixlPipelineConfig &cfg,
+                         std::unique_ptr<nixlXferPipeline> &pipeline) {
+    if (cfg.bounceStages.empty()) {
+        NIXL_ERROR_FUNC << "a pipeline needs at least one stage of bounce buffers";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (!cfg.hopBackends.empty() && (cfg.hopBackends.size() != cfg.bounceStages.size() + 1)) {
+        NIXL_ERROR_FUNC << "expected " << cfg.bounceStages.size() + 1
+                        << " hop backends, got " << cfg.hopBackends.size();
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (cfg.chunkSize == 0) {
+        NIXL_ERROR_FUNC << "chunk size of the pipeline is 0";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    for (size_t k = 0; k < cfg.bounceStages.size(); ++k) {
+        const auto &stage = cfg.bounceStages[k];
+        if (stage.descCount() == 0) {
+            NIXL_ERROR_FUNC << "stage " << k << " of the pipeline has no bounce buffer";
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        for (int i = 0; i < stage.descCount(); ++i) {
+            if (stage[i].len < cfg.chunkSize) {
+                NIXL_ERROR_FUNC << "bounce buffer " << i << " of stage " << k << " has "
+                                << stage[i].len << " bytes, less than the chunk size "
+                                << cfg.chunkSize;
+                return NIXL_ERR_INVALID_PARAM;
+            }
+        }
+    }
+
+    if (src_descs.descCount() != dst_descs.descCount()) {
+        NIXL_ERROR_FUNC << "different descriptor list sizes (src=" << src_descs.descCount()
+                        << ", dst=" << dst_descs.descCount() << ")";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    for (int i = 0; i < src_descs.descCount(); ++i) {
+        if (src_descs[i].len != dst_descs[i].len) {
+            NIXL_ERROR_FUNC << "length mismatch at index " << i;
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    pipeline.reset(new nixlXferPipeline(
+        agent, local_agent, src_descs, src_agent, dst_descs, dst_agent, cfg));
+    return NIXL_SUCCESS;
+}
+
+nixlXferPipeline::~nixlXferPipeline() {
+    if (release() != NIXL_SUCCESS) {
+        NIXL_ERROR << "Failed to release the hops in flight of a pipeline";
+    }
+}
+
+nixl_status_t
+nixlXferPipeline::post(const std::optional<nixl_blob_t> &notif) {
+    if (status_ == NIXL_IN_PROG) {
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    notif_ = notif;
+    nextChunk_ = 0;
+    doneChunks_ = 0;
+    freeSlots_.resize(stages_.size());
+    for (size_t k = 0; k < stages_.size(); ++k) {
+        freeSlots_[k].resize(stages_[k].descCount());
+        // Taken from the back, so that the first buffers are used first
+        for (int i = 0; i < stages_[k].descCount(); ++i) {
+            freeSlots_[k][i] = stages_[k].descCount() - 1 - i;
+        }
+    }
+    waiting_.assign(hopCount(), {});
+    for (auto &ch : chunks_) {
+        ch.srcSlot = -1;
+        ch.dstSlot = -1;
+    }
+
+    status_ = NIXL_IN_PROG;
+    return progress();
+}
+
+nixl_status_t
+nixlXferPipeline::progress() {
+    if (status_ != NIXL_IN_PROG) {
+        return status_;
+    }
+
+    // Hops which complete within their post let the next ones start right away
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        for (size_t i = 0; i < active_.size();) {
+            const nixl_status_t ret = agent_.getXferStatus(active_[i].req);
+            if (ret == NIXL_IN_PROG) {
+                ++i;
+                continue;
+            }
+
+            // A hop which cannot be released stays active, for release() to retry
+            const hop done = active_[i];
+            const nixl_status_t release_ret = agent_.releaseXferReq(done.req);
+            if (release_ret != NIXL_SUCCESS) {
+                return fail(release_ret);
+            }
+            active_[i] = active_.back();
+            active_.pop_back();
+            if (ret != NIXL_SUCCESS) {
+                return fail(ret);
+            }
+            finishHop(done.chunk, done.index);
+            moved = true;
+        }
+
+        // Hops closer to the destination go first, they free the buffers the others need
+        for (size_t h = hopCount(); h-- > 0;) {
+            for (;;) {
+                const bool first = (h == 0);
+                if (first ? (nextChunk_ == chunks_.size()) : waiting_[h].empty()) {
+                    break;
+                }
+                if ((h < stages_.size()) && freeSlots_[h].empty()) {
+                    break;
+                }
+
+                size_t chunk_index;
+                if (first) {
+                    chunk_index = nextChunk_++;
+                } else {
+                    chunk_index = waiting_[h].front();
+                    waiting_[h].pop_front();
+                }
+
+                const nixl_status_t ret = startHop(chunk_index, h);
+                if (ret != NIXL_SUCCESS) {
+                    return fail(ret);
+                }
+                moved = true;
+            }
+        }
+    }
+
+    if (doneChunks_ < chunks_.size()) {
+        return status_;
+    }
+
+    // All the data reached the destination, the notification can follow
+    status_ = NIXL_SUCCESS;
+    if (notif_) {
+        nixl_opt_args_t extra_params;
+        if (!hopBackends_.empty() && hopBackends_.back()) {
+            extra_params.backends.push_back(hopBackends_.back());
+        }
+        status_ = agent_.genNotif(dstAgent_, *notif_, &extra_params);
+    }
+    return status_;
+}
+
+nixl_status_t
+nixlXferPipeline::startHop(size_t chunk_index, size_t hop_index) {
+    chunk &ch = chunks_[chunk_index];
+    if (hop_index < stages_.size()) {
+        ch.dstSlot = freeSlots_[hop_index].back();
+        freeSlots_[hop_index].pop_back();
+    }
+
+    // Data is read from the source into the first stage, and written from a stage to the next
+    // one, so that the bounce buffer is always the local side of the transfer
+    const bool first = (hop_index == 0);
+    const bool last = (hop_index == stages_.size());
+    const nixl_xfer_dlist_t &local_stage = stages_[first ? 0 : hop_index - 1];
+    const nixlBasicDesc &local_buf = local_stage[first ? ch.dstSlot : ch.srcSlot];
+    nixl_xfer_dlist_t local_descs(local_stage.getType());
+    nixl_xfer_dlist_t remote_descs(first ? srcType_ :
+                                   last  ? dstType_ :
+                                           stages_[hop_index].getType());
+
+    if (first || last) {
+        for (size_t i = ch.first; i < ch.last; ++i) {
+            const piece &p = pieces_[i];
+            local_descs.addDesc(nixlBasicDesc(local_buf.addr + p.offset, p.len, local_buf.devId));
+            remote_descs.addDesc(first ? nixlBasicDesc(p.src, p.len, p.srcDev) :
+                                         nixlBasicDesc(p.dst, p.len, p.dstDev));
+        }
+    } else {
+        const nixlBasicDesc &remote_buf = stages_[hop_index][ch.dstSlot];
+        local_descs.addDesc(nixlBasicDesc(local_buf.addr, ch.len, local_buf.devId));
+        remote_descs.addDesc(nixlBasicDesc(remote_buf.addr, ch.len, remote_buf.devId));
+    }
+
+    nixl_opt_args_t extra_params;
+    if (!hopBackends_.empty() && hopBackends_[hop_index]) {
+        extra_params.backends.push_back(hopBackends_[hop_index]);
+    }
+
+    nixlXferReqH *req = nullptr;
+    nixl_status_t ret = agent_.createXferReq(first ? NIXL_READ : NIXL_WRITE,
+                                             local_descs,
+                                             remote_descs,
+                                             first ? srcAgent_ :
+                                             last  ? dstAgent_ :
+                                                     localAgent_,
+                                             req,
+                                             &extra_params);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to create hop " << hop_index << " of chunk " << chunk_index;
+        return ret;
+    }
+
+    ret = agent_.postXferReq(req);
+    if (ret < 0) {
+        NIXL_ERROR_FUNC << "failed to post hop " << hop_index << " of chunk " << chunk_index;
+        if (agent_.releaseXferReq(req) != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "failed to release hop " << hop_index << " of chunk "
+                            << chunk_index;
+        }
+        return ret;
+    }
+
+    active_.push_back({chunk_index, hop_index, req});
+    return NIXL_SUCCESS;
+}
+
+void
+nixlXferPipeline::finishHop(size_t chunk_index, size_t hop_index) {
+    chunk &ch = chunks_[chunk_index];
+    if (hop_index > 0) {
+        freeSlots_[hop_index - 1].push_back(ch.srcSlot);
+    }
+    ch.srcSlot = ch.dstSlot;
+    ch.dstSlot = -1;
+
+    if (hop_index + 1 == hopCount()) {
+        ++doneChunks_;
+    } else {
+        waiting_[hop_index + 1].push_back(chunk_index);
+    }
+}
+
+nixl_status_t
+nixlXferPipeline::fail(nixl_status_t status) {
+    status_ = status;
+    if (release() != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to release the hops in flight of a failed pipeline";
+    }
+    return status;
+}
+
+nixl_status_t
+nixlXferPipeline::release() {
+    // The hops which cannot be released are kept, so that a later call retries them
+    nixl_status_t ret = NIXL_SUCCESS;
+    for (auto it = active_.begin(); it != active_.end();) {
+        const nixl_status_t release_ret = agent_.releaseXferReq(it->req);
+        if (release_ret != NIXL_SUCCESS) {
+            ret = release_ret;
+            ++it;
+        } else {
+            it = active_.erase(it);
+        }
+    }
+    return ret;
+}
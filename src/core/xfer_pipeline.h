@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_XFER_PIPELINE_H
+#define NIXL_SRC_CORE_XFER_PIPELINE_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+
+/**
+ * @class nixlXferPipeline
+ * @brief A transfer cut into chunks which move through stages of local bounce buffers. Every
+ *        hop of a chunk is an ordinary transfer request of the agent, created once the bounce
+ *        buffer it writes to is free, so that up to one chunk per bounce buffer is in flight.
+ *        The pipeline only advances when it is progressed, which getXferStatus does.
+ */
+class nixlXferPipeline {
+public:
+    // Validates the configuration and cuts the transfer into chunks
+    [[nodiscard]] static nixl_status_t
+    create(const nixlAgent &agent,
+           const std::string &local_agent,
+           const nixl_xfer_dlist_t &src_descs,
+           const std::string &src_agent,
+           const nixl_xfer_dlist_t &dst_descs,
+           const std::string &dst_agent,
+           const nixlPipelineConfig &cfg,
+           std::unique_ptr<nixlXferPipeline> &pipeline);
+
+    ~nixlXferPipeline();
+
+    nixlXferPipeline(const nixlXferPipeline &) = delete;
+    nixlXferPipeline &
+    operator=(const nixlXferPipeline &) = delete;
+
+    // Starts the transfer of all the chunks, a notification is sent to the destination agent
+    // on completion when set
+    [[nodiscard]] nixl_status_t
+    post(const std::optional<nixl_blob_t> &notif);
+
+    // Completes the hops which are done and starts the following ones
+    [[nodiscard]] nixl_status_t
+    progress();
+
+    // Releases the hops in flight, which cancels them when their backends allow it. The hops
+    // which could not be released are kept, and retried by the next call
+    [[nodiscard]] nixl_status_t
+    release();
+
+    [[nodiscard]] const std::string &
+    getDstAgent() const noexcept {
+        return dstAgent_;
+    }
+
+    [[nodiscard]] size_t
+    getChunkCount() const noexcept {
+        return chunks_.size();
+    }
+
+    [[nodiscard]] size_t
+    getTotalBytes() const noexcept {
+        return totalBytes_;
+    }
+
+private:
+    // A contiguous part of a descriptor, at an offset of the bounce buffers of its chunk
+    struct piece {
+        uintptr_t src;
+        uint64_t srcDev;
+        uintptr_t dst;
+        uint64_t dstDev;
+        size_t len;
+        size_t offset;
+    };
+
+    struct chunk {
+        size_t first; // Pieces [first, last)
+        size_t last;
+        size_t len;
+        int srcSlot; // Bounce buffer holding the data, in the stage before the current hop
+        int dstSlot; // Bounce buffer written by the current hop
+    };
+
+    struct hop {
+        size_t chunk;
+        size_t index;
+        nixlXferReqH *req;
+    };
+
+    nixlXferPipeline(const nixlAgent &agent,
+                     const std::string &local_agent,
+                     const nixl_xfer_dlist_t &src_descs,
+                     const std::string &src_agent,
+                     const nixl_xfer_dlist_t &dst_descs,
+                     const std::string &dst_agent,
+                     const nixlPipelineConfig &cfg);
+
+    [[nodiscard]] size_t
+    hopCount() const noexcept {
+        return stages_.size() + 1;
+    }
+
+    [[nodiscard]] nixl_status_t
+    startHop(size_t chunk_index, size_t hop_index);
+
+    void
+    finishHop(size_t chunk_index, size_t hop_index);
+
+    [[nodiscard]] nixl_status_t
+    fail(nixl_status_t status);
+
+    const nixlAgent &agent_;
+    const std::string localAgent_;
+    const std::string srcAgent_;
+    const std::string dstAgent_;
+    const nixl_mem_t srcType_;
+    const nixl_mem_t dstType_;
+    const std::vector<nixl_xfer_dlist_t> stages_;
+    const std::vector<nixlBackendH *> hopBackends_;
+
+    std::vector<piece> pieces_;
+    std::vector<chunk> chunks_;
+    size_t totalBytes_ = 0;
+
+    // State of the current post
+    nixl_status_t status_ = NIXL_ERR_NOT_POSTED;
+    std::optional<nixl_blob_t> notif_;
+    size_t nextChunk_ = 0;
+    size_t doneChunks_ = 0;
+    std::vector<std::vector<int>> freeSlots_; // Free bounce buffers of every stage
+    std::vector<std::deque<size_t>> waiting_; // Chunks ready for every hop
+    std::vector<hop> active_;
+};
+
+#endif
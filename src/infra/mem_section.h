@@ -76,6 +76,11 @@ public:
     void
     addDesc(const nixlSectionDesc &desc) override;
 
+    // Merges a batch of sorted descriptors in a single pass, instead of an insertion per element.
+    // Returns how many of them overlap, without being equal to, a neighbour at their position.
+    size_t
+    addSortedDescs(std::vector<nixlSectionDesc> &&sorted);
+
     bool
     verifySorted() const;
 
@@ -113,6 +118,12 @@ class nixlMemSection {
         [[nodiscard]] nixlSecDescList &
         emplace(nixl_mem_t nixl_mem, nixlBackendEngine *backend);
 
+        template<typename desc_list_t>
+        nixl_status_t
+        populateDescs(const nixl_xfer_dlist_t &query,
+                      nixlBackendEngine *backend,
+                      desc_list_t &resp) const;
+
     public:
         nixlMemSection() = default;
 
@@ -125,6 +136,12 @@ class nixlMemSection {
                                 nixlBackendEngine* backend,
                                 nixl_meta_dlist_t &resp) const;
 
+        // Same as above, for the backends which support descriptor spans
+        nixl_status_t
+        populate(const nixl_xfer_dlist_t &query,
+                 nixlBackendEngine *backend,
+                 nixlMetaDescBuf &resp) const;
+
         [[nodiscard]] nixl_status_t
         addElement(const nixlRemoteDesc &query,
                    nixlBackendEngine *backend,
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <functional>
 #include <stdexcept>
+#include <iterator>
 #include <iostream>
 #include "nixl.h"
 #include "nixl_descriptors.h"
@@ -359,6 +360,47 @@ nixlSecDescList::addDesc(const nixlSectionDesc &desc) {
         vec.insert(itr, desc);
 }
 
+size_t
+nixlSecDescList::addSortedDescs(std::vector<nixlSectionDesc> &&sorted) {
+    assert(std::is_sorted(sorted.begin(), sorted.end()));
+    auto &vec = this->descs;
+    if (sorted.empty()) return 0;
+
+    // Check the neighbours at the insertion point, among the current and the new elements
+    const auto overlaps = [](const nixlBasicDesc &lhs, const nixlBasicDesc &rhs) {
+        return lhs.overlaps(rhs) && !(lhs == rhs);
+    };
+    size_t overlapping = 0;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const nixlBasicDesc &desc = sorted[i];
+        const auto itr = std::lower_bound(vec.begin(), vec.end(), sorted[i]);
+        if ((i > 0 && overlaps(sorted[i - 1], desc)) ||
+            (itr != vec.end() && overlaps(*itr, desc)) ||
+            (itr != vec.begin() && overlaps(*std::prev(itr), desc))) {
+            ++overlapping;
+        }
+    }
+
+    // Batches of a new section, or above all the current elements, are appended
+    if (vec.empty() || !(sorted.front() < vec.back())) {
+        vec.insert(vec.end(),
+                   std::make_move_iterator(sorted.begin()),
+                   std::make_move_iterator(sorted.end()));
+        return overlapping;
+    }
+
+    // Like addDesc, the current elements go before the equal new ones
+    std::vector<nixlSectionDesc> merged;
+    merged.reserve(vec.size() + sorted.size());
+    std::merge(std::make_move_iterator(vec.begin()),
+               std::make_move_iterator(vec.end()),
+               std::make_move_iterator(sorted.begin()),
+               std::make_move_iterator(sorted.end()),
+               std::back_inserter(merged));
+    vec = std::move(merged);
+    return overlapping;
+}
+
 bool
 nixlSecDescList::verifySorted() const {
     const auto &vec = this->descs;
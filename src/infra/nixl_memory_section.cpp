@@ -16,6 +16,7 @@
  */
 #include <map>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 #include "nixl.h"
 #include "nixl_descriptors.h"
@@ -23,6 +24,7 @@
 #include "backend/backend_engine.h"
 #include "nixl_types.h"
 #include "serdes/serdes.h"
+#include "common/nixl_log.h"
 
 /*** Class nixlMemSection implementation ***/
 
@@ -52,9 +54,11 @@ nixlMemSection::queryBackends(const nixl_mem_t mem) const noexcept {
     return &memToBackend[mem];
 }
 
-nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
-                                        nixlBackendEngine* backend,
-                                        nixl_meta_dlist_t &resp) const {
+template<typename desc_list_t>
+nixl_status_t
+nixlMemSection::populateDescs(const nixl_xfer_dlist_t &query,
+                              nixlBackendEngine *backend,
+                              desc_list_t &resp) const {
 
     if ((query.getType() != resp.getType()) || (query.isEmpty())) {
         return NIXL_ERR_INVALID_PARAM;
@@ -105,6 +109,19 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     return NIXL_SUCCESS;
 }
 
+nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
+                                        nixlBackendEngine* backend,
+                                        nixl_meta_dlist_t &resp) const {
+    return populateDescs(query, backend, resp);
+}
+
+nixl_status_t
+nixlMemSection::populate(const nixl_xfer_dlist_t &query,
+                         nixlBackendEngine *backend,
+                         nixlMetaDescBuf &resp) const {
+    return populateDescs(query, backend, resp);
+}
+
 nixl_status_t
 nixlMemSection::addElement(const nixlRemoteDesc &query,
                            nixlBackendEngine *backend,
@@ -142,16 +159,21 @@ nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
 
     nixlSecDescList &target = emplace(nixl_mem, backend);
 
-    // Add entries to the target list
+    // Registered entries are collected and merged into the sorted lists once at the end
+    std::vector<nixlSectionDesc> local_secs, self_secs;
+    local_secs.reserve(mem_elms.descCount());
+    if (backend->supportsLocal()) {
+        self_secs.reserve(mem_elms.descCount());
+    }
+
     nixlSectionDesc local_sec, self_sec;
     nixlBasicDesc *lp = &local_sec;
     nixlBasicDesc *rp = &self_sec;
     nixl_status_t ret = NIXL_SUCCESS;
 
-    int i;
-    for (i = 0; i < mem_elms.descCount(); ++i) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        // TODO: For now only warning the user of overlaps, there can be a more checks
+        //       mode where we split the memories
         ret = backend->registerMem(mem_elms[i], nixl_mem, local_sec.metadataP);
         if (ret != NIXL_SUCCESS)
             break;
@@ -180,30 +202,34 @@ nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
              (nixl_mem == FILE_SEG)) && (lp->len==0))
             lp->len = SIZE_MAX; // File has no range limit
 
-        target.addDesc(local_sec);
+        local_secs.push_back(local_sec);
 
         if (backend->supportsLocal()) {
             *rp = *lp;
-            remote_self.addDesc(self_sec);
+            self_secs.push_back(self_sec);
         }
     }
 
-    // Abort in case of error
+    // Abort in case of error, nothing was added to the lists yet
     if (ret != NIXL_SUCCESS) {
-        for (int j = 0; j < i; ++j) {
-            int index = target.getIndex(mem_elms[j]);
-
-            if (backend->supportsLocal()) {
-                int self_index = remote_self.getIndex(mem_elms[j]);
-                // Should never be negative, as we just added it in previous loop
-                if (self_index >= 0 && remote_self[self_index].metadataP != target[index].metadataP)
-                    backend->unloadMD(remote_self[self_index].metadataP);
-            }
-            backend->deregisterMem(target[index].metadataP);
-            target.remDesc(index);
+        for (size_t j = 0; j < local_secs.size(); ++j) {
+            if (backend->supportsLocal() && self_secs[j].metadataP != local_secs[j].metadataP)
+                backend->unloadMD(self_secs[j].metadataP);
+            backend->deregisterMem(local_secs[j].metadataP);
         }
         remote_self.clear();
+        return ret;
     }
+
+    // Stable sorts keep both lists in the same order, equal elements in registration order
+    std::stable_sort(local_secs.begin(), local_secs.end());
+    std::stable_sort(self_secs.begin(), self_secs.end());
+    const size_t overlapping = target.addSortedDescs(std::move(local_secs));
+    if (overlapping) {
+        NIXL_WARN << overlapping << " registered descriptors overlap other descriptors"
+                  << " of the same memory type and backend";
+    }
+    remote_self.addSortedDescs(std::move(self_secs));
     return ret;
 }
 
@@ -307,18 +333,23 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
         }
 
         const nixlSecDescList &base = it->second;
-        nixlSecDescList resp(nixl_mem);
+        std::vector<nixlSectionDesc> found;
+        found.reserve(mem_elms.descCount());
         for (const auto &desc : mem_elms) {
             int index = base.getIndex(desc);
             if (index < 0) {
                 ret = NIXL_ERR_NOT_FOUND;
                 break;
             }
-            resp.addDesc(base[index]);
+            found.push_back(base[index]);
         }
         if (ret != NIXL_SUCCESS) {
             break;
         }
+
+        std::stable_sort(found.begin(), found.end());
+        nixlSecDescList resp(nixl_mem);
+        resp.addSortedDescs(std::move(found));
         mem_elms_to_serialize.try_emplace(sec_key, std::move(resp));
     }
 
@@ -357,30 +388,59 @@ nixl_status_t nixlRemoteSection::addDescList (
 
     nixlSecDescList &target = emplace(nixl_mem, backend);
 
-    // Add entries to the target list.
-    nixlSectionDesc out;
-    nixlBasicDesc *p = &out;
-    nixl_status_t ret;
-    for (int i=0; i<mem_elms.descCount(); ++i) {
-        // TODO: Can add overlap checks (erroneous)
-        int idx = target.getIndex(mem_elms[i]);
-        if (idx < 0) {
-            ret = backend->loadRemoteMD(mem_elms[i], nixl_mem, agentName, out.metadataP);
-            // In case of errors, no need to remove the previous entries
-            // Agent will delete the full object.
-            if (ret<0)
-                return ret;
-            *p = mem_elms[i]; // Copy the basic desc part
-            out.metaBlob = mem_elms[i].metaInfo;
-            target.addDesc(out);
-        } else {
-            const nixl_blob_t &prev_meta_info = target[idx].metaBlob;
+    // Load the entries in sorted order, so that duplicates and overlaps are adjacent and
+    // the loaded entries are merged into the target list at once.
+    std::vector<int> order(mem_elms.descCount());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&mem_elms](int lhs, int rhs) {
+        return mem_elms[lhs] < mem_elms[rhs];
+    });
+
+    const nixlSecDescList &loaded = target;
+    std::vector<nixlSectionDesc> batch;
+    batch.reserve(order.size());
+    const nixlBlobDesc *prev = nullptr;
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    for (int i : order) {
+        const nixlBlobDesc &elm = mem_elms[i];
+        if (prev && static_cast<const nixlBasicDesc &>(*prev) == elm) {
             // TODO: Support metadata updates
-            if (prev_meta_info != mem_elms[i].metaInfo)
-                return NIXL_ERR_NOT_ALLOWED;
+            if (prev->metaInfo != elm.metaInfo) {
+                ret = NIXL_ERR_NOT_ALLOWED;
+                break;
+            }
+            continue;
+        }
+        prev = &elm;
+
+        int idx = loaded.getIndex(elm);
+        if (idx >= 0) {
+            if (loaded[idx].metaBlob != elm.metaInfo) {
+                ret = NIXL_ERR_NOT_ALLOWED;
+                break;
+            }
+            continue;
         }
+
+        nixlSectionDesc out;
+        ret = backend->loadRemoteMD(elm, nixl_mem, agentName, out.metadataP);
+        if (ret < 0) {
+            break;
+        }
+        static_cast<nixlBasicDesc &>(out) = elm; // Copy the basic desc part
+        out.metaBlob = elm.metaInfo;
+        batch.push_back(std::move(out));
     }
-    return NIXL_SUCCESS;
+
+    // In case of errors, the entries loaded so far are still added to be unloaded
+    // when the agent deletes the full object.
+    const size_t overlapping = target.addSortedDescs(std::move(batch));
+    if (overlapping) {
+        NIXL_WARN << overlapping << " descriptors in the metadata of agent " << agentName
+                  << " overlap other descriptors of the same memory type and backend";
+    }
+    return (ret < 0) ? ret : NIXL_SUCCESS;
 }
 
 nixl_status_t
@@ -428,9 +488,8 @@ nixlRemoteSection::loadLocalData(const nixlSecDescList &mem_elms, nixlBackendEng
 
     nixlSecDescList &target = emplace(nixl_mem, backend);
 
-    for (auto &elm : mem_elms) {
-        target.addDesc(elm);
-    }
+    // mem_elms is sorted already
+    target.addSortedDescs(std::vector<nixlSectionDesc>(mem_elms.begin(), mem_elms.end()));
     return NIXL_SUCCESS;
 }
 
@@ -18,11 +18,16 @@
 
 #include "azure_blob_client.h"
 #include <asio.hpp>
+#include <azure/core/base64.hpp>
 #include <azure/core/http/curl_transport.hpp>
+#include <azure/core/io/body_stream.hpp>
 #include <azure/storage/blobs.hpp>
 #include <azure/identity/default_azure_credential.hpp>
+#include <algorithm>
+#include <atomic>
 #include <optional>
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <cstdlib>
 #include <absl/strings/str_format.h>
@@ -81,11 +86,49 @@ getCaBundle(nixl_b_params_t *custom_params) {
     return nixl::config::getValueDefaulted<std::string>("AZURE_CA_BUNDLE", "");
 }
 
+size_t
+getSizeParam(nixl_b_params_t *custom_params, const std::string &key, size_t default_value) {
+    if (custom_params) {
+        auto it = custom_params->find(key);
+        if (it != custom_params->end() && !it->second.empty()) {
+            return std::stoull(it->second);
+        }
+    }
+
+    return default_value;
+}
+
+// Block IDs must be Base64 strings of the same length for all blocks of a blob
+std::string
+getBlockId(size_t idx) {
+    const std::string raw = absl::StrFormat("%016d", idx);
+    return Azure::Core::Convert::Base64Encode(std::vector<uint8_t>(raw.begin(), raw.end()));
+}
+
 } // namespace
 
+struct azureBlobClient::chunkedXfer {
+    std::string blobName;
+    bool upload;
+    uintptr_t dataPtr;
+    size_t dataLen;
+    size_t offset;
+    size_t chunkSize;
+    size_t numChunks;
+    std::function<void(bool success)> callback;
+
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> activeRunners{0};
+    std::atomic<bool> failed{false};
+};
+
 azureBlobClient::azureBlobClient(nixl_b_params_t *custom_params,
                                  std::shared_ptr<asio::thread_pool> executor) {
     executor_ = executor;
+    // Transfers larger than chunk_size are split in blocks transferred in parallel,
+    // 0 keeps a single SDK call per transfer
+    chunkSize_ = ::getSizeParam(custom_params, "chunk_size", 0);
+    chunkConcurrency_ = std::max<size_t>(::getSizeParam(custom_params, "chunk_concurrency", 8), 1);
     std::string accountUrl = ::getAccountUrl(custom_params);
     std::string containerName = ::getContainerName(custom_params);
     std::string connectionString = ::getConnectionString(custom_params);
@@ -139,6 +182,18 @@ azureBlobClient::putBlobAsync(std::string_view blob_name,
         return;
     }
 
+    if (chunkSize_ > 0 && data_len > chunkSize_) {
+        auto xfer = std::make_shared<chunkedXfer>();
+        xfer->blobName = std::string(blob_name);
+        xfer->upload = true;
+        xfer->dataPtr = data_ptr;
+        xfer->dataLen = data_len;
+        xfer->offset = 0;
+        xfer->callback = std::move(callback);
+        startChunkedXfer(xfer);
+        return;
+    }
+
     std::string blob_name_str(blob_name);
     asio::post(*executor_, [this, blob_name_str, data_ptr, data_len, callback]() {
         try {
@@ -158,6 +213,17 @@ azureBlobClient::getBlobAsync(std::string_view blob_name,
                               size_t data_len,
                               size_t offset,
                               get_blob_callback_t callback) {
+    if (chunkSize_ > 0 && data_len > chunkSize_) {
+        auto xfer = std::make_shared<chunkedXfer>();
+        xfer->blobName = std::string(blob_name);
+        xfer->upload = false;
+        xfer->dataPtr = data_ptr;
+        xfer->dataLen = data_len;
+        xfer->offset = offset;
+        xfer->callback = std::move(callback);
+        startChunkedXfer(xfer);
+        return;
+    }
 
     std::string blob_name_str(blob_name);
     asio::post(*executor_, [this, blob_name_str, data_ptr, data_len, offset, callback]() {
@@ -177,6 +243,74 @@ azureBlobClient::getBlobAsync(std::string_view blob_name,
     });
 }
 
+void
+azureBlobClient::startChunkedXfer(const std::shared_ptr<chunkedXfer> &xfer) {
+    // A block blob is made of at most 50000 blocks, grow the chunks if needed
+    constexpr size_t max_blocks = 50000;
+    xfer->chunkSize = std::max(chunkSize_, (xfer->dataLen + max_blocks - 1) / max_blocks);
+    xfer->numChunks = (xfer->dataLen + xfer->chunkSize - 1) / xfer->chunkSize;
+
+    // Every runner takes the next pending chunk until none is left, so that at
+    // most chunkConcurrency_ executor threads work on a single transfer
+    const size_t num_runners = std::min(chunkConcurrency_, xfer->numChunks);
+    xfer->activeRunners.store(num_runners);
+    for (size_t i = 0; i < num_runners; ++i) {
+        asio::post(*executor_, [this, xfer]() { runChunks(xfer); });
+    }
+}
+
+void
+azureBlobClient::runChunks(const std::shared_ptr<chunkedXfer> &xfer) {
+    auto blobClient = blobContainerClient_->GetBlockBlobClient(xfer->blobName);
+
+    for (size_t idx = xfer->nextChunk.fetch_add(1);
+         idx < xfer->numChunks && !xfer->failed.load();
+         idx = xfer->nextChunk.fetch_add(1)) {
+        const size_t chunk_offset = idx * xfer->chunkSize;
+        const size_t chunk_len = std::min(xfer->chunkSize, xfer->dataLen - chunk_offset);
+        auto chunk_ptr = reinterpret_cast<uint8_t *>(xfer->dataPtr + chunk_offset);
+
+        try {
+            if (xfer->upload) {
+                Azure::Core::IO::MemoryBodyStream stream(chunk_ptr, chunk_len);
+                blobClient.StageBlock(getBlockId(idx), stream);
+            } else {
+                Azure::Storage::Blobs::DownloadBlobToOptions options;
+                Azure::Core::Http::HttpRange range;
+                range.Offset = static_cast<int64_t>(xfer->offset + chunk_offset);
+                range.Length = static_cast<int64_t>(chunk_len);
+                options.Range = range;
+                blobClient.DownloadTo(chunk_ptr, chunk_len, options);
+            }
+        }
+        catch (const std::exception &e) {
+            xfer->failed.store(true);
+        }
+    }
+
+    if (xfer->activeRunners.fetch_sub(1) != 1) {
+        return;
+    }
+
+    // Last runner completes the transfer
+    bool success = !xfer->failed.load();
+    if (success && xfer->upload) {
+        std::vector<std::string> block_ids;
+        block_ids.reserve(xfer->numChunks);
+        for (size_t idx = 0; idx < xfer->numChunks; ++idx) {
+            block_ids.push_back(getBlockId(idx));
+        }
+
+        try {
+            blobClient.CommitBlockList(block_ids);
+        }
+        catch (const std::exception &e) {
+            success = false;
+        }
+    }
+    xfer->callback(success);
+}
+
 bool
 azureBlobClient::checkBlobExists(std::string_view blob_name) {
     auto blobClient = blobContainerClient_->GetBlockBlobClient(std::string(blob_name));
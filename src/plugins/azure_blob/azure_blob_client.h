@@ -118,8 +118,23 @@ public:
     checkBlobExists(std::string_view blob_name) override;
 
 private:
+    struct chunkedXfer;
+
+    /**
+     * Run a transfer split in chunks of chunkSize_ bytes, with up to
+     * chunkConcurrency_ chunks in flight. The callback is invoked by the
+     * executor thread which completes the last chunk.
+     */
+    void
+    startChunkedXfer(const std::shared_ptr<chunkedXfer> &xfer);
+
+    void
+    runChunks(const std::shared_ptr<chunkedXfer> &xfer);
+
     std::shared_ptr<asio::thread_pool> executor_;
     std::unique_ptr<Azure::Storage::Blobs::BlobContainerClient> blobContainerClient_;
+    size_t chunkSize_;
+    size_t chunkConcurrency_;
 };
 
 #endif // AZURE_BLOB_CLIENT_H
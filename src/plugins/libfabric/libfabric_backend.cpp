@@ -291,7 +291,8 @@ nixlLibfabricBackendH::is_completed() const {
 nixlLibfabricEngine::nixlLibfabricEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
       progress_thread_enabled_(init_params->enableProgTh),
-      progress_thread_delay_(std::chrono::microseconds(init_params->pthrDelay)),
+      progress_policy_(
+          nixlProgressPolicy::fromParams(init_params->customParams, init_params->pthrDelay)),
       rail_manager(NIXL_LIBFABRIC_DEFAULT_STRIPING_THRESHOLD),
       runtime_(FI_HMEM_SYSTEM) {
 
@@ -388,8 +389,7 @@ nixlLibfabricEngine::nixlLibfabricEngine(const nixlBackendInitParams *init_param
 
         // Start Progress thread for rail completion processing
         if (progress_thread_enabled_) {
-            NIXL_DEBUG << "Starting Progress thread for rails with delay: "
-                       << progress_thread_delay_.count() << " microseconds";
+            NIXL_DEBUG << "Starting Progress thread for rails with " << progress_policy_;
             progress_thread_stop_ = false;
             progress_thread_ = std::thread(&nixlLibfabricEngine::progressThread, this);
 
@@ -1422,8 +1422,15 @@ nixlLibfabricEngine::progressThread() {
             NIXL_ERROR << "PT: Failed to process completions on rails";
             // Don't return error, continue for robustness
         }
-        if (!any_completions) {
-            std::this_thread::sleep_for(progress_thread_delay_);
+        if (any_completions) {
+            // Poll again right away, more completions are likely to follow
+            progress_policy_.onActivity();
+            continue;
+        }
+
+        const nixlTime::us_t wait = progress_policy_.nextWait();
+        if (wait > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(wait));
         }
     }
     NIXL_DEBUG << "PT: Thread exiting cleanly";
@@ -32,6 +32,7 @@
 #include "nixl.h"
 #include "backend/backend_engine.h"
 #include "common/nixl_time.h"
+#include "common/progress_policy.h"
 #include "serdes/serdes.h"
 
 #include "libfabric/libfabric_rail_manager.h"
@@ -176,8 +177,8 @@ private:
     // Store user's original progress thread preference
     bool progress_thread_enabled_;
 
-    // Progress thread delay in microseconds
-    std::chrono::microseconds progress_thread_delay_;
+    // Progress thread wait policy, only used by the progress thread
+    nixlProgressPolicy progress_policy_;
 
     // Rail Manager - Stack allocated for better performance (mutable for const methods)
     mutable nixlLibfabricRailManager rail_manager;
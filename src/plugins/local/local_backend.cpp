@@ -0,0 +1,292 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "local_backend.h"
+
+#include <algorithm>
+
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+constexpr size_t kDefaultNumThreads = 4;
+constexpr size_t kDefaultChunkSize = 1024 * 1024;
+constexpr size_t kDefaultInlineThreshold = 64 * 1024;
+constexpr size_t kDefaultStreamThreshold = 8 * 1024 * 1024;
+
+template<typename T>
+[[nodiscard]] T
+getParam(const nixl_b_params_t *custom_params, const std::string &key, T default_value) {
+    if (!custom_params) {
+        return default_value;
+    }
+
+    const auto it = custom_params->find(key);
+    if (it == custom_params->end()) {
+        return default_value;
+    }
+
+    T result;
+    if constexpr (std::is_same_v<T, bool>) {
+        return absl::SimpleAtob(it->second, &result) ? result : default_value;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return it->second;
+    } else {
+        return absl::SimpleAtoi(it->second, &result) ? result : default_value;
+    }
+}
+
+bool
+isValidPrepXferParams(const nixl_xfer_op_t &operation,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote) {
+    if (operation != NIXL_WRITE && operation != NIXL_READ) {
+        NIXL_ERROR << absl::StrFormat("Error: Invalid operation type: %d", operation);
+        return false;
+    }
+
+    if ((local.getType() != DRAM_SEG) || (remote.getType() != DRAM_SEG)) {
+        NIXL_ERROR << absl::StrFormat("Error: Memory types must be DRAM_SEG, got %d and %d",
+                                      local.getType(),
+                                      remote.getType());
+        return false;
+    }
+
+    if (local.descCount() != remote.descCount()) {
+        NIXL_ERROR << absl::StrFormat(
+            "Error: Mismatch in descriptor counts - local: %d, remote: %d",
+            local.descCount(),
+            remote.descCount());
+        return false;
+    }
+
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            NIXL_ERROR << absl::StrFormat(
+                "Error: Mismatch in length of descriptor %d - local: %d, remote: %d",
+                i,
+                local[i].len,
+                remote[i].len);
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+nixlLocalEngine::nixlLocalEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    const nixl_b_params_t *custom_params = init_params->customParams;
+    chunkSize_ =
+        std::max<size_t>(1, getParam(custom_params, "chunk_size", kDefaultChunkSize));
+    inlineThreshold_ = getParam(custom_params, "inline_threshold", kDefaultInlineThreshold);
+    streamThreshold_ = getParam(custom_params, "stream_threshold", kDefaultStreamThreshold);
+
+    const std::string kernel = getParam<std::string>(custom_params, "kernel", "auto");
+    if (!nixlLocalParseKernel(kernel, kernel_)) {
+        NIXL_ERROR << "Copy kernel '" << kernel << "' is unknown or not supported by the CPU";
+        initErr = true;
+        return;
+    }
+
+    copyEngine_ = std::make_unique<nixlCopyEngine>(
+        "LOCAL",
+        getParam(custom_params, "num_threads", kDefaultNumThreads),
+        getParam(custom_params, "numa_aware", true));
+    NIXL_DEBUG << "LOCAL backend streams with the " << nixlLocalKernelStr(kernel_) << " kernel";
+}
+
+nixlLocalEngine::~nixlLocalEngine() {
+    // Workers may still complete transfers which were not released
+    copyEngine_.reset();
+}
+
+nixl_status_t
+nixlLocalEngine::connect(const std::string &remote_agent) {
+    return (remote_agent == localAgent) ? NIXL_SUCCESS : NIXL_ERR_NOT_SUPPORTED;
+}
+
+nixl_status_t
+nixlLocalEngine::registerMem(const nixlBlobDesc &mem,
+                             const nixl_mem_t &nixl_mem,
+                             nixlBackendMD *&out) {
+    if (nixl_mem != DRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    out = new nixlLocalMetadata(
+        mem.addr, mem.len, nixlCopyEngine::getNode(reinterpret_cast<void *>(mem.addr)));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalEngine::deregisterMem(nixlBackendMD *meta) {
+    delete static_cast<nixlLocalMetadata *>(meta);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalEngine::prepXfer(const nixl_xfer_op_t &operation,
+                          const nixl_meta_dlist_t &local,
+                          const nixl_meta_dlist_t &remote,
+                          const std::string &remote_agent,
+                          nixlBackendReqH *&handle,
+                          const nixl_opt_b_args_t *opt_args) const {
+    return prepXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlLocalEngine::postXfer(const nixl_xfer_op_t &operation,
+                          const nixl_meta_dlist_t &local,
+                          const nixl_meta_dlist_t &remote,
+                          const std::string &remote_agent,
+                          nixlBackendReqH *&handle,
+                          const nixl_opt_b_args_t *opt_args) const {
+    return postXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlLocalEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                               const nixl_meta_span_t &local,
+                               const nixl_meta_span_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH *&handle,
+                               const nixl_opt_b_args_t *opt_args) const {
+    if (remote_agent != localAgent) {
+        NIXL_ERROR << "LOCAL backend cannot transfer to agent " << remote_agent;
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    if (!isValidPrepXferParams(operation, local, remote)) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto req = std::make_unique<nixlLocalBackendReqH>();
+    auto &segments = req->batch_.getSegments();
+    const bool is_read = (operation == NIXL_READ);
+    const nixl_meta_span_t &dst = is_read ? local : remote;
+    const nixl_meta_span_t &src = is_read ? remote : local;
+
+    // Descriptors are split into chunks, and consecutive small ones are merged into a range
+    // as long as their destination is on the same NUMA node
+    size_t range_bytes = 0;
+    for (int i = 0; i < dst.descCount(); ++i) {
+        const auto *md = static_cast<const nixlLocalMetadata *>(dst[i].metadataP);
+        const int node = md ? md->node_ : -1;
+        for (size_t offset = 0; offset < dst[i].len; offset += chunkSize_) {
+            const size_t len = std::min(chunkSize_, dst[i].len - offset);
+            if (req->ranges_.empty() || (range_bytes + len > chunkSize_) ||
+                (req->ranges_.back().node != node)) {
+                req->ranges_.push_back({segments.size(), segments.size(), node});
+                range_bytes = 0;
+            }
+            segments.push_back({dst[i].addr + offset, src[i].addr + offset, len});
+            req->ranges_.back().last = segments.size();
+            range_bytes += len;
+            req->totalBytes_ += len;
+        }
+    }
+
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                               const nixl_meta_span_t &local,
+                               const nixl_meta_span_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH *&handle,
+                               const nixl_opt_b_args_t *opt_args) const {
+    auto *req = static_cast<nixlLocalBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    const bool has_notif = opt_args && opt_args->hasNotif;
+    auto done_cb = [this, req, has_notif, msg = has_notif ? opt_args->notifMsg : nixl_blob_t()](
+                       nixl_status_t status) {
+        req->xferDone.mark();
+        if (has_notif) {
+            addNotif(msg);
+            req->notifDone.mark();
+        }
+        return status;
+    };
+
+    // Transfers larger than the cache would evict the working set, their stores bypass it
+    const nixl_local_kernel_t kernel =
+        (req->totalBytes_ >= streamThreshold_) ? kernel_ : nixl_local_kernel_t::MEMCPY;
+
+    // Small transfers complete in the calling thread, before postXfer returns
+    if (!copyEngine_->hasWorkers() || (req->totalBytes_ <= inlineThreshold_)) {
+        req->batch_.start(1, kernel, std::move(done_cb));
+        req->batch_.run(0, req->batch_.getSegments().size());
+        return req->batch_.getStatus();
+    }
+
+    req->batch_.start(req->ranges_.size(), kernel, std::move(done_cb));
+    for (const auto &range : req->ranges_) {
+        copyEngine_->submit(req->batch_, range.first, range.last, range.node);
+    }
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlLocalEngine::checkXfer(nixlBackendReqH *handle) const {
+    const auto *req = static_cast<const nixlLocalBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_IN_PROG;
+    }
+    return req->batch_.getStatus();
+}
+
+nixl_status_t
+nixlLocalEngine::releaseReqH(nixlBackendReqH *handle) const {
+    auto *req = static_cast<nixlLocalBackendReqH *>(handle);
+    // Copies cannot be aborted, wait for the workers to be done with the handle
+    req->batch_.wait();
+    delete req;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlLocalEngine::addNotif(const std::string &msg) const {
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    notifs_.emplace_back(localAgent, msg);
+}
+
+nixl_status_t
+nixlLocalEngine::genNotif(const std::string &remote_agent, const std::string &msg) const {
+    if (remote_agent != localAgent) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    addNotif(msg);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalEngine::getNotifs(notif_list_t &notif_list) {
+    if (!notif_list.empty()) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    notif_list.swap(notifs_);
+    return NIXL_SUCCESS;
+}
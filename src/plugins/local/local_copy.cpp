@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "local_copy.h"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+// Below this size, aligning the destination costs more than streaming saves
+constexpr size_t kMinStreamLen = 4096;
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) void
+streamCopyAvx2(char *dst, const char *src, size_t len) noexcept {
+    const size_t head = -reinterpret_cast<uintptr_t>(dst) & 31;
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    len -= head;
+
+    for (; len >= 128; len -= 128, dst += 128, src += 128) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 32));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 64));
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 96), d);
+    }
+    _mm_sfence();
+    memcpy(dst, src, len);
+}
+
+__attribute__((target("avx512f"))) void
+streamCopyAvx512(char *dst, const char *src, size_t len) noexcept {
+    const size_t head = -reinterpret_cast<uintptr_t>(dst) & 63;
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    len -= head;
+
+    for (; len >= 256; len -= 256, dst += 256, src += 256) {
+        const __m512i a = _mm512_loadu_si512(src);
+        const __m512i b = _mm512_loadu_si512(src + 64);
+        const __m512i c = _mm512_loadu_si512(src + 128);
+        const __m512i d = _mm512_loadu_si512(src + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 64), b);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 128), c);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 192), d);
+    }
+    _mm_sfence();
+    memcpy(dst, src, len);
+}
+#endif
+
+[[nodiscard]] bool
+isSupported(nixl_local_kernel_t kernel) noexcept {
+    switch (kernel) {
+    case nixl_local_kernel_t::MEMCPY:
+        return true;
+#if defined(__x86_64__)
+    case nixl_local_kernel_t::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case nixl_local_kernel_t::AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+} // namespace
+
+nixl_local_kernel_t
+nixlLocalBestKernel() noexcept {
+    if (isSupported(nixl_local_kernel_t::AVX512)) {
+        return nixl_local_kernel_t::AVX512;
+    }
+    if (isSupported(nixl_local_kernel_t::AVX2)) {
+        return nixl_local_kernel_t::AVX2;
+    }
+    return nixl_local_kernel_t::MEMCPY;
+}
+
+bool
+nixlLocalParseKernel(const std::string &name, nixl_local_kernel_t &kernel) noexcept {
+    if (name == "auto") {
+        kernel = nixlLocalBestKernel();
+        return true;
+    }
+
+    for (const auto k :
+         {nixl_local_kernel_t::MEMCPY, nixl_local_kernel_t::AVX2, nixl_local_kernel_t::AVX512}) {
+        if (name == nixlLocalKernelStr(k)) {
+            kernel = k;
+            return isSupported(k);
+        }
+    }
+    return false;
+}
+
+const char *
+nixlLocalKernelStr(nixl_local_kernel_t kernel) noexcept {
+    switch (kernel) {
+    case nixl_local_kernel_t::MEMCPY:
+        return "memcpy";
+    case nixl_local_kernel_t::AVX2:
+        return "avx2";
+    case nixl_local_kernel_t::AVX512:
+        return "avx512";
+    }
+    return "BAD_KERNEL";
+}
+
+void
+nixlLocalStreamCopy(nixl_local_kernel_t kernel, void *dst, const void *src, size_t len) noexcept {
+    if (len < kMinStreamLen) {
+        kernel = nixl_local_kernel_t::MEMCPY;
+    }
+
+    switch (kernel) {
+#if defined(__x86_64__)
+    case nixl_local_kernel_t::AVX2:
+        streamCopyAvx2(static_cast<char *>(dst), static_cast<const char *>(src), len);
+        return;
+    case nixl_local_kernel_t::AVX512:
+        streamCopyAvx512(static_cast<char *>(dst), static_cast<const char *>(src), len);
+        return;
+#endif
+    default:
+        memcpy(dst, src, len);
+        return;
+    }
+}
+
+nixl_status_t
+nixlLocalCopyBatch::copy(size_t first, size_t last) const {
+    for (size_t i = first; i < last; ++i) {
+        const nixlLocalSegment &seg = segments_[i];
+        nixlLocalStreamCopy(kernel_,
+                            reinterpret_cast<void *>(seg.dst),
+                            reinterpret_cast<const void *>(seg.src),
+                            seg.len);
+    }
+    return NIXL_SUCCESS;
+}
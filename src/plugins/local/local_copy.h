@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_LOCAL_LOCAL_COPY_H
+#define NIXL_SRC_PLUGINS_LOCAL_LOCAL_COPY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/copy_engine.h"
+#include "nixl_types.h"
+
+/**
+ * @enum nixl_local_kernel_t
+ * @brief Copy kernels for transfers large enough to bypass the cache. Smaller transfers always
+ *        use memcpy, which already picks the best vector width of the CPU.
+ */
+enum class nixl_local_kernel_t : uint8_t {
+    MEMCPY, // memcpy only
+    AVX2, // Non-temporal 32-byte stores
+    AVX512, // Non-temporal 64-byte stores
+};
+
+// Widest kernel supported by the CPU
+[[nodiscard]] nixl_local_kernel_t
+nixlLocalBestKernel() noexcept;
+
+// Parses "auto", "memcpy", "avx2" or "avx512", fails for kernels the CPU does not support
+[[nodiscard]] bool
+nixlLocalParseKernel(const std::string &name, nixl_local_kernel_t &kernel) noexcept;
+
+[[nodiscard]] const char *
+nixlLocalKernelStr(nixl_local_kernel_t kernel) noexcept;
+
+// Copies len bytes, with stores which bypass the cache unless the kernel is MEMCPY. The stores
+// are fenced before returning, so that they are ordered before a following completion flag.
+void
+nixlLocalStreamCopy(nixl_local_kernel_t kernel, void *dst, const void *src, size_t len) noexcept;
+
+// A contiguous piece of a transfer, no larger than the chunk size of the engine
+struct nixlLocalSegment {
+    uintptr_t dst;
+    uintptr_t src;
+    size_t len;
+};
+
+/**
+ * @class nixlLocalCopyBatch
+ * @brief The segments of one posted transfer, copied with the kernel of the post. The copy
+ *        engine queues a range to a worker on the node of its destination, so that the
+ *        stores stay on the local memory controller.
+ */
+class nixlLocalCopyBatch : public nixlCopyBatch {
+public:
+    std::vector<nixlLocalSegment> &
+    getSegments() noexcept {
+        return segments_;
+    }
+
+    // Arms the batch for the given number of ranges, at most one post may be in flight
+    void
+    start(size_t ranges, nixl_local_kernel_t kernel, done_cb_t done_cb) {
+        kernel_ = kernel;
+        arm(ranges, std::move(done_cb));
+    }
+
+private:
+    [[nodiscard]] nixl_status_t
+    copy(size_t first, size_t last) const override;
+
+    nixl_local_kernel_t kernel_ = nixl_local_kernel_t::MEMCPY;
+    std::vector<nixlLocalSegment> segments_;
+};
+
+#endif
@@ -54,6 +54,8 @@ public:
     ~nixlObjBackendReqH() = default;
 
     std::vector<std::future<nixl_status_t>> statusFutures_;
+    // Stamped by the client callbacks, which may outlive a failed request
+    std::shared_ptr<nixlCompletionStamp> callbackDone_ = std::make_shared<nixlCompletionStamp>();
 
     nixl_status_t
     getOverallStatus() {
@@ -73,6 +75,10 @@ public:
                 return NIXL_IN_PROG;
             }
         }
+
+        if (auto done = callbackDone_->get()) {
+            xferDone.mark(*done);
+        }
         return NIXL_SUCCESS;
     }
 };
@@ -208,6 +214,7 @@ DefaultObjEngineImpl::postXfer(const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
+    req_h->callbackDone_->reset();
 
     for (int i = 0; i < local.descCount(); ++i) {
         const auto &local_desc = local[i];
@@ -235,7 +242,8 @@ DefaultObjEngineImpl::postXfer(const nixl_xfer_op_t &operation,
 
         // S3 client interface signals completion via a callback, but NIXL API polls request handle
         // for the status code. Use future/promise pair to bridge the gap.
-        auto status_callback = [status_promise](bool success) {
+        auto status_callback = [status_promise, done = req_h->callbackDone_](bool success) {
+            done->mark();
             status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
         };
 
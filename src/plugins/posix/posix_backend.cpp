@@ -29,8 +29,8 @@
 namespace {
 bool
 isValidPrepXferParams(const nixl_xfer_op_t &operation,
-                      const nixl_meta_dlist_t &local,
-                      const nixl_meta_dlist_t &remote,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote,
                       const std::string &remote_agent,
                       const std::string &local_agent) {
     if (remote_agent != local_agent) {
@@ -155,8 +155,8 @@ logOnPercentStep(unsigned int completed, unsigned int total) {
 // NOTE: we initialize num_confirmed_ios_ to the number of descriptors, so if checkXfer is called
 // before postXfer, it will return NIXL_SUCCESS immediately.
 nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
-                                           const nixl_meta_dlist_t &loc,
-                                           const nixl_meta_dlist_t &rem,
+                                           const nixl_meta_span_t &loc,
+                                           const nixl_meta_span_t &rem,
                                            const nixl_opt_b_args_t *args,
                                            std::unique_ptr<nixlPosixIOQueue> &io_queue)
     : operation(op),
@@ -174,6 +174,9 @@ void
 nixlPosixBackendReqH::ioDone(uint32_t data_size, int error) {
     num_confirmed_ios_++;
     logOnPercentStep(num_confirmed_ios_, queue_depth_);
+    if (num_confirmed_ios_ == queue_depth_) {
+        xferDone.mark();
+    }
 }
 
 void
@@ -236,7 +239,8 @@ nixlPosixEngine::nixlPosixEngine(const nixlBackendInitParams *init_params)
       io_queue_(nixlPosixIOQueue::instantiate(io_queue_type_,
                                               getIOSPoolSize(init_params->customParams),
                                               getKernelQueueSize(init_params->customParams))),
-      io_queue_lock_(init_params->syncMode) {
+      io_queue_lock_(init_params->syncMode),
+      postEventId_(registerTelemetryEvent("posix_xfer_post_descs")) {
     if (io_queue_type_.empty()) {
         initErr = true;
         NIXL_ERROR << "Failed to initialize POSIX backend - no supported io queue type found";
@@ -269,6 +273,26 @@ nixlPosixEngine::prepXfer(const nixl_xfer_op_t &operation,
                           const std::string &remote_agent,
                           nixlBackendReqH *&handle,
                           const nixl_opt_b_args_t *opt_args) const {
+    return prepXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlPosixEngine::postXfer(const nixl_xfer_op_t &operation,
+                          const nixl_meta_dlist_t &local,
+                          const nixl_meta_dlist_t &remote,
+                          const std::string &remote_agent,
+                          nixlBackendReqH *&handle,
+                          const nixl_opt_b_args_t *opt_args) const {
+    return postXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlPosixEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                               const nixl_meta_span_t &local,
+                               const nixl_meta_span_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH *&handle,
+                               const nixl_opt_b_args_t *opt_args) const {
     if (!isValidPrepXferParams(operation, local, remote, remote_agent, localAgent)) {
         return NIXL_ERR_INVALID_PARAM;
     }
@@ -296,18 +320,20 @@ nixlPosixEngine::prepXfer(const nixl_xfer_op_t &operation,
 }
 
 nixl_status_t
-nixlPosixEngine::postXfer(const nixl_xfer_op_t &operation,
-                          const nixl_meta_dlist_t &local,
-                          const nixl_meta_dlist_t &remote,
-                          const std::string &remote_agent,
-                          nixlBackendReqH *&handle,
-                          const nixl_opt_b_args_t *opt_args) const {
+nixlPosixEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                               const nixl_meta_span_t &local,
+                               const nixl_meta_span_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH *&handle,
+                               const nixl_opt_b_args_t *opt_args) const {
     try {
         auto &posix_handle = castPosixHandle(handle);
         NIXL_LOCK_GUARD(io_queue_lock_);
         nixl_status_t status = posix_handle.postXfer();
         if (status != NIXL_IN_PROG) {
             NIXL_ERROR << "Error in submitting queue";
+        } else {
+            addTelemetryEvent(postEventId_, local.descCount());
         }
         return status;
     }
@@ -29,8 +29,8 @@
 class nixlPosixBackendReqH : public nixlBackendReqH {
 private:
     const nixl_xfer_op_t &operation; // The transfer operation (read/write)
-    const nixl_meta_dlist_t &local; // Local memory descriptor list
-    const nixl_meta_dlist_t &remote; // Remote memory descriptor list
+    const nixl_meta_span_t local; // Local memory descriptors
+    const nixl_meta_span_t remote; // Remote memory descriptors
     const nixl_opt_b_args_t *opt_args; // Optional backend-specific arguments
     const int queue_depth_; // Queue depth for async I/O
     int num_confirmed_ios_; // Number of confirmed IOs
@@ -43,8 +43,8 @@ private:
 
 public:
     nixlPosixBackendReqH(const nixl_xfer_op_t &operation,
-                         const nixl_meta_dlist_t &local,
-                         const nixl_meta_dlist_t &remote,
+                         const nixl_meta_span_t &local,
+                         const nixl_meta_span_t &remote,
                          const nixl_opt_b_args_t *opt_args,
                          std::unique_ptr<nixlPosixIOQueue> &io_queue);
     ~nixlPosixBackendReqH() {};
@@ -76,6 +76,7 @@ private:
     std::string_view io_queue_type_;
     mutable std::unique_ptr<nixlPosixIOQueue> io_queue_;
     mutable nixlLock io_queue_lock_;
+    const uint32_t postEventId_;
 
 public:
     nixlPosixEngine(const nixlBackendInitParams *init_params);
@@ -138,6 +139,27 @@ public:
              nixlBackendReqH *&handle,
              const nixl_opt_b_args_t *opt_args = nullptr) const override;
 
+    bool
+    supportsXferSpans() const override {
+        return true;
+    }
+
+    nixl_status_t
+    prepXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
     nixl_status_t
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
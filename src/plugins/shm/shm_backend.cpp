@@ -0,0 +1,454 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_backend.h"
+
+#include <sys/prctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+#include "serdes/serdes.h"
+
+namespace {
+constexpr size_t kDefaultNumThreads = 4;
+constexpr size_t kDefaultChunkSize = 1024 * 1024;
+constexpr size_t kDefaultInlineThreshold = 64 * 1024;
+constexpr uint32_t kDefaultRingSlots = 4096;
+constexpr auto kNotifTimeout = std::chrono::seconds(1);
+
+struct nixlShmPublicData {
+    uint64_t addr;
+    uint64_t len;
+};
+
+template<typename T>
+[[nodiscard]] T
+getParam(const nixl_b_params_t *custom_params, const std::string &key, T default_value) {
+    if (!custom_params) {
+        return default_value;
+    }
+
+    const auto it = custom_params->find(key);
+    if (it == custom_params->end()) {
+        return default_value;
+    }
+
+    T result;
+    if constexpr (std::is_same_v<T, bool>) {
+        return absl::SimpleAtob(it->second, &result) ? result : default_value;
+    } else {
+        return absl::SimpleAtoi(it->second, &result) ? result : default_value;
+    }
+}
+
+// Agents of the same kernel and PID namespace can address each other's processes by pid
+[[nodiscard]] std::string
+getHostId() {
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string boot_id;
+    std::getline(file, boot_id);
+
+    struct stat st;
+    const ino_t pid_ns = (stat("/proc/self/ns/pid", &st) == 0) ? st.st_ino : 0;
+    return absl::StrFormat("%s:%u", absl::StripAsciiWhitespace(boot_id), pid_ns);
+}
+
+bool
+isValidPrepXferParams(const nixl_xfer_op_t &operation,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote) {
+    if (operation != NIXL_WRITE && operation != NIXL_READ) {
+        NIXL_ERROR << absl::StrFormat("Error: Invalid operation type: %d", operation);
+        return false;
+    }
+
+    if ((local.getType() != DRAM_SEG) || (remote.getType() != DRAM_SEG)) {
+        NIXL_ERROR << absl::StrFormat("Error: Memory types must be DRAM_SEG, got %d and %d",
+                                      local.getType(),
+                                      remote.getType());
+        return false;
+    }
+
+    if (local.descCount() != remote.descCount()) {
+        NIXL_ERROR << absl::StrFormat(
+            "Error: Mismatch in descriptor counts - local: %d, remote: %d",
+            local.descCount(),
+            remote.descCount());
+        return false;
+    }
+
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            NIXL_ERROR << absl::StrFormat(
+                "Error: Mismatch in length of descriptor %d - local: %d, remote: %d",
+                i,
+                local[i].len,
+                remote[i].len);
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+nixlShmEngine::nixlShmEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params),
+      hostId_(getHostId()) {
+    const nixl_b_params_t *custom_params = init_params->customParams;
+    chunkSize_ =
+        std::max<size_t>(1, getParam(custom_params, "chunk_size", kDefaultChunkSize));
+    inlineThreshold_ = getParam(custom_params, "inline_threshold", kDefaultInlineThreshold);
+
+    if (getParam(custom_params, "allow_ptrace_peers", false)) {
+        // Only matters with a Yama ptrace scope of 1, where it fails when Yama is absent
+        if (prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0) != 0) {
+            NIXL_DEBUG << "prctl(PR_SET_PTRACER) failed: " << strerror(errno);
+        }
+    }
+
+    ring_ = nixlShmRing::create(getParam(custom_params, "ring_slots", kDefaultRingSlots));
+    if (!ring_) {
+        initErr = true;
+        return;
+    }
+
+    copyEngine_ = std::make_unique<nixlCopyEngine>(
+        "SHM",
+        getParam(custom_params, "num_threads", kDefaultNumThreads),
+        getParam(custom_params, "numa_aware", true));
+}
+
+nixlShmEngine::~nixlShmEngine() {
+    // Workers may still deliver notifications of transfers which were not released
+    copyEngine_.reset();
+}
+
+nixl_status_t
+nixlShmEngine::getConnInfo(std::string &str) const {
+    const pid_t pid = getpid();
+    nixlSerDes sd;
+    sd.addStr("host", hostId_);
+    sd.addBuf("pid", &pid, sizeof(pid));
+    sd.addStr("ring", ring_->getName());
+    str = sd.exportStr();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                  const std::string &remote_conn_info) {
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+
+    nixlSerDes sd;
+    if (sd.importStr(remote_conn_info) != NIXL_SUCCESS) {
+        NIXL_ERROR << "Invalid SHM connection info of agent " << remote_agent;
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (sd.getStr("host") != hostId_) {
+        NIXL_DEBUG << "Agent " << remote_agent << " is not on this host or PID namespace";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    pid_t pid;
+    const nixl_status_t ret = sd.getBuf("pid", &pid, sizeof(pid));
+    const std::string ring_name = sd.getStr("ring");
+    if ((ret != NIXL_SUCCESS) || ring_name.empty()) {
+        NIXL_ERROR << "Invalid SHM connection info of agent " << remote_agent;
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto conn = std::make_shared<nixlShmConnection>(
+        nixlShmConnection{pid, pid == getpid(), ring_name, nullptr});
+    std::lock_guard<std::mutex> lock(connMutex_);
+    conns_[remote_agent] = std::move(conn);
+    return NIXL_SUCCESS;
+}
+
+std::shared_ptr<nixlShmConnection>
+nixlShmEngine::getConnection(const std::string &remote_agent) const {
+    std::lock_guard<std::mutex> lock(connMutex_);
+    auto it = conns_.find(remote_agent);
+    if (it == conns_.end()) {
+        if (remote_agent != localAgent) {
+            NIXL_ERROR << "No SHM connection info of agent " << remote_agent;
+            return nullptr;
+        }
+        it = conns_
+                 .emplace(localAgent,
+                          std::make_shared<nixlShmConnection>(
+                              nixlShmConnection{getpid(), true, ring_->getName(), ring_}))
+                 .first;
+    }
+
+    // The ring is mapped once, handles then share the connection until they are released
+    if (!it->second->ring_) {
+        it->second->ring_ = nixlShmRing::attach(it->second->ringName_);
+        if (!it->second->ring_) {
+            return nullptr;
+        }
+    }
+    return it->second;
+}
+
+nixl_status_t
+nixlShmEngine::connect(const std::string &remote_agent) {
+    return getConnection(remote_agent) ? NIXL_SUCCESS : NIXL_ERR_NOT_FOUND;
+}
+
+nixl_status_t
+nixlShmEngine::disconnect(const std::string &remote_agent) {
+    std::lock_guard<std::mutex> lock(connMutex_);
+    auto it = conns_.find(remote_agent);
+    if ((it == conns_.end()) || (remote_agent == localAgent)) {
+        return NIXL_SUCCESS;
+    }
+
+    // In flight handles keep the mapping of the ring alive
+    const nixlShmConnection &conn = *it->second;
+    it->second = std::make_shared<nixlShmConnection>(
+        nixlShmConnection{conn.pid_, conn.sameProcess_, conn.ringName_, nullptr});
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::registerMem(const nixlBlobDesc &mem,
+                           const nixl_mem_t &nixl_mem,
+                           nixlBackendMD *&out) {
+    if (nixl_mem != DRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    out = new nixlShmMetadata(
+        true, mem.addr, mem.len, nixlCopyEngine::getNode(reinterpret_cast<void *>(mem.addr)));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::deregisterMem(nixlBackendMD *meta) {
+    delete static_cast<nixlShmMetadata *>(meta);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::getPublicData(const nixlBackendMD *meta, std::string &str) const {
+    const auto *md = static_cast<const nixlShmMetadata *>(meta);
+    const nixlShmPublicData data{md->addr_, md->len_};
+    str = nixlSerDes::_bytesToString(&data, sizeof(data));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::loadRemoteMD(const nixlBlobDesc &input,
+                            const nixl_mem_t &nixl_mem,
+                            const std::string &remote_agent,
+                            nixlBackendMD *&output) {
+    if ((nixl_mem != DRAM_SEG) || (input.metaInfo.size() != sizeof(nixlShmPublicData))) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    nixlShmPublicData data;
+    nixlSerDes::_stringToBytes(&data, input.metaInfo, sizeof(data));
+    output = new nixlShmMetadata(false, data.addr, data.len, -1);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::unloadMD(nixlBackendMD *input) {
+    // Local metadata is loaded as the private one, which is released on deregistration
+    auto *md = static_cast<nixlShmMetadata *>(input);
+    if (!md->isPrivate()) {
+        delete md;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::prepXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return prepXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlShmEngine::postXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return postXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlShmEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    if (!isValidPrepXferParams(operation, local, remote)) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto conn = getConnection(remote_agent);
+    if (!conn) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    auto req = std::make_unique<nixlShmBackendReqH>(conn);
+    req->batch_.init(operation, conn->pid_, conn->sameProcess_);
+    auto &segments = req->batch_.getSegments();
+
+    // Descriptors are split into chunks, and consecutive small ones are merged into a range
+    // as long as their local memory is on the same NUMA node
+    size_t range_bytes = 0;
+    for (int i = 0; i < local.descCount(); ++i) {
+        const auto *md = static_cast<const nixlShmMetadata *>(local[i].metadataP);
+        const int node = md ? md->node_ : -1;
+        for (size_t offset = 0; offset < local[i].len; offset += chunkSize_) {
+            const size_t len = std::min(chunkSize_, local[i].len - offset);
+            if (req->ranges_.empty() || (range_bytes + len > chunkSize_) ||
+                (req->ranges_.back().node != node)) {
+                req->ranges_.push_back({segments.size(), segments.size(), node});
+                range_bytes = 0;
+            }
+            segments.push_back({local[i].addr + offset, remote[i].addr + offset, len});
+            req->ranges_.back().last = segments.size();
+            range_bytes += len;
+            req->totalBytes_ += len;
+        }
+    }
+
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    auto *req = static_cast<nixlShmBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    const bool has_notif = opt_args && opt_args->hasNotif;
+    auto done_cb = [this, req, has_notif, msg = has_notif ? opt_args->notifMsg : nixl_blob_t()](
+                       nixl_status_t status) {
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+        req->xferDone.mark();
+        if (has_notif) {
+            status = sendNotif(*req->conn_, msg);
+            if (status == NIXL_SUCCESS) {
+                req->notifDone.mark();
+            }
+        }
+        return status;
+    };
+
+    // Small transfers complete in the calling thread, before postXfer returns
+    if (!copyEngine_->hasWorkers() || (req->totalBytes_ <= inlineThreshold_)) {
+        req->batch_.start(1, std::move(done_cb));
+        req->batch_.run(0, req->batch_.getSegments().size());
+        return req->batch_.getStatus();
+    }
+
+    req->batch_.start(req->ranges_.size(), std::move(done_cb));
+    for (const auto &range : req->ranges_) {
+        copyEngine_->submit(req->batch_, range.first, range.last, range.node);
+    }
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlShmEngine::checkXfer(nixlBackendReqH *handle) const {
+    const auto *req = static_cast<const nixlShmBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_IN_PROG;
+    }
+    return req->batch_.getStatus();
+}
+
+nixl_status_t
+nixlShmEngine::releaseReqH(nixlBackendReqH *handle) const {
+    auto *req = static_cast<nixlShmBackendReqH *>(handle);
+    // Copies cannot be aborted, wait for the workers to be done with the handle
+    req->batch_.wait();
+    delete req;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::sendNotif(nixlShmConnection &conn, const std::string &msg) const {
+    const auto deadline = std::chrono::steady_clock::now() + kNotifTimeout;
+    for (;;) {
+        const nixl_status_t ret = conn.ring_->push(localAgent, msg);
+        if (ret == NIXL_ERR_INVALID_PARAM) {
+            NIXL_ERROR << absl::StrFormat(
+                "Notification of %d bytes does not fit in %s", msg.size(), conn.ringName_);
+        }
+        if (ret != NIXL_IN_PROG) {
+            return ret;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+            NIXL_ERROR << absl::StrFormat("Notification ring %s is full", conn.ringName_);
+            return NIXL_ERR_BACKEND;
+        }
+        std::this_thread::yield();
+    }
+}
+
+nixl_status_t
+nixlShmEngine::genNotif(const std::string &remote_agent, const std::string &msg) const {
+    auto conn = getConnection(remote_agent);
+    if (!conn) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+    return sendNotif(*conn, msg);
+}
+
+nixl_status_t
+nixlShmEngine::getNotifs(notif_list_t &notif_list) {
+    if (!notif_list.empty()) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    return ring_->drain(notif_list);
+}
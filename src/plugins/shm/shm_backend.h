@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_SHM_SHM_BACKEND_H
+#define NIXL_SRC_PLUGINS_SHM_SHM_BACKEND_H
+
+#include <sys/types.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "backend/backend_engine.h"
+#include "shm_copy.h"
+#include "shm_ring.h"
+
+class nixlShmMetadata : public nixlBackendMD {
+public:
+    nixlShmMetadata(bool is_private, uintptr_t addr, size_t len, int node)
+        : nixlBackendMD(is_private),
+          addr_(addr),
+          len_(len),
+          node_(node) {}
+
+    [[nodiscard]] bool
+    isPrivate() const noexcept {
+        return isPrivateMD;
+    }
+
+    const uintptr_t addr_;
+    const size_t len_;
+    const int node_; // NUMA node of the start of a local region, -1 for remote ones
+};
+
+// An agent of the same host, its ring is mapped on connect
+struct nixlShmConnection {
+    pid_t pid_;
+    bool sameProcess_;
+    std::string ringName_;
+    std::shared_ptr<nixlShmRing> ring_;
+};
+
+class nixlShmBackendReqH : public nixlBackendReqH {
+public:
+    // A range of segments which is copied by a single worker
+    struct range {
+        size_t first;
+        size_t last;
+        int node;
+    };
+
+    nixlShmBackendReqH(std::shared_ptr<nixlShmConnection> conn) : conn_(std::move(conn)) {}
+
+    std::shared_ptr<nixlShmConnection> conn_;
+    nixlShmCopyBatch batch_;
+    std::vector<range> ranges_;
+    size_t totalBytes_ = 0;
+};
+
+class nixlShmEngine : public nixlBackendEngine {
+public:
+    nixlShmEngine(const nixlBackendInitParams *init_params);
+    ~nixlShmEngine();
+
+    bool
+    supportsRemote() const override {
+        return true;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return true;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG};
+    }
+
+    nixl_status_t
+    getConnInfo(std::string &str) const override;
+
+    nixl_status_t
+    loadRemoteConnInfo(const std::string &remote_agent,
+                       const std::string &remote_conn_info) override;
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override;
+
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override;
+
+    nixl_status_t
+    getPublicData(const nixlBackendMD *meta, std::string &str) const override;
+
+    nixl_status_t
+    loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override {
+        output = input;
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    loadRemoteMD(const nixlBlobDesc &input,
+                 const nixl_mem_t &nixl_mem,
+                 const std::string &remote_agent,
+                 nixlBackendMD *&output) override;
+
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override;
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    bool
+    supportsXferSpans() const override {
+        return true;
+    }
+
+    nixl_status_t
+    prepXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+
+    nixl_status_t
+    genNotif(const std::string &remote_agent, const std::string &msg) const override;
+
+private:
+    [[nodiscard]] std::shared_ptr<nixlShmConnection>
+    getConnection(const std::string &remote_agent) const;
+
+    [[nodiscard]] nixl_status_t
+    sendNotif(nixlShmConnection &conn, const std::string &msg) const;
+
+    size_t chunkSize_;
+    size_t inlineThreshold_;
+    std::unique_ptr<nixlCopyEngine> copyEngine_;
+    std::shared_ptr<nixlShmRing> ring_;
+    std::mutex ringMutex_; // Serializes the draining of ring_
+    std::string hostId_;
+    mutable std::mutex connMutex_;
+    mutable std::unordered_map<std::string, std::shared_ptr<nixlShmConnection>> conns_;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_copy.h"
+
+#include <sys/uio.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+constexpr size_t kMaxIovs = IOV_MAX;
+
+[[nodiscard]] nixl_status_t
+cmaError(int err, pid_t pid) {
+    switch (err) {
+    case ESRCH:
+        NIXL_ERROR << absl::StrFormat("Peer process %d is gone", pid);
+        return NIXL_ERR_REMOTE_DISCONNECT;
+    case EPERM:
+        NIXL_ERROR << absl::StrFormat(
+            "Not permitted to access the memory of process %d, the processes need the same "
+            "user and a ptrace scope which allows it, see the allow_ptrace_peers parameter",
+            pid);
+        return NIXL_ERR_BACKEND;
+    default:
+        NIXL_ERROR << absl::StrFormat(
+            "Copy with process %d failed: %s", pid, strerror(err));
+        return NIXL_ERR_BACKEND;
+    }
+}
+} // namespace
+
+void
+nixlShmCopyBatch::init(nixl_xfer_op_t op, pid_t remote_pid, bool same_process) {
+    op_ = op;
+    remotePid_ = remote_pid;
+    sameProcess_ = same_process;
+    segments_.clear();
+}
+
+nixl_status_t
+nixlShmCopyBatch::copy(size_t first, size_t last) const {
+    if (!sameProcess_) {
+        return copyRemote(first, last);
+    }
+
+    for (size_t i = first; i < last; ++i) {
+        const nixlShmSegment &seg = segments_[i];
+        if (op_ == NIXL_READ) {
+            memcpy(reinterpret_cast<void *>(seg.local),
+                   reinterpret_cast<const void *>(seg.remote),
+                   seg.len);
+        } else {
+            memcpy(reinterpret_cast<void *>(seg.remote),
+                   reinterpret_cast<const void *>(seg.local),
+                   seg.len);
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmCopyBatch::copyRemote(size_t first, size_t last) const {
+    struct iovec local_iovs[kMaxIovs];
+    struct iovec remote_iovs[kMaxIovs];
+    size_t i = first;
+    size_t offset = 0; // Already copied bytes of segment i
+
+    while (i < last) {
+        size_t count = 0;
+        for (size_t j = i; (j < last) && (count < kMaxIovs); ++j, ++count) {
+            const nixlShmSegment &seg = segments_[j];
+            const size_t skip = (j == i) ? offset : 0;
+            local_iovs[count].iov_base = reinterpret_cast<void *>(seg.local + skip);
+            local_iovs[count].iov_len = seg.len - skip;
+            remote_iovs[count].iov_base = reinterpret_cast<void *>(seg.remote + skip);
+            remote_iovs[count].iov_len = seg.len - skip;
+        }
+
+        const ssize_t ret = (op_ == NIXL_READ) ?
+            process_vm_readv(remotePid_, local_iovs, count, remote_iovs, count, 0) :
+            process_vm_writev(remotePid_, local_iovs, count, remote_iovs, count, 0);
+        if (ret < 0) {
+            return cmaError(errno, remotePid_);
+        }
+        if (ret == 0) {
+            return cmaError(EFAULT, remotePid_);
+        }
+
+        // Partial copies stop at the first inaccessible iovec, resume from there
+        size_t copied = ret;
+        while (copied > 0) {
+            const size_t left = segments_[i].len - offset;
+            if (copied < left) {
+                offset += copied;
+                break;
+            }
+            copied -= left;
+            offset = 0;
+            ++i;
+        }
+    }
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_SHM_SHM_COPY_H
+#define NIXL_SRC_PLUGINS_SHM_SHM_COPY_H
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <vector>
+#include "common/copy_engine.h"
+#include "nixl_types.h"
+
+// A contiguous piece of a transfer, no larger than the chunk size of the engine
+struct nixlShmSegment {
+    uintptr_t local;
+    uintptr_t remote;
+    size_t len;
+};
+
+/**
+ * @class nixlShmCopyBatch
+ * @brief The segments of one posted transfer. Same process copies use memcpy, other processes
+ *        are accessed through CMA. The copy engine queues a range to a worker on the node of
+ *        its local memory, so that only the peer side of the copy crosses the interconnect.
+ */
+class nixlShmCopyBatch : public nixlCopyBatch {
+public:
+    void
+    init(nixl_xfer_op_t op, pid_t remote_pid, bool same_process);
+
+    std::vector<nixlShmSegment> &
+    getSegments() noexcept {
+        return segments_;
+    }
+
+    // Arms the batch for the given number of ranges, at most one post may be in flight
+    void
+    start(size_t ranges, done_cb_t done_cb) {
+        arm(ranges, std::move(done_cb));
+    }
+
+private:
+    [[nodiscard]] nixl_status_t
+    copy(size_t first, size_t last) const override;
+
+    [[nodiscard]] nixl_status_t
+    copyRemote(size_t first, size_t last) const;
+
+    nixl_xfer_op_t op_ = NIXL_WRITE;
+    pid_t remotePid_ = 0;
+    bool sameProcess_ = true;
+    std::vector<nixlShmSegment> segments_;
+};
+
+#endif
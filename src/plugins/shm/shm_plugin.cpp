@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_backend.h"
+#include "backend/backend_plugin.h"
+
+// Plugin type alias for convenience
+using shm_plugin_t = nixlBackendPluginCreator<nixlShmEngine>;
+
+namespace {
+nixl_b_params_t
+getShmBackendOptions() {
+    return {{"num_threads", "4"},
+            {"numa_aware", "true"},
+            {"chunk_size", "1048576"},
+            {"inline_threshold", "65536"},
+            {"ring_slots", "4096"},
+            {"allow_ptrace_peers", "false"}};
+}
+} // namespace
+
+#ifdef STATIC_PLUGIN_SHM
+nixlBackendPlugin *
+createStaticSHMPlugin() {
+    return shm_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "SHM", "0.1.0", getShmBackendOptions(), {DRAM_SEG});
+}
+#else
+extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
+nixl_plugin_init() {
+    return shm_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "SHM", "0.1.0", getShmBackendOptions(), {DRAM_SEG});
+}
+
+extern "C" NIXL_PLUGIN_EXPORT void
+nixl_plugin_fini() {}
+#endif
@@ -0,0 +1,271 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <random>
+
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+constexpr uint64_t kRingMagic = 0x676e69526d68734eULL; // "NshmRing"
+constexpr uint32_t kRingVersion = 1;
+constexpr uint32_t kMinSlots = 64;
+constexpr uint32_t kMaxSlots = 1u << 20;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "The ring is shared between processes and requires lock-free atomics");
+
+[[nodiscard]] uint32_t
+roundUpSlots(uint32_t slot_count) {
+    uint32_t slots = kMinSlots;
+    while (slots < slot_count && slots < kMaxSlots) {
+        slots <<= 1;
+    }
+    return slots;
+}
+} // namespace
+
+struct nixlShmRing::header {
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t slotCount;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+struct alignas(64) nixlShmRing::slot {
+    static constexpr size_t kDataSize = kSlotSize - 16;
+
+    std::atomic<uint64_t> seq;
+    uint32_t len; // Bytes of the notification, in its first slot only
+    uint32_t count; // Slots of the notification, in its first slot only
+    char data[kDataSize];
+};
+
+nixlShmRing::nixlShmRing(std::string name, void *base, size_t size, bool owner)
+    : name_(std::move(name)),
+      base_(base),
+      size_(size),
+      owner_(owner),
+      header_(static_cast<header *>(base)),
+      slots_(reinterpret_cast<slot *>(static_cast<char *>(base) + kSlotSize)),
+      mask_(header_->slotCount - 1) {}
+
+nixlShmRing::~nixlShmRing() {
+    munmap(base_, size_);
+    if (owner_) {
+        shm_unlink(name_.c_str());
+    }
+}
+
+std::unique_ptr<nixlShmRing>
+nixlShmRing::create(uint32_t slot_count) {
+    static_assert(sizeof(header) <= kSlotSize);
+    static_assert(sizeof(slot) == kSlotSize);
+    const uint32_t slots = roundUpSlots(slot_count);
+    const size_t size = kSlotSize * (size_t(slots) + 1);
+
+    std::random_device rd;
+    const std::string name =
+        absl::StrFormat("/nixl_shm_%d_%08x%08x", getpid(), uint32_t(rd()), uint32_t(rd()));
+
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        NIXL_ERROR << absl::StrFormat("shm_open(%s) failed: %s", name, strerror(errno));
+        return nullptr;
+    }
+
+    void *base = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) {
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int err = errno;
+    close(fd);
+    if (base == MAP_FAILED) {
+        NIXL_ERROR << absl::StrFormat("Failed to map %s: %s", name, strerror(err));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    auto *hdr = new (base) header;
+    hdr->version = kRingVersion;
+    hdr->slotCount = slots;
+    hdr->tail.store(0, std::memory_order_relaxed);
+    auto *first = reinterpret_cast<slot *>(static_cast<char *>(base) + kSlotSize);
+    for (uint32_t i = 0; i < slots; ++i) {
+        auto *s = new (first + i) slot;
+        s->seq.store(i, std::memory_order_relaxed);
+    }
+    hdr->magic.store(kRingMagic, std::memory_order_release);
+
+    return std::unique_ptr<nixlShmRing>(new nixlShmRing(name, base, size, true));
+}
+
+std::unique_ptr<nixlShmRing>
+nixlShmRing::attach(const std::string &name) {
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        NIXL_ERROR << absl::StrFormat("shm_open(%s) failed: %s", name, strerror(errno));
+        return nullptr;
+    }
+
+    struct stat st;
+    void *base = MAP_FAILED;
+    if ((fstat(fd, &st) == 0) && (size_t(st.st_size) >= 2 * kSlotSize)) {
+        base = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED) {
+        NIXL_ERROR << absl::StrFormat("Failed to map %s", name);
+        return nullptr;
+    }
+
+    const auto *hdr = static_cast<const header *>(base);
+    const uint32_t slots = hdr->slotCount;
+    if ((hdr->magic.load(std::memory_order_acquire) != kRingMagic) ||
+        (hdr->version != kRingVersion) || (slots != roundUpSlots(slots)) ||
+        (size_t(st.st_size) != kSlotSize * (size_t(slots) + 1))) {
+        NIXL_ERROR << absl::StrFormat("%s is not a compatible notification ring", name);
+        munmap(base, st.st_size);
+        return nullptr;
+    }
+
+    return std::unique_ptr<nixlShmRing>(new nixlShmRing(name, base, st.st_size, false));
+}
+
+nixlShmRing::slot &
+nixlShmRing::getSlot(uint64_t pos) const noexcept {
+    return slots_[pos & mask_];
+}
+
+void
+nixlShmRing::copyIn(uint64_t pos, size_t offset, const void *src, size_t len) noexcept {
+    const char *from = static_cast<const char *>(src);
+    while (len > 0) {
+        const size_t in_slot = offset % slot::kDataSize;
+        const size_t n = std::min(len, slot::kDataSize - in_slot);
+        memcpy(getSlot(pos + offset / slot::kDataSize).data + in_slot, from, n);
+        from += n;
+        offset += n;
+        len -= n;
+    }
+}
+
+void
+nixlShmRing::copyOut(uint64_t pos, size_t offset, void *dst, size_t len) const noexcept {
+    char *to = static_cast<char *>(dst);
+    while (len > 0) {
+        const size_t in_slot = offset % slot::kDataSize;
+        const size_t n = std::min(len, slot::kDataSize - in_slot);
+        memcpy(to, getSlot(pos + offset / slot::kDataSize).data + in_slot, n);
+        to += n;
+        offset += n;
+        len -= n;
+    }
+}
+
+nixl_status_t
+nixlShmRing::push(const std::string &agent, const std::string &msg) {
+    // A notification is the length of the agent name, the agent name and the message
+    const uint32_t agent_len = agent.size();
+    const size_t len = sizeof(agent_len) + agent.size() + msg.size();
+    const uint64_t count = std::max<uint64_t>(1, (len + slot::kDataSize - 1) / slot::kDataSize);
+    if (count > mask_ + 1) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Claim count consecutive slots, all of them have to be free in the current lap
+    uint64_t pos = header_->tail.load(std::memory_order_relaxed);
+    for (;;) {
+        bool claimable = true;
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint64_t seq = getSlot(pos + i).seq.load(std::memory_order_acquire);
+            const int64_t diff = int64_t(seq - (pos + i));
+            if (diff < 0) {
+                return NIXL_IN_PROG; // Not consumed yet
+            }
+            if (diff > 0) {
+                claimable = false; // Claimed by another producer
+                break;
+            }
+        }
+        if (claimable) {
+            if (header_->tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                break;
+            }
+        } else {
+            pos = header_->tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    copyIn(pos, 0, &agent_len, sizeof(agent_len));
+    copyIn(pos, sizeof(agent_len), agent.data(), agent.size());
+    copyIn(pos, sizeof(agent_len) + agent.size(), msg.data(), msg.size());
+
+    // The first slot is published last, so that the whole notification is visible with it
+    for (uint64_t i = count - 1; i > 0; --i) {
+        getSlot(pos + i).seq.store(pos + i + 1, std::memory_order_release);
+    }
+    slot &first = getSlot(pos);
+    first.len = len;
+    first.count = count;
+    first.seq.store(pos + 1, std::memory_order_release);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmRing::drain(notif_list_t &notif_list) {
+    for (;;) {
+        slot &first = getSlot(head_);
+        if (first.seq.load(std::memory_order_acquire) != head_ + 1) {
+            return NIXL_SUCCESS;
+        }
+
+        const uint64_t count = first.count;
+        const size_t len = first.len;
+        uint32_t agent_len = 0;
+        if ((count == 0) || (count > mask_ + 1) || (len > count * slot::kDataSize) ||
+            (len < sizeof(agent_len))) {
+            NIXL_ERROR << absl::StrFormat("Corrupted notification in %s", name_);
+            return NIXL_ERR_BACKEND;
+        }
+        copyOut(head_, 0, &agent_len, sizeof(agent_len));
+        if (agent_len > len - sizeof(agent_len)) {
+            NIXL_ERROR << absl::StrFormat("Corrupted notification in %s", name_);
+            return NIXL_ERR_BACKEND;
+        }
+
+        std::string agent(agent_len, '\0');
+        std::string msg(len - sizeof(agent_len) - agent_len, '\0');
+        copyOut(head_, sizeof(agent_len), agent.data(), agent.size());
+        copyOut(head_, sizeof(agent_len) + agent.size(), msg.data(), msg.size());
+        notif_list.emplace_back(std::move(agent), std::move(msg));
+
+        for (uint64_t i = 0; i < count; ++i) {
+            getSlot(head_ + i).seq.store(head_ + i + mask_ + 1, std::memory_order_release);
+        }
+        head_ += count;
+    }
+}
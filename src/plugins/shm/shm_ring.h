@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_SHM_SHM_RING_H
+#define NIXL_SRC_PLUGINS_SHM_SHM_RING_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "backend/backend_aux.h"
+
+/**
+ * @class nixlShmRing
+ * @brief A bounded ring of notifications in POSIX shared memory, written by the agents of any
+ *        process of the host and read by the agent which created it. A notification takes
+ *        one or more consecutive slots, which are claimed by a producer with a single CAS on
+ *        the tail and published by sequence numbers, so producers never take a lock.
+ */
+class nixlShmRing {
+public:
+    // Creates a ring of at least slot_count slots under a unique name, which is unlinked
+    // when the ring is destroyed. Returns nullptr on failure.
+    [[nodiscard]] static std::unique_ptr<nixlShmRing>
+    create(uint32_t slot_count);
+
+    // Maps the ring created by another agent. Returns nullptr on failure.
+    [[nodiscard]] static std::unique_ptr<nixlShmRing>
+    attach(const std::string &name);
+
+    ~nixlShmRing();
+
+    nixlShmRing(const nixlShmRing &) = delete;
+    nixlShmRing &
+    operator=(const nixlShmRing &) = delete;
+
+    [[nodiscard]] const std::string &
+    getName() const noexcept {
+        return name_;
+    }
+
+    // Safe to call concurrently from any process. Returns NIXL_IN_PROG when the ring has
+    // no room left at the moment, and NIXL_ERR_INVALID_PARAM when the notification could
+    // never fit.
+    [[nodiscard]] nixl_status_t
+    push(const std::string &agent, const std::string &msg);
+
+    // Appends all the published notifications, only the creator of the ring may drain it
+    // and not concurrently.
+    [[nodiscard]] nixl_status_t
+    drain(notif_list_t &notif_list);
+
+    static constexpr size_t kSlotSize = 256;
+
+private:
+    struct header;
+    struct slot;
+
+    nixlShmRing(std::string name, void *base, size_t size, bool owner);
+
+    [[nodiscard]] slot &
+    getSlot(uint64_t pos) const noexcept;
+
+    void
+    copyIn(uint64_t pos, size_t offset, const void *src, size_t len) noexcept;
+
+    void
+    copyOut(uint64_t pos, size_t offset, void *dst, size_t len) const noexcept;
+
+    const std::string name_;
+    void *const base_;
+    const size_t size_;
+    const bool owner_;
+    header *const header_;
+    slot *const slots_;
+    const uint64_t mask_;
+    uint64_t head_ = 0; // Only advanced by the creator
+};
+
+#endif
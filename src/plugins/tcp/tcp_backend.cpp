@@ -0,0 +1,625 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tcp_backend.h"
+
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+#include "serdes/serdes.h"
+
+namespace {
+constexpr size_t kDefaultNumThreads = 2;
+constexpr size_t kDefaultNumStreams = 4;
+constexpr size_t kDefaultStripeSize = 1024 * 1024;
+constexpr size_t kDefaultZerocopyThreshold = 32 * 1024;
+constexpr int kListenBacklog = 128;
+constexpr int kConnectTimeoutMs = 5000;
+
+struct nixlTcpPublicData {
+    uint64_t addr;
+    uint64_t len;
+};
+
+template<typename T>
+[[nodiscard]] T
+getParam(const nixl_b_params_t *custom_params, const std::string &key, T default_value) {
+    if (!custom_params) {
+        return default_value;
+    }
+
+    const auto it = custom_params->find(key);
+    if (it == custom_params->end()) {
+        return default_value;
+    }
+
+    T result;
+    if constexpr (std::is_same_v<T, bool>) {
+        return absl::SimpleAtob(it->second, &result) ? result : default_value;
+    } else {
+        return absl::SimpleAtoi(it->second, &result) ? result : default_value;
+    }
+}
+
+// First IPv4 address of an interface which is up, other than loopback
+[[nodiscard]] std::string
+findLocalIpAddress() {
+    struct ifaddrs *ifaddr;
+    if (getifaddrs(&ifaddr) != 0) {
+        return "127.0.0.1";
+    }
+
+    std::string ip = "127.0.0.1";
+    for (struct ifaddrs *ifa = ifaddr; ifa; ifa = ifa->ifa_next) {
+        if (!ifa->ifa_addr || (ifa->ifa_addr->sa_family != AF_INET) ||
+            (ifa->ifa_flags & IFF_LOOPBACK) || !(ifa->ifa_flags & IFF_UP) ||
+            !(ifa->ifa_flags & IFF_RUNNING)) {
+            continue;
+        }
+
+        char host[INET_ADDRSTRLEN];
+        const auto *sin = reinterpret_cast<const struct sockaddr_in *>(ifa->ifa_addr);
+        if (inet_ntop(AF_INET, &sin->sin_addr, host, sizeof(host))) {
+            ip = host;
+            break;
+        }
+    }
+
+    freeifaddrs(ifaddr);
+    return ip;
+}
+
+bool
+isValidPrepXferParams(const nixl_xfer_op_t &operation,
+                      const nixl_meta_span_t &local,
+                      const nixl_meta_span_t &remote) {
+    if (operation != NIXL_WRITE && operation != NIXL_READ) {
+        NIXL_ERROR << absl::StrFormat("Error: Invalid operation type: %d", operation);
+        return false;
+    }
+
+    if ((local.getType() != DRAM_SEG) || (remote.getType() != DRAM_SEG)) {
+        NIXL_ERROR << absl::StrFormat("Error: Memory types must be DRAM_SEG, got %d and %d",
+                                      local.getType(),
+                                      remote.getType());
+        return false;
+    }
+
+    if (local.descCount() != remote.descCount()) {
+        NIXL_ERROR << absl::StrFormat(
+            "Error: Mismatch in descriptor counts - local: %d, remote: %d",
+            local.descCount(),
+            remote.descCount());
+        return false;
+    }
+
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            NIXL_ERROR << absl::StrFormat(
+                "Error: Mismatch in length of descriptor %d - local: %d, remote: %d",
+                i,
+                local[i].len,
+                remote[i].len);
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+nixlTcpEngine::nixlTcpEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    const nixl_b_params_t *custom_params = init_params->customParams;
+    numStreams_ = std::max<size_t>(1, getParam(custom_params, "num_streams", kDefaultNumStreams));
+    stripeSize_ =
+        std::max<size_t>(1, getParam(custom_params, "stripe_size", kDefaultStripeSize));
+    zerocopy_ = getParam(custom_params, "zerocopy", true);
+
+    if (custom_params) {
+        const auto it = custom_params->find("ip_addr");
+        if (it != custom_params->end()) {
+            ip_ = it->second;
+        }
+    }
+    if (ip_.empty()) {
+        ip_ = findLocalIpAddress();
+    }
+
+    listenFd_ = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(static_cast<uint16_t>(getParam<uint32_t>(custom_params, "port", 0)));
+    socklen_t addr_len = sizeof(addr);
+    const int one = 1;
+    if ((listenFd_ < 0) ||
+        (setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0) ||
+        (bind(listenFd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) ||
+        (listen(listenFd_, kListenBacklog) != 0) ||
+        (getsockname(listenFd_, reinterpret_cast<struct sockaddr *>(&addr), &addr_len) != 0)) {
+        NIXL_ERROR << "Failed to listen for TCP streams: " << strerror(errno);
+        initErr = true;
+        return;
+    }
+    port_ = ntohs(addr.sin_port);
+
+    try {
+        const size_t num_threads =
+            std::max<size_t>(1, getParam(custom_params, "num_threads", kDefaultNumThreads));
+        const size_t zc_threshold =
+            getParam(custom_params, "zerocopy_threshold", kDefaultZerocopyThreshold);
+        nixlTcpHandler &handler = *this;
+        for (size_t i = 0; i < num_threads; ++i) {
+            workers_.push_back(
+                std::make_unique<nixlTcpWorker>(handler, zc_threshold, (i == 0) ? listenFd_ : -1));
+        }
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << e.what();
+        initErr = true;
+        return;
+    }
+
+    NIXL_DEBUG << absl::StrFormat("TCP backend of agent '%s' listens on %s:%d",
+                                  localAgent,
+                                  ip_,
+                                  port_);
+}
+
+nixlTcpEngine::~nixlTcpEngine() {
+    // Workers fail the operations still in flight when they stop
+    workers_.clear();
+    if (listenFd_ >= 0) {
+        close(listenFd_);
+    }
+}
+
+nixlTcpWorker &
+nixlTcpEngine::nextWorker() const {
+    return *workers_[nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+}
+
+nixl_status_t
+nixlTcpEngine::getConnInfo(std::string &str) const {
+    nixlSerDes sd;
+    sd.addStr("ip", ip_);
+    sd.addBuf("port", &port_, sizeof(port_));
+    str = sd.exportStr();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                  const std::string &remote_conn_info) {
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+
+    nixlSerDes sd;
+    uint16_t port;
+    std::string ip;
+    if ((sd.importStr(remote_conn_info) != NIXL_SUCCESS) || (ip = sd.getStr("ip")).empty() ||
+        (sd.getBuf("port", &port, sizeof(port)) != NIXL_SUCCESS)) {
+        NIXL_ERROR << "Invalid TCP connection info of agent " << remote_agent;
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(peerMutex_);
+    auto &peer = peers_[remote_agent];
+    if (peer && (peer->ip_ == ip) && (peer->port_ == port)) {
+        return NIXL_SUCCESS;
+    }
+    if (peer) {
+        for (const auto &stream : peer->streams_) {
+            stream->getWorker().close(stream);
+        }
+    }
+    peer = std::make_shared<nixlTcpPeer>(nixlTcpPeer{ip, port, {}});
+    return NIXL_SUCCESS;
+}
+
+std::shared_ptr<nixlTcpConnection>
+nixlTcpEngine::openStream(const nixlTcpPeer &peer) const {
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(peer.port_);
+    if (inet_pton(AF_INET, peer.ip_.c_str(), &addr.sin_addr) != 1) {
+        NIXL_ERROR << "Invalid IPv4 address " << peer.ip_;
+        return nullptr;
+    }
+
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        NIXL_ERROR << "Failed to create a TCP socket: " << strerror(errno);
+        return nullptr;
+    }
+
+    int err = 0;
+    if (::connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) {
+        err = errno;
+        if (err == EINPROGRESS) {
+            struct pollfd pfd = {fd, POLLOUT, 0};
+            socklen_t err_len = sizeof(err);
+            if (poll(&pfd, 1, kConnectTimeoutMs) != 1) {
+                err = ETIMEDOUT;
+            } else if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &err_len) != 0) {
+                err = errno;
+            }
+        }
+    }
+    if (err != 0) {
+        NIXL_ERROR << absl::StrFormat(
+            "Failed to connect to %s:%d: %s", peer.ip_, peer.port_, strerror(err));
+        close(fd);
+        return nullptr;
+    }
+
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    const bool zc = zerocopy_ && (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0);
+
+    auto conn = std::make_shared<nixlTcpConnection>(fd, zc, nextWorker());
+    std::vector<nixlTcpSendItem> hello(1);
+    hello[0].hdr = nixlTcpWorker::makeHeader(nixl_tcp_msg_t::HELLO, 0, 0, localAgent.size());
+    hello[0].data = localAgent;
+    conn->getWorker().adopt(conn, std::move(hello));
+    return conn;
+}
+
+std::shared_ptr<nixlTcpPeer>
+nixlTcpEngine::getPeer(const std::string &remote_agent) const {
+    std::lock_guard<std::mutex> lock(peerMutex_);
+    auto it = peers_.find(remote_agent);
+    if (it == peers_.end()) {
+        if (remote_agent != localAgent) {
+            NIXL_ERROR << "No TCP connection info of agent " << remote_agent;
+            return nullptr;
+        }
+        it = peers_.emplace(localAgent, std::make_shared<nixlTcpPeer>(nixlTcpPeer{ip_, port_, {}}))
+                 .first;
+    }
+
+    auto &peer = it->second;
+    const bool alive = !peer->streams_.empty() &&
+        std::all_of(peer->streams_.begin(), peer->streams_.end(), [](const auto &stream) {
+                           return stream->isAlive();
+                       });
+    if (alive) {
+        return peer;
+    }
+
+    // Streams are reopened together, handles keep the previous ones until released
+    auto fresh = std::make_shared<nixlTcpPeer>(nixlTcpPeer{peer->ip_, peer->port_, {}});
+    for (size_t i = 0; i < numStreams_; ++i) {
+        auto stream = openStream(*fresh);
+        if (!stream) {
+            for (const auto &opened : fresh->streams_) {
+                opened->getWorker().close(opened);
+            }
+            return nullptr;
+        }
+        fresh->streams_.push_back(std::move(stream));
+    }
+    for (const auto &stream : peer->streams_) {
+        stream->getWorker().close(stream);
+    }
+    peer = fresh;
+    return peer;
+}
+
+nixl_status_t
+nixlTcpEngine::connect(const std::string &remote_agent) {
+    return getPeer(remote_agent) ? NIXL_SUCCESS : NIXL_ERR_NOT_FOUND;
+}
+
+nixl_status_t
+nixlTcpEngine::disconnect(const std::string &remote_agent) {
+    std::lock_guard<std::mutex> lock(peerMutex_);
+    const auto it = peers_.find(remote_agent);
+    if (it == peers_.end()) {
+        return NIXL_SUCCESS;
+    }
+
+    for (const auto &stream : it->second->streams_) {
+        stream->getWorker().close(stream);
+    }
+    it->second = std::make_shared<nixlTcpPeer>(nixlTcpPeer{it->second->ip_, it->second->port_, {}});
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::registerMem(const nixlBlobDesc &mem,
+                           const nixl_mem_t &nixl_mem,
+                           nixlBackendMD *&out) {
+    if (nixl_mem != DRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(regMutex_);
+        regions_.emplace(mem.addr, mem.len);
+        maxRegionLen_ = std::max(maxRegionLen_, mem.len);
+    }
+    out = new nixlTcpMetadata(true, mem.addr, mem.len);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::deregisterMem(nixlBackendMD *meta) {
+    auto *md = static_cast<nixlTcpMetadata *>(meta);
+    {
+        std::unique_lock<std::shared_mutex> lock(regMutex_);
+        auto [first, last] = regions_.equal_range(md->addr_);
+        const auto it = std::find_if(
+            first, last, [md](const auto &region) { return region.second == md->len_; });
+        if (it != last) {
+            regions_.erase(it);
+        }
+    }
+    delete md;
+    return NIXL_SUCCESS;
+}
+
+bool
+nixlTcpEngine::isAccessible(uintptr_t addr, size_t len) const {
+    if (addr + len < addr) {
+        return false;
+    }
+
+    // Regions may overlap, so all those which start close enough are checked
+    std::shared_lock<std::shared_mutex> lock(regMutex_);
+    for (auto it = regions_.upper_bound(addr); it != regions_.begin();) {
+        --it;
+        if (it->first + it->second >= addr + len) {
+            return true;
+        }
+        if (addr - it->first > maxRegionLen_) {
+            break;
+        }
+    }
+    return false;
+}
+
+nixl_status_t
+nixlTcpEngine::getPublicData(const nixlBackendMD *meta, std::string &str) const {
+    const auto *md = static_cast<const nixlTcpMetadata *>(meta);
+    const nixlTcpPublicData data{md->addr_, md->len_};
+    str = nixlSerDes::_bytesToString(&data, sizeof(data));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::loadRemoteMD(const nixlBlobDesc &input,
+                            const nixl_mem_t &nixl_mem,
+                            const std::string &remote_agent,
+                            nixlBackendMD *&output) {
+    if ((nixl_mem != DRAM_SEG) || (input.metaInfo.size() != sizeof(nixlTcpPublicData))) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    nixlTcpPublicData data;
+    nixlSerDes::_stringToBytes(&data, input.metaInfo, sizeof(data));
+    output = new nixlTcpMetadata(false, data.addr, data.len);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::unloadMD(nixlBackendMD *input) {
+    // Local metadata is loaded as the private one, which is released on deregistration
+    auto *md = static_cast<nixlTcpMetadata *>(input);
+    if (!md->isPrivate()) {
+        delete md;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::prepXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return prepXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlTcpEngine::postXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return postXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlTcpEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    if (!isValidPrepXferParams(operation, local, remote)) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto peer = getPeer(remote_agent);
+    if (!peer) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    auto req = std::make_unique<nixlTcpBackendReqH>(peer);
+
+    // Descriptors larger than the stripe size are split, and pieces are spread over streams
+    size_t stream = nextOpId_.load(std::memory_order_relaxed);
+    for (int i = 0; i < local.descCount(); ++i) {
+        for (size_t offset = 0; offset < local[i].len; offset += stripeSize_) {
+            const size_t len = std::min(stripeSize_, local[i].len - offset);
+            nixlTcpOp op = {};
+            op.op = operation;
+            op.local = local[i].addr + offset;
+            op.remote = remote[i].addr + offset;
+            op.len = len;
+            op.batch = &req->batch_;
+            req->ops_.push_back(op);
+            req->opStreams_.push_back(stream++ % peer->streams_.size());
+        }
+    }
+
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    auto *req = static_cast<nixlTcpBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    // The notification follows the replies of all the operations, so it is delivered
+    // after the data
+    const bool has_notif = opt_args && opt_args->hasNotif;
+    auto done_cb = [this, req, has_notif, msg = has_notif ? opt_args->notifMsg : nixl_blob_t()](
+                       nixl_status_t status) {
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+        req->xferDone.mark();
+        if (has_notif) {
+            status = sendNotif(*req->peer_, msg);
+            if (status == NIXL_SUCCESS) {
+                req->notifDone.mark();
+            }
+        }
+        return status;
+    };
+
+    const auto &streams = req->peer_->streams_;
+    std::vector<std::vector<nixlTcpSendItem>> items(streams.size());
+    for (size_t i = 0; i < req->ops_.size(); ++i) {
+        nixlTcpOp &op = req->ops_[i];
+        nixlTcpSendItem item;
+        item.hdr = nixlTcpWorker::makeHeader(
+            (op.op == NIXL_WRITE) ? nixl_tcp_msg_t::WRITE : nixl_tcp_msg_t::READ,
+            nextOpId_.fetch_add(1, std::memory_order_relaxed),
+            op.remote,
+            op.len);
+        if (op.op == NIXL_WRITE) {
+            item.payload = reinterpret_cast<const char *>(op.local);
+        }
+        item.op = &op;
+        items[req->opStreams_[i]].push_back(std::move(item));
+    }
+
+    req->batch_.start(req->ops_.size(), std::move(done_cb));
+    for (size_t s = 0; s < streams.size(); ++s) {
+        if (!items[s].empty()) {
+            streams[s]->getWorker().send(streams[s], std::move(items[s]));
+        }
+    }
+
+    return req->batch_.isDone() ? req->batch_.getStatus() : NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlTcpEngine::checkXfer(nixlBackendReqH *handle) const {
+    const auto *req = static_cast<const nixlTcpBackendReqH *>(handle);
+    if (!req->batch_.isDone()) {
+        return NIXL_IN_PROG;
+    }
+    return req->batch_.getStatus();
+}
+
+nixl_status_t
+nixlTcpEngine::releaseReqH(nixlBackendReqH *handle) const {
+    auto *req = static_cast<nixlTcpBackendReqH *>(handle);
+    // Operations complete or fail when their stream closes, wait for the workers to be done
+    req->batch_.wait();
+    delete req;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::sendNotif(const nixlTcpPeer &peer, const std::string &msg) const {
+    const auto &stream = peer.streams_.front();
+    if (!stream->isAlive()) {
+        return NIXL_ERR_REMOTE_DISCONNECT;
+    }
+
+    std::vector<nixlTcpSendItem> items(1);
+    items[0].hdr = nixlTcpWorker::makeHeader(nixl_tcp_msg_t::NOTIF, 0, 0, msg.size());
+    items[0].data = msg;
+    stream->getWorker().send(stream, std::move(items));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpEngine::genNotif(const std::string &remote_agent, const std::string &msg) const {
+    auto peer = getPeer(remote_agent);
+    if (!peer) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+    return sendNotif(*peer, msg);
+}
+
+nixl_status_t
+nixlTcpEngine::getNotifs(notif_list_t &notif_list) {
+    if (!notif_list.empty()) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    notif_list.swap(notifs_);
+    return NIXL_SUCCESS;
+}
+
+void
+nixlTcpEngine::onNotif(std::string agent, std::string msg) {
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    notifs_.emplace_back(std::move(agent), std::move(msg));
+}
+
+void
+nixlTcpEngine::onAccept(int fd) {
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    const bool zc = zerocopy_ && (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0);
+
+    auto conn = std::make_shared<nixlTcpConnection>(fd, zc, nextWorker());
+    conn->getWorker().adopt(conn);
+}
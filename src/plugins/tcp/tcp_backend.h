@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_TCP_TCP_BACKEND_H
+#define NIXL_SRC_PLUGINS_TCP_TCP_BACKEND_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "backend/backend_engine.h"
+#include "tcp_conn.h"
+
+class nixlTcpMetadata : public nixlBackendMD {
+public:
+    nixlTcpMetadata(bool is_private, uintptr_t addr, size_t len)
+        : nixlBackendMD(is_private),
+          addr_(addr),
+          len_(len) {}
+
+    [[nodiscard]] bool
+    isPrivate() const noexcept {
+        return isPrivateMD;
+    }
+
+    const uintptr_t addr_;
+    const size_t len_;
+};
+
+// A remote agent and its streams, which are opened on connect
+struct nixlTcpPeer {
+    std::string ip_;
+    uint16_t port_;
+    std::vector<std::shared_ptr<nixlTcpConnection>> streams_;
+};
+
+class nixlTcpBackendReqH : public nixlBackendReqH {
+public:
+    nixlTcpBackendReqH(std::shared_ptr<nixlTcpPeer> peer) : peer_(std::move(peer)) {}
+
+    std::shared_ptr<nixlTcpPeer> peer_;
+    nixlTcpBatch batch_;
+    std::vector<nixlTcpOp> ops_;
+    std::vector<size_t> opStreams_; // Stream of every operation
+};
+
+class nixlTcpEngine : public nixlBackendEngine, private nixlTcpHandler {
+public:
+    nixlTcpEngine(const nixlBackendInitParams *init_params);
+    ~nixlTcpEngine();
+
+    bool
+    supportsRemote() const override {
+        return true;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return true;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG};
+    }
+
+    nixl_status_t
+    getConnInfo(std::string &str) const override;
+
+    nixl_status_t
+    loadRemoteConnInfo(const std::string &remote_agent,
+                       const std::string &remote_conn_info) override;
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override;
+
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override;
+
+    nixl_status_t
+    getPublicData(const nixlBackendMD *meta, std::string &str) const override;
+
+    nixl_status_t
+    loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override {
+        output = input;
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    loadRemoteMD(const nixlBlobDesc &input,
+                 const nixl_mem_t &nixl_mem,
+                 const std::string &remote_agent,
+                 nixlBackendMD *&output) override;
+
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override;
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    bool
+    supportsXferSpans() const override {
+        return true;
+    }
+
+    nixl_status_t
+    prepXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+
+    nixl_status_t
+    genNotif(const std::string &remote_agent, const std::string &msg) const override;
+
+private:
+    // nixlTcpHandler
+    bool
+    isAccessible(uintptr_t addr, size_t len) const override;
+
+    void
+    onNotif(std::string agent, std::string msg) override;
+
+    void
+    onAccept(int fd) override;
+
+    [[nodiscard]] nixlTcpWorker &
+    nextWorker() const;
+
+    [[nodiscard]] std::shared_ptr<nixlTcpConnection>
+    openStream(const nixlTcpPeer &peer) const;
+
+    // Returns the peer with its streams open, or nullptr
+    [[nodiscard]] std::shared_ptr<nixlTcpPeer>
+    getPeer(const std::string &remote_agent) const;
+
+    [[nodiscard]] nixl_status_t
+    sendNotif(const nixlTcpPeer &peer, const std::string &msg) const;
+
+    std::string ip_;
+    uint16_t port_ = 0;
+    int listenFd_ = -1;
+    size_t numStreams_;
+    size_t stripeSize_;
+    bool zerocopy_;
+    std::vector<std::unique_ptr<nixlTcpWorker>> workers_;
+    mutable std::atomic<size_t> nextWorker_{0};
+    mutable std::atomic<uint64_t> nextOpId_{1};
+
+    // Registered memory, which peers may access
+    mutable std::shared_mutex regMutex_;
+    std::multimap<uintptr_t, size_t> regions_;
+    size_t maxRegionLen_ = 0;
+
+    std::mutex notifMutex_;
+    notif_list_t notifs_;
+
+    mutable std::mutex peerMutex_;
+    mutable std::unordered_map<std::string, std::shared_ptr<nixlTcpPeer>> peers_;
+};
+
+#endif
@@ -0,0 +1,657 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tcp_conn.h"
+
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+constexpr uint16_t kMagic = 0x4e54; // "NT"
+constexpr uint8_t kVersion = 1;
+constexpr size_t kMaxEvents = 64;
+constexpr size_t kMaxNameLen = 4096;
+constexpr size_t kMaxNotifLen = 256 * 1024 * 1024;
+constexpr size_t kDiscardSize = 64 * 1024;
+constexpr size_t kRecvBudget = 4 * 1024 * 1024; // Per wakeup, so that streams take turns
+
+[[nodiscard]] size_t
+payloadLen(const nixlTcpHeader &hdr) noexcept {
+    return (hdr.type == nixl_tcp_msg_t::READ) ? 0 : hdr.len;
+}
+
+[[nodiscard]] bool
+isTransient(int err) noexcept {
+    return (err == EAGAIN) || (err == EWOULDBLOCK) || (err == EINTR);
+}
+} // namespace
+
+void
+nixlTcpBatch::start(size_t ops, done_cb_t done_cb) {
+    doneCb_ = std::move(done_cb);
+    status_.store(NIXL_SUCCESS, std::memory_order_relaxed);
+    pending_.store(ops, std::memory_order_relaxed);
+    done_.store(false, std::memory_order_release);
+    if (ops == 0) {
+        finish();
+    }
+}
+
+void
+nixlTcpBatch::complete(nixl_status_t status) {
+    if (status != NIXL_SUCCESS) {
+        nixl_status_t expected = NIXL_SUCCESS;
+        status_.compare_exchange_strong(expected, status, std::memory_order_acq_rel);
+    }
+
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        finish();
+    }
+}
+
+void
+nixlTcpBatch::finish() {
+    nixl_status_t status = status_.load(std::memory_order_acquire);
+    if (doneCb_) {
+        status = doneCb_(status);
+    }
+    status_.store(status, std::memory_order_relaxed);
+    done_.store(true, std::memory_order_release);
+}
+
+void
+nixlTcpBatch::wait() const noexcept {
+    while (!isDone()) {
+        std::this_thread::yield();
+    }
+}
+
+nixlTcpConnection::nixlTcpConnection(int fd, bool zerocopy, nixlTcpWorker &worker)
+    : fd_(fd),
+      worker_(worker),
+      zerocopy_(zerocopy) {}
+
+nixlTcpConnection::~nixlTcpConnection() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+nixlTcpWorker::nixlTcpWorker(nixlTcpHandler &handler, size_t zc_threshold, int listen_fd)
+    : handler_(handler),
+      zcThreshold_(zc_threshold),
+      listenFd_(listen_fd),
+      epollFd_(epoll_create1(EPOLL_CLOEXEC)),
+      eventFd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      discard_(kDiscardSize) {
+    if ((epollFd_ < 0) || (eventFd_ < 0)) {
+        throw std::runtime_error(absl::StrFormat("Failed to create a TCP worker: %s",
+                                                 strerror(errno)));
+    }
+
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.ptr = &eventFd_;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, eventFd_, &ev);
+    if (listenFd_ >= 0) {
+        ev.data.ptr = const_cast<int *>(&listenFd_);
+        epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &ev);
+    }
+
+    thread_ = std::thread([this] { run(); });
+}
+
+nixlTcpWorker::~nixlTcpWorker() {
+    stop_.store(true);
+    const uint64_t one = 1;
+    [[maybe_unused]] const ssize_t ret = write(eventFd_, &one, sizeof(one));
+    thread_.join();
+    ::close(eventFd_);
+    ::close(epollFd_);
+}
+
+nixlTcpHeader
+nixlTcpWorker::makeHeader(nixl_tcp_msg_t type,
+                          uint64_t id,
+                          uint64_t addr,
+                          uint64_t len,
+                          nixl_status_t status) noexcept {
+    return {kMagic, kVersion, type, int32_t(status), id, addr, len};
+}
+
+void
+nixlTcpWorker::adopt(std::shared_ptr<nixlTcpConnection> conn, std::vector<nixlTcpSendItem> items) {
+    post({command_t::ADOPT, std::move(conn), std::move(items)});
+}
+
+void
+nixlTcpWorker::send(std::shared_ptr<nixlTcpConnection> conn, std::vector<nixlTcpSendItem> items) {
+    post({command_t::SEND, std::move(conn), std::move(items)});
+}
+
+void
+nixlTcpWorker::close(std::shared_ptr<nixlTcpConnection> conn) {
+    post({command_t::CLOSE, std::move(conn), {}});
+}
+
+void
+nixlTcpWorker::post(command cmd) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        commands_.push_back(std::move(cmd));
+    }
+    const uint64_t one = 1;
+    [[maybe_unused]] const ssize_t ret = write(eventFd_, &one, sizeof(one));
+}
+
+void
+nixlTcpWorker::run() {
+    struct epoll_event events[kMaxEvents];
+
+    while (!stop_.load()) {
+        const int n = epoll_wait(epollFd_, events, kMaxEvents, -1);
+        if ((n < 0) && (errno != EINTR)) {
+            NIXL_ERROR << "epoll_wait failed: " << strerror(errno);
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            void *ptr = events[i].data.ptr;
+            if (ptr == &eventFd_) {
+                uint64_t count;
+                [[maybe_unused]] const ssize_t ret = read(eventFd_, &count, sizeof(count));
+                continue;
+            }
+            if (ptr == &listenFd_) {
+                acceptAll();
+                continue;
+            }
+
+            // The stream may have been closed by an earlier event of this round
+            auto *conn = static_cast<nixlTcpConnection *>(ptr);
+            if (conns_.find(conn) == conns_.end()) {
+                continue;
+            }
+
+            const uint32_t ev = events[i].events;
+            nixl_status_t status = NIXL_SUCCESS;
+            if (ev & EPOLLERR) {
+                status = readErrQueue(*conn);
+            }
+            if ((status == NIXL_SUCCESS) && (ev & (EPOLLIN | EPOLLHUP | EPOLLRDHUP))) {
+                status = doRecv(*conn);
+            }
+            // Replies queued by the receive side are sent right away
+            if ((status == NIXL_SUCCESS) && !conn->sendQueue_.empty()) {
+                status = doSend(*conn);
+            }
+
+            if (status != NIXL_SUCCESS) {
+                closeConn(*conn, status);
+            } else {
+                updateEvents(*conn);
+            }
+        }
+
+        runCommands();
+    }
+
+    // Fail whatever is left, so that no transfer waits for this worker
+    runCommands();
+    while (!conns_.empty()) {
+        closeConn(*conns_.begin()->first, NIXL_ERR_CANCELED);
+    }
+}
+
+void
+nixlTcpWorker::runCommands() {
+    std::vector<command> commands;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        commands.swap(commands_);
+    }
+
+    for (auto &cmd : commands) {
+        nixlTcpConnection &conn = *cmd.conn;
+        const bool known = (conns_.find(&conn) != conns_.end());
+
+        if (cmd.type == command_t::CLOSE) {
+            if (known) {
+                closeConn(conn, NIXL_ERR_CANCELED);
+            }
+            continue;
+        }
+
+        if ((cmd.type == command_t::ADOPT) && !stop_.load() && conn.isAlive() && !known) {
+            struct epoll_event ev = {};
+            ev.events = EPOLLIN | EPOLLRDHUP;
+            ev.data.ptr = &conn;
+            if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, conn.fd_, &ev) == 0) {
+                conns_.emplace(&conn, cmd.conn);
+            } else {
+                NIXL_ERROR << "Failed to poll a TCP stream: " << strerror(errno);
+            }
+        }
+
+        if (conns_.find(&conn) == conns_.end()) {
+            conn.alive_.store(false, std::memory_order_release);
+            for (auto &item : cmd.items) {
+                if (item.op) {
+                    item.op->finished = false;
+                    failOp(*item.op, NIXL_ERR_REMOTE_DISCONNECT);
+                }
+            }
+            continue;
+        }
+
+        enqueue(conn, cmd.items);
+        const nixl_status_t status = doSend(conn);
+        if (status != NIXL_SUCCESS) {
+            closeConn(conn, status);
+        } else {
+            updateEvents(conn);
+        }
+    }
+}
+
+void
+nixlTcpWorker::acceptAll() {
+    for (;;) {
+        const int fd = accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (!isTransient(errno)) {
+                NIXL_ERROR << "accept failed: " << strerror(errno);
+            }
+            return;
+        }
+        handler_.onAccept(fd);
+    }
+}
+
+void
+nixlTcpWorker::enqueue(nixlTcpConnection &conn, std::vector<nixlTcpSendItem> &items) {
+    for (auto &item : items) {
+        if (item.op) {
+            item.op->replied = false;
+            item.op->zcPending = false;
+            item.op->finished = false;
+            item.op->status = NIXL_SUCCESS;
+            conn.pending_[item.hdr.id] = item.op;
+        }
+        conn.sendQueue_.push_back(std::move(item));
+    }
+}
+
+nixl_status_t
+nixlTcpWorker::doSend(nixlTcpConnection &conn) {
+    bool allow_zc = true;
+
+    while (!conn.sendQueue_.empty()) {
+        nixlTcpSendItem &item = conn.sendQueue_.front();
+        const size_t hdr_len = sizeof(item.hdr);
+        const size_t len = payloadLen(item.hdr);
+        const char *payload = item.payload ? item.payload : item.data.data();
+        // Owned data is released with the item, only registered memory is sent in place
+        const bool use_zc =
+            allow_zc && conn.zerocopy_ && item.payload && (len >= zcThreshold_);
+
+        // The header lives in the queue, so it is never sent with MSG_ZEROCOPY
+        struct iovec iov[2];
+        size_t iov_count = 0;
+        int flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+        if (conn.sent_ < hdr_len) {
+            iov[iov_count++] = {reinterpret_cast<char *>(&item.hdr) + conn.sent_,
+                                hdr_len - conn.sent_};
+            if (use_zc) {
+                flags |= MSG_MORE;
+            } else if (len > 0) {
+                iov[iov_count++] = {const_cast<char *>(payload), len};
+            }
+        } else {
+            const size_t offset = conn.sent_ - hdr_len;
+            iov[iov_count++] = {const_cast<char *>(payload) + offset, len - offset};
+            if (use_zc) {
+                flags |= MSG_ZEROCOPY;
+            }
+        }
+
+        struct msghdr msg = {};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iov_count;
+        const ssize_t ret = sendmsg(conn.fd_, &msg, flags);
+        if (ret < 0) {
+            if ((errno == ENOBUFS) && (flags & MSG_ZEROCOPY)) {
+                allow_zc = false; // Out of socket option memory, copy this time
+                continue;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                return NIXL_SUCCESS;
+            }
+            NIXL_ERROR << "TCP send failed: " << strerror(errno);
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        }
+
+        if (flags & MSG_ZEROCOPY) {
+            conn.zcUsed_ = true;
+            ++conn.zcNext_;
+        }
+
+        conn.sent_ += ret;
+        if (conn.sent_ < hdr_len + len) {
+            continue;
+        }
+
+        // Pages of local memory are referenced until the kernel reports the sends completed
+        if (conn.zcUsed_ && item.op) {
+            item.op->zcPending = true;
+            conn.zcWaits_.emplace_back(conn.zcNext_ - 1, item.op);
+        }
+        conn.zcUsed_ = false;
+        conn.sent_ = 0;
+        conn.sendQueue_.pop_front();
+        allow_zc = true;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpWorker::doRecv(nixlTcpConnection &conn) {
+    size_t received = 0;
+
+    while (received < kRecvBudget) {
+        char *dst;
+        size_t len;
+        if (conn.recvState_ == nixlTcpConnection::recv_state_t::HEADER) {
+            dst = reinterpret_cast<char *>(&conn.recvHdr_) + conn.recvGot_;
+            len = sizeof(conn.recvHdr_) - conn.recvGot_;
+        } else if (conn.recvDst_) {
+            dst = conn.recvDst_;
+            len = conn.recvLeft_;
+        } else {
+            dst = discard_.data();
+            len = std::min(conn.recvLeft_, discard_.size());
+        }
+
+        const ssize_t ret = recv(conn.fd_, dst, len, MSG_DONTWAIT);
+        if (ret == 0) {
+            NIXL_DEBUG << "TCP stream of agent '" << conn.peer_ << "' was closed by the peer";
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        }
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (isTransient(errno)) {
+                return NIXL_SUCCESS;
+            }
+            NIXL_ERROR << "TCP receive failed: " << strerror(errno);
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        }
+        received += ret;
+
+        nixl_status_t status = NIXL_SUCCESS;
+        if (conn.recvState_ == nixlTcpConnection::recv_state_t::HEADER) {
+            conn.recvGot_ += ret;
+            if (conn.recvGot_ == sizeof(conn.recvHdr_)) {
+                conn.recvGot_ = 0;
+                status = onHeader(conn);
+            }
+        } else {
+            if (conn.recvDst_) {
+                conn.recvDst_ += ret;
+            }
+            conn.recvLeft_ -= ret;
+            if (conn.recvLeft_ == 0) {
+                conn.recvState_ = nixlTcpConnection::recv_state_t::HEADER;
+                status = onPayload(conn);
+            }
+        }
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpWorker::onHeader(nixlTcpConnection &conn) {
+    const nixlTcpHeader &hdr = conn.recvHdr_;
+    if ((hdr.magic != kMagic) || (hdr.version != kVersion)) {
+        NIXL_ERROR << "Invalid message on the TCP stream of agent '" << conn.peer_ << "'";
+        return NIXL_ERR_MISMATCH;
+    }
+
+    conn.recvDst_ = nullptr;
+    conn.recvLeft_ = payloadLen(hdr);
+    conn.recvOp_ = nullptr;
+    conn.recvStatus_ = NIXL_SUCCESS;
+
+    switch (hdr.type) {
+    case nixl_tcp_msg_t::HELLO:
+    case nixl_tcp_msg_t::NOTIF:
+        if (hdr.len > ((hdr.type == nixl_tcp_msg_t::HELLO) ? kMaxNameLen : kMaxNotifLen)) {
+            NIXL_ERROR << absl::StrFormat("TCP control message of %d bytes is too large", hdr.len);
+            return NIXL_ERR_MISMATCH;
+        }
+        conn.recvBuf_.resize(hdr.len);
+        conn.recvDst_ = conn.recvBuf_.data();
+        break;
+    case nixl_tcp_msg_t::WRITE:
+        if (handler_.isAccessible(hdr.addr, hdr.len)) {
+            conn.recvDst_ = reinterpret_cast<char *>(hdr.addr);
+        } else {
+            NIXL_ERROR << absl::StrFormat("Agent '%s' wrote to unregistered memory 0x%x+%d",
+                                          conn.peer_,
+                                          hdr.addr,
+                                          hdr.len);
+            conn.recvStatus_ = NIXL_ERR_INVALID_PARAM;
+        }
+        break;
+    case nixl_tcp_msg_t::READ:
+        break;
+    case nixl_tcp_msg_t::READ_RESP:
+    case nixl_tcp_msg_t::ACK: {
+        const auto it = conn.pending_.find(hdr.id);
+        if (it == conn.pending_.end()) {
+            NIXL_ERROR << "Reply to an unknown operation on a TCP stream";
+            return NIXL_ERR_MISMATCH;
+        }
+        conn.recvOp_ = it->second;
+        conn.pending_.erase(it);
+        conn.recvStatus_ = nixl_status_t(hdr.status);
+        if (hdr.type == nixl_tcp_msg_t::READ_RESP && conn.recvStatus_ == NIXL_SUCCESS) {
+            if (hdr.len == conn.recvOp_->len) {
+                conn.recvDst_ = reinterpret_cast<char *>(conn.recvOp_->local);
+            } else {
+                conn.recvStatus_ = NIXL_ERR_MISMATCH;
+            }
+        }
+        break;
+    }
+    default:
+        NIXL_ERROR << "Unknown message type on a TCP stream";
+        return NIXL_ERR_MISMATCH;
+    }
+
+    if (conn.recvLeft_ == 0) {
+        return onPayload(conn);
+    }
+    conn.recvState_ = nixlTcpConnection::recv_state_t::PAYLOAD;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpWorker::onPayload(nixlTcpConnection &conn) {
+    const nixlTcpHeader &hdr = conn.recvHdr_;
+
+    switch (hdr.type) {
+    case nixl_tcp_msg_t::HELLO:
+        conn.peer_ = std::move(conn.recvBuf_);
+        break;
+    case nixl_tcp_msg_t::NOTIF:
+        handler_.onNotif(conn.peer_, std::move(conn.recvBuf_));
+        break;
+    case nixl_tcp_msg_t::WRITE: {
+        nixlTcpSendItem ack;
+        ack.hdr = makeHeader(nixl_tcp_msg_t::ACK, hdr.id, 0, 0, conn.recvStatus_);
+        conn.sendQueue_.push_back(std::move(ack));
+        break;
+    }
+    case nixl_tcp_msg_t::READ: {
+        nixlTcpSendItem resp;
+        if (handler_.isAccessible(hdr.addr, hdr.len)) {
+            resp.hdr = makeHeader(nixl_tcp_msg_t::READ_RESP, hdr.id, 0, hdr.len);
+            resp.payload = reinterpret_cast<const char *>(hdr.addr);
+        } else {
+            NIXL_ERROR << absl::StrFormat("Agent '%s' read from unregistered memory 0x%x+%d",
+                                          conn.peer_,
+                                          hdr.addr,
+                                          hdr.len);
+            resp.hdr =
+                makeHeader(nixl_tcp_msg_t::READ_RESP, hdr.id, 0, 0, NIXL_ERR_INVALID_PARAM);
+        }
+        conn.sendQueue_.push_back(std::move(resp));
+        break;
+    }
+    case nixl_tcp_msg_t::READ_RESP:
+    case nixl_tcp_msg_t::ACK: {
+        nixlTcpOp &op = *conn.recvOp_;
+        conn.recvOp_ = nullptr;
+        op.status = conn.recvStatus_;
+        op.replied = true;
+        finishOp(op);
+        break;
+    }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTcpWorker::readErrQueue(nixlTcpConnection &conn) {
+    for (;;) {
+        char control[128];
+        struct msghdr msg = {};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (recvmsg(conn.fd_, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+            if (isTransient(errno)) {
+                return NIXL_SUCCESS;
+            }
+            NIXL_ERROR << "Failed to read the TCP error queue: " << strerror(errno);
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        }
+
+        for (struct cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+            if (!((cm->cmsg_level == SOL_IP) && (cm->cmsg_type == IP_RECVERR)) &&
+                !((cm->cmsg_level == SOL_IPV6) && (cm->cmsg_type == IPV6_RECVERR))) {
+                continue;
+            }
+
+            const auto *err = reinterpret_cast<const struct sock_extended_err *>(CMSG_DATA(cm));
+            if ((err->ee_origin != SO_EE_ORIGIN_ZEROCOPY) || (err->ee_errno != 0)) {
+                NIXL_ERROR << "TCP stream error: " << strerror(err->ee_errno);
+                return NIXL_ERR_REMOTE_DISCONNECT;
+            }
+
+            // Sends [ee_info, ee_data] are completed, in order
+            const uint32_t last = err->ee_data;
+            while (!conn.zcWaits_.empty() &&
+                   (int32_t(last - conn.zcWaits_.front().first) >= 0)) {
+                nixlTcpOp &op = *conn.zcWaits_.front().second;
+                conn.zcWaits_.pop_front();
+                op.zcPending = false;
+                finishOp(op);
+            }
+        }
+    }
+}
+
+void
+nixlTcpWorker::updateEvents(nixlTcpConnection &conn) {
+    const bool want_out = !conn.sendQueue_.empty();
+    if (want_out == conn.wantOut_) {
+        return;
+    }
+
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN | EPOLLRDHUP | (want_out ? EPOLLOUT : 0);
+    ev.data.ptr = &conn;
+    epoll_ctl(epollFd_, EPOLL_CTL_MOD, conn.fd_, &ev);
+    conn.wantOut_ = want_out;
+}
+
+void
+nixlTcpWorker::closeConn(nixlTcpConnection &conn, nixl_status_t status) {
+    // Keeps the stream alive until the end of the function
+    const auto it = conns_.find(&conn);
+    const std::shared_ptr<nixlTcpConnection> keep = it->second;
+    conns_.erase(it);
+
+    conn.alive_.store(false, std::memory_order_release);
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, conn.fd_, nullptr);
+    ::close(conn.fd_);
+    conn.fd_ = -1;
+
+    // The kernel dropped its references to local memory with the socket
+    for (auto &[id, op] : conn.zcWaits_) {
+        op->zcPending = false;
+        finishOp(*op);
+    }
+    conn.zcWaits_.clear();
+
+    // Including the operation whose reply was being received
+    if (conn.recvOp_) {
+        failOp(*conn.recvOp_, status);
+        conn.recvOp_ = nullptr;
+    }
+    for (auto &[id, op] : conn.pending_) {
+        failOp(*op, status);
+    }
+    conn.pending_.clear();
+    conn.sendQueue_.clear();
+}
+
+void
+nixlTcpWorker::failOp(nixlTcpOp &op, nixl_status_t status) {
+    op.status = status;
+    op.replied = true;
+    op.zcPending = false;
+    finishOp(op);
+}
+
+void
+nixlTcpWorker::finishOp(nixlTcpOp &op) {
+    if (op.finished || !op.replied || op.zcPending) {
+        return;
+    }
+    op.finished = true;
+    op.batch->complete(op.status);
+}
@@ -0,0 +1,290 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_TCP_TCP_CONN_H
+#define NIXL_SRC_PLUGINS_TCP_TCP_CONN_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "nixl_types.h"
+
+enum class nixl_tcp_msg_t : uint8_t {
+    HELLO = 1, // Name of the connecting agent, first message of a stream
+    WRITE = 2, // Payload to be written at addr, answered by an ACK
+    READ = 3, // Request of len bytes at addr, answered by a READ_RESP
+    READ_RESP = 4, // Payload of a READ, empty on error
+    ACK = 5, // Status of a WRITE
+    NOTIF = 6, // Notification message
+};
+
+// Header of every message, followed by len bytes of payload except for READ
+struct nixlTcpHeader {
+    uint16_t magic;
+    uint8_t version;
+    nixl_tcp_msg_t type;
+    int32_t status;
+    uint64_t id;
+    uint64_t addr;
+    uint64_t len;
+};
+
+static_assert(sizeof(nixlTcpHeader) == 32);
+
+/**
+ * @class nixlTcpBatch
+ * @brief Completion of the operations of one posted transfer, which may complete on the
+ *        threads of different streams. The callback runs once, on the thread of the last one.
+ */
+class nixlTcpBatch {
+public:
+    using done_cb_t = std::function<nixl_status_t(nixl_status_t status)>;
+
+    // Arms the batch for the given number of operations, at most one post may be in flight
+    void
+    start(size_t ops, done_cb_t done_cb);
+
+    void
+    complete(nixl_status_t status);
+
+    [[nodiscard]] bool
+    isDone() const noexcept {
+        return done_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] nixl_status_t
+    getStatus() const noexcept {
+        return status_.load(std::memory_order_acquire);
+    }
+
+    // Blocks until the operations of the current post are all completed
+    void
+    wait() const noexcept;
+
+private:
+    void
+    finish();
+
+    done_cb_t doneCb_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<nixl_status_t> status_{NIXL_SUCCESS};
+    std::atomic<bool> done_{true};
+};
+
+// A READ or WRITE of a contiguous piece of a transfer, on a single stream
+struct nixlTcpOp {
+    nixl_xfer_op_t op;
+    uintptr_t local;
+    uintptr_t remote;
+    size_t len;
+    nixlTcpBatch *batch;
+
+    // Owned by the worker of the stream while the operation is posted
+    bool replied;
+    bool zcPending; // Local memory may still be referenced by the kernel
+    bool finished;
+    nixl_status_t status;
+};
+
+struct nixlTcpSendItem {
+    nixlTcpHeader hdr;
+    const char *payload = nullptr; // Not owned, data is sent instead when null
+    std::string data;
+    nixlTcpOp *op = nullptr;
+};
+
+// Events of the workers which are handled by the engine
+class nixlTcpHandler {
+public:
+    virtual ~nixlTcpHandler() = default;
+
+    // Whether a peer may access the local memory range
+    [[nodiscard]] virtual bool
+    isAccessible(uintptr_t addr, size_t len) const = 0;
+
+    virtual void
+    onNotif(std::string agent, std::string msg) = 0;
+
+    virtual void
+    onAccept(int fd) = 0;
+};
+
+class nixlTcpWorker;
+
+/**
+ * @class nixlTcpConnection
+ * @brief A stream to or from a peer. All of its I/O is done by the worker it belongs to,
+ *        other threads only hand messages to that worker.
+ */
+class nixlTcpConnection {
+public:
+    nixlTcpConnection(int fd, bool zerocopy, nixlTcpWorker &worker);
+    ~nixlTcpConnection();
+
+    nixlTcpConnection(const nixlTcpConnection &) = delete;
+    nixlTcpConnection &
+    operator=(const nixlTcpConnection &) = delete;
+
+    [[nodiscard]] bool
+    isAlive() const noexcept {
+        return alive_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] nixlTcpWorker &
+    getWorker() const noexcept {
+        return worker_;
+    }
+
+private:
+    friend class nixlTcpWorker;
+
+    enum class recv_state_t { HEADER, PAYLOAD };
+
+    int fd_;
+    std::atomic<bool> alive_{true};
+    nixlTcpWorker &worker_;
+    std::string peer_; // Agent name, from the HELLO of the connecting side
+
+    // Send side
+    std::deque<nixlTcpSendItem> sendQueue_;
+    size_t sent_ = 0; // Bytes of the front item which were sent
+    bool wantOut_ = false;
+    bool zerocopy_;
+    bool zcUsed_ = false; // The front item was partly sent with MSG_ZEROCOPY
+    uint32_t zcNext_ = 0; // Id of the next MSG_ZEROCOPY send
+    std::deque<std::pair<uint32_t, nixlTcpOp *>> zcWaits_;
+
+    // Receive side
+    recv_state_t recvState_ = recv_state_t::HEADER;
+    nixlTcpHeader recvHdr_;
+    size_t recvGot_ = 0;
+    char *recvDst_ = nullptr; // Null when the payload is discarded
+    size_t recvLeft_ = 0;
+    std::string recvBuf_;
+    nixlTcpOp *recvOp_ = nullptr;
+    nixl_status_t recvStatus_ = NIXL_SUCCESS;
+
+    std::unordered_map<uint64_t, nixlTcpOp *> pending_; // Posted, waiting for a reply
+};
+
+/**
+ * @class nixlTcpWorker
+ * @brief A thread which polls a set of streams and the listening socket, if given one.
+ *        Payloads are received directly into the registered memory of the transfer, and
+ *        large ones are sent with MSG_ZEROCOPY when the stream supports it.
+ */
+class nixlTcpWorker {
+public:
+    nixlTcpWorker(nixlTcpHandler &handler, size_t zc_threshold, int listen_fd = -1);
+    ~nixlTcpWorker();
+
+    nixlTcpWorker(const nixlTcpWorker &) = delete;
+    nixlTcpWorker &
+    operator=(const nixlTcpWorker &) = delete;
+
+    // Starts polling the stream, after sending the given messages
+    void
+    adopt(std::shared_ptr<nixlTcpConnection> conn, std::vector<nixlTcpSendItem> items = {});
+
+    // Operations of the messages fail when the stream is closed
+    void
+    send(std::shared_ptr<nixlTcpConnection> conn, std::vector<nixlTcpSendItem> items);
+
+    // Closes the stream, failing its posted operations
+    void
+    close(std::shared_ptr<nixlTcpConnection> conn);
+
+    [[nodiscard]] static nixlTcpHeader
+    makeHeader(nixl_tcp_msg_t type, uint64_t id, uint64_t addr, uint64_t len,
+               nixl_status_t status = NIXL_SUCCESS) noexcept;
+
+private:
+    enum class command_t { ADOPT, SEND, CLOSE };
+
+    struct command {
+        command_t type;
+        std::shared_ptr<nixlTcpConnection> conn;
+        std::vector<nixlTcpSendItem> items;
+    };
+
+    void
+    post(command cmd);
+
+    void
+    run();
+
+    void
+    runCommands();
+
+    void
+    acceptAll();
+
+    void
+    enqueue(nixlTcpConnection &conn, std::vector<nixlTcpSendItem> &items);
+
+    [[nodiscard]] nixl_status_t
+    doSend(nixlTcpConnection &conn);
+
+    [[nodiscard]] nixl_status_t
+    doRecv(nixlTcpConnection &conn);
+
+    [[nodiscard]] nixl_status_t
+    onHeader(nixlTcpConnection &conn);
+
+    [[nodiscard]] nixl_status_t
+    onPayload(nixlTcpConnection &conn);
+
+    [[nodiscard]] nixl_status_t
+    readErrQueue(nixlTcpConnection &conn);
+
+    void
+    updateEvents(nixlTcpConnection &conn);
+
+    void
+    closeConn(nixlTcpConnection &conn, nixl_status_t status);
+
+    static void
+    failOp(nixlTcpOp &op, nixl_status_t status);
+
+    static void
+    finishOp(nixlTcpOp &op);
+
+    nixlTcpHandler &handler_;
+    const size_t zcThreshold_;
+    const int listenFd_;
+    int epollFd_;
+    int eventFd_;
+    std::atomic<bool> stop_{false};
+
+    std::mutex mutex_;
+    std::vector<command> commands_;
+
+    // Owned by the worker thread
+    std::unordered_map<nixlTcpConnection *, std::shared_ptr<nixlTcpConnection>> conns_;
+    std::vector<char> discard_;
+
+    std::thread thread_;
+};
+
+#endif
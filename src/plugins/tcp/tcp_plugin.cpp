@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tcp_backend.h"
+#include "backend/backend_plugin.h"
+
+// Plugin type alias for convenience
+using tcp_plugin_t = nixlBackendPluginCreator<nixlTcpEngine>;
+
+namespace {
+nixl_b_params_t
+getTcpBackendOptions() {
+    return {{"num_threads", "2"},
+            {"num_streams", "4"},
+            {"stripe_size", "1048576"},
+            {"zerocopy", "true"},
+            {"zerocopy_threshold", "32768"},
+            {"ip_addr", ""},
+            {"port", "0"}};
+}
+} // namespace
+
+#ifdef STATIC_PLUGIN_TCP
+nixlBackendPlugin *
+createStaticTCPPlugin() {
+    return tcp_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "TCP", "0.1.0", getTcpBackendOptions(), {DRAM_SEG});
+}
+#else
+extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
+nixl_plugin_init() {
+    return tcp_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "TCP", "0.1.0", getTcpBackendOptions(), {DRAM_SEG});
+}
+
+extern "C" NIXL_PLUGIN_EXPORT void
+nixl_plugin_fini() {}
+#endif
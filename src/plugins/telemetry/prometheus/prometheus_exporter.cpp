@@ -37,6 +37,44 @@ const std::string prometheusExporterMemoryCategory = "NIXL_TELEMETRY_MEMORY";
 const std::string prometheusExporterLocalAddress = "127.0.0.1";
 const std::string prometheusExporterPublicAddress = "0.0.0.0";
 
+// Powers of 2 from 1us to ~17s, every latency histogram bucket falls into one of them
+constexpr unsigned prometheusHistogramMinBits = 10;
+constexpr unsigned prometheusHistogramMaxBits = 34;
+
+const prometheus::Histogram::BucketBoundaries &
+getHistogramBoundaries() {
+    static const prometheus::Histogram::BucketBoundaries boundaries = [] {
+        prometheus::Histogram::BucketBoundaries result;
+        for (unsigned bits = prometheusHistogramMinBits; bits <= prometheusHistogramMaxBits;
+             ++bits) {
+            result.push_back(static_cast<double>(uint64_t(1) << bits) / 1e9);
+        }
+        return result;
+    }();
+    return boundaries;
+}
+
+// Folds the latency histogram buckets into the Prometheus buckets, including +Inf
+std::vector<double>
+getBucketIncrements(const nixlLatencyHistogram::snapshot &snap) {
+    std::vector<double> increments(getHistogramBoundaries().size() + 1, 0);
+    for (size_t i = 0; i < nixlLatencyHistogram::numBuckets; ++i) {
+        const uint64_t count = snap.bucketCount(i);
+        if (count == 0) {
+            continue;
+        }
+
+        const uint64_t upper = nixlLatencyHistogram::bucketUpperBound(i);
+        size_t bucket = 0;
+        while (bucket < getHistogramBoundaries().size() &&
+               upper > (uint64_t(1) << (prometheusHistogramMinBits + bucket))) {
+            ++bucket;
+        }
+        increments[bucket] += count;
+    }
+    return increments;
+}
+
 std::string
 getHostname() {
     char hostname[HOST_NAME_MAX + 1];
@@ -100,6 +138,15 @@ nixlTelemetryPrometheusExporter::initializeMetrics() {
     registerGauge("agent_memory_registered", "Memory registered", prometheusExporterMemoryCategory);
     registerGauge(
         "agent_memory_deregistered", "Memory deregistered", prometheusExporterMemoryCategory);
+
+    postTimeFamily_ = &prometheus::BuildHistogram()
+                           .Name("agent_xfer_post_time_seconds")
+                           .Help("Start to posting to Back-End latency distribution")
+                           .Register(*registry_);
+    xferTimeFamily_ = &prometheus::BuildHistogram()
+                           .Name("agent_xfer_time_seconds")
+                           .Help("Start to Complete latency distribution")
+                           .Register(*registry_);
 }
 
 void
@@ -121,6 +168,47 @@ nixlTelemetryPrometheusExporter::registerGauge(const std::string &name,
         &gauge.Add({{"category", category}, {"hostname", hostname_}, {"agent_name", agent_name_}});
 }
 
+nixl_status_t
+nixlTelemetryPrometheusExporter::exportHistograms(
+    const std::vector<nixlTelemetryHistogram> &histograms) {
+    try {
+        for (const auto &histogram : histograms) {
+            const std::string size = nixlTelemetryHistogram::sizeLabel(histogram.sizeBucket);
+            const std::string key = histogram.backend + '\0' + histogram.op + '\0' + size +
+                '\0' + histogram.remoteAgent;
+
+            auto it = histograms_.find(key);
+            if (it == histograms_.end()) {
+                const prometheus::Labels labels = {
+                    {"category", prometheusExporterPerformanceCategory},
+                    {"hostname", hostname_},
+                    {"agent_name", agent_name_},
+                    {"backend", histogram.backend},
+                    {"op", histogram.op},
+                    {"size", size},
+                    {"remote_agent", histogram.remoteAgent}};
+                it = histograms_
+                         .emplace(key,
+                                  std::make_pair(
+                                      &postTimeFamily_->Add(labels, getHistogramBoundaries()),
+                                      &xferTimeFamily_->Add(labels, getHistogramBoundaries())))
+                         .first;
+            }
+
+            it->second.first->ObserveMultiple(getBucketIncrements(histogram.post),
+                                              histogram.post.sum() / 1e9);
+            it->second.second->ObserveMultiple(getBucketIncrements(histogram.xfer),
+                                               histogram.xfer.sum() / 1e9);
+        }
+
+        return NIXL_SUCCESS;
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Failed to export telemetry histograms: " << e.what();
+        return NIXL_ERR_UNKNOWN;
+    }
+}
+
 nixl_status_t
 nixlTelemetryPrometheusExporter::exportEvent(const nixlTelemetryEvent &event) {
     try {
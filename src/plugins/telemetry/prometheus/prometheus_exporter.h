@@ -24,6 +24,8 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <prometheus/registry.h>
 #include <prometheus/exposer.h>
@@ -50,6 +52,9 @@ public:
     nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) override;
 
+    nixl_status_t
+    exportHistograms(const std::vector<nixlTelemetryHistogram> &histograms) override;
+
 private:
     // Prometheus components
     const bool local_ = false;
@@ -65,6 +70,12 @@ private:
     std::unordered_map<std::string, prometheus::Counter *> counters_;
     std::unordered_map<std::string, prometheus::Gauge *> gauges_;
 
+    // Latency histograms by telemetry histogram key
+    prometheus::Family<prometheus::Histogram> *postTimeFamily_ = nullptr;
+    prometheus::Family<prometheus::Histogram> *xferTimeFamily_ = nullptr;
+    std::unordered_map<std::string, std::pair<prometheus::Histogram *, prometheus::Histogram *>>
+        histograms_;
+
     // Helper methods
     void
     initializeMetrics();
@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Converts binary trace files written by the trace telemetry exporter to the
+ * Chrome trace event JSON format, which can be opened by chrome://tracing or
+ * the Perfetto UI:
+ *
+ *   nixl_trace_convert <agent1.nixltrace> [agent2.nixltrace ...] > trace.json
+ *
+ * Every trace file becomes a process named after its agent, spans are shown on
+ * the thread which recorded them and carry the id of their transfer request.
+ */
+
+#include "trace_format.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+std::string
+jsonEscape(const char *value) {
+    std::string escaped;
+    for (; *value != '\0'; ++value) {
+        const char c = *value;
+        switch (c) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        case '\t':
+            escaped += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                escaped += buf;
+            } else {
+                escaped += c;
+            }
+        }
+    }
+    return escaped;
+}
+
+bool
+convertFile(const char *path, bool &first_event) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open " << path << std::endl;
+        return false;
+    }
+
+    nixlTraceFileHeader header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        memcmp(header.magic_, traceFileMagic, sizeof(traceFileMagic)) != 0) {
+        std::cerr << path << " is not a NIXL trace file" << std::endl;
+        return false;
+    }
+
+    if (header.version_ != traceFileVersion || header.spanSize_ != sizeof(nixlTelemetrySpan)) {
+        std::cerr << path << " has unsupported version " << header.version_ << std::endl;
+        return false;
+    }
+    header.agentName_[traceAgentNameLen - 1] = '\0';
+
+    auto separator = [&first_event]() {
+        const char *sep = first_event ? "\n" : ",\n";
+        first_event = false;
+        return sep;
+    };
+
+    printf("%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"%s\"}}",
+           separator(),
+           header.pid_,
+           jsonEscape(header.agentName_).c_str());
+
+    nixlTelemetrySpan span;
+    size_t num_spans = 0;
+    while (file.read(reinterpret_cast<char *>(&span), sizeof(span))) {
+        span.backend_[MAX_SPAN_BACKEND_LEN - 1] = '\0';
+        printf("%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" PRIu64 ".%03" PRIu64
+               ",\"dur\":%" PRIu64 ".%03" PRIu64 ",\"pid\":%u,\"tid\":%u,"
+               "\"args\":{\"request\":\"0x%" PRIx64 "\"}}",
+               separator(),
+               jsonEscape(nixlEnumStrings::telemetrySpanKindStr(span.kind_)).c_str(),
+               jsonEscape(span.backend_).c_str(),
+               span.startNs_ / 1000,
+               span.startNs_ % 1000,
+               span.durationNs_ / 1000,
+               span.durationNs_ % 1000,
+               header.pid_,
+               span.threadId_,
+               span.requestId_);
+        ++num_spans;
+    }
+
+    std::cerr << "Converted " << num_spans << " spans of agent " << header.agentName_
+              << std::endl;
+    return true;
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <trace_file> [trace_file ...] > trace.json"
+                  << std::endl;
+        return 1;
+    }
+
+    bool first_event = true;
+    bool ok = true;
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (int i = 1; i < argc; ++i) {
+        ok = convertFile(argv[i], first_event) && ok;
+    }
+    printf("\n]}\n");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "trace_exporter.h"
+#include "trace_format.h"
+#include "common/configuration.h"
+#include "common/nixl_log.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <unistd.h>
+
+namespace {
+const char traceFileVar[] = "NIXL_TELEMETRY_TRACE_FILE";
+const char traceDirVar[] = "NIXL_TELEMETRY_DIR";
+const char traceFileSuffix[] = ".nixltrace";
+
+[[nodiscard]] std::filesystem::path
+getFilePath(const nixlTelemetryExporterInitParams &init_params) {
+    if (const auto file = nixl::config::getValueOptional<std::filesystem::path>(traceFileVar)) {
+        return *file;
+    }
+
+    if (const auto dir = nixl::config::getValueOptional<std::filesystem::path>(traceDirVar)) {
+        return *dir / (init_params.agentName + traceFileSuffix);
+    }
+
+    throw std::invalid_argument(std::string("Trace exporter requires ") + traceFileVar +
+                                " or " + traceDirVar + " to be set");
+}
+} // namespace
+
+nixlTelemetryTraceExporter::nixlTelemetryTraceExporter(
+    const nixlTelemetryExporterInitParams &init_params)
+    : nixlTelemetryExporter(init_params),
+      filePath_(getFilePath(init_params)),
+      file_(filePath_, std::ios::binary | std::ios::trunc) {
+    if (!file_) {
+        throw std::runtime_error("Failed to open trace file " + filePath_.string());
+    }
+
+    nixlTraceFileHeader header{};
+    memcpy(header.magic_, traceFileMagic, sizeof(traceFileMagic));
+    header.version_ = traceFileVersion;
+    header.spanSize_ = sizeof(nixlTelemetrySpan);
+    header.pid_ = static_cast<uint32_t>(getpid());
+    strncpy(header.agentName_, init_params.agentName.c_str(), traceAgentNameLen - 1);
+    file_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file_.flush();
+
+    NIXL_INFO << "Trace exporter writing spans to " << filePath_.string();
+}
+
+nixl_status_t
+nixlTelemetryTraceExporter::exportEvent(const nixlTelemetryEvent & /* event */) {
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTelemetryTraceExporter::exportSpans(const std::vector<nixlTelemetrySpan> &spans) {
+    file_.write(reinterpret_cast<const char *>(spans.data()),
+                spans.size() * sizeof(nixlTelemetrySpan));
+    // Flushed every interval, so that the trace survives the process
+    file_.flush();
+    if (!file_) {
+        NIXL_ERROR << "Failed to write " << spans.size() << " spans to " << filePath_.string();
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _TELEMETRY_TRACE_EXPORTER_H
+#define _TELEMETRY_TRACE_EXPORTER_H
+
+#include "telemetry/telemetry_exporter.h"
+#include "telemetry_span.h"
+#include "nixl_types.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/**
+ * @class nixlTelemetryTraceExporter
+ * @brief Exports the trace spans of transfer requests to a binary trace file
+ *
+ * Spans are appended to the file as fixed-size records by the telemetry thread, they are
+ * converted offline to the Chrome trace event format by nixl_trace_convert. Other
+ * telemetry events are not exported.
+ */
+class nixlTelemetryTraceExporter : public nixlTelemetryExporter {
+public:
+    explicit nixlTelemetryTraceExporter(const nixlTelemetryExporterInitParams &init_params);
+
+    nixl_status_t
+    exportEvent(const nixlTelemetryEvent &event) override;
+
+    bool
+    exportsSpans() const noexcept override {
+        return true;
+    }
+
+    nixl_status_t
+    exportSpans(const std::vector<nixlTelemetrySpan> &spans) override;
+
+private:
+    std::filesystem::path filePath_;
+    std::ofstream file_;
+};
+
+#endif // _TELEMETRY_TRACE_EXPORTER_H
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _TELEMETRY_TRACE_FORMAT_H
+#define _TELEMETRY_TRACE_FORMAT_H
+
+#include "telemetry_span.h"
+
+#include <cstdint>
+
+constexpr char traceFileMagic[8] = "NIXLTRC";
+constexpr uint32_t traceFileVersion = 1;
+constexpr size_t traceAgentNameLen = 64;
+
+/**
+ * @struct nixlTraceFileHeader
+ * @brief Header of a binary trace file, followed by nixlTelemetrySpan records of
+ *        spanSize_ bytes in the order they were exported
+ */
+struct nixlTraceFileHeader {
+    char magic_[sizeof(traceFileMagic)];
+    uint32_t version_;
+    uint32_t spanSize_;
+    uint32_t pid_;
+    char agentName_[traceAgentNameLen];
+};
+
+#endif // _TELEMETRY_TRACE_FORMAT_H
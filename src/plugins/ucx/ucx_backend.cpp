@@ -17,13 +17,14 @@
 
 #include "ucx_backend.h"
 #include "common/nixl_log.h"
+#include "common/progress_policy.h"
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
 
 #include <optional>
 #include <limits>
 #include <future>
-#include <set>
+#include <algorithm>
 #include <string.h>
 #include <unistd.h>
 #include "absl/strings/numbers.h"
@@ -38,6 +39,86 @@ namespace {
             src.clear();
         }
     }
+
+    // Waits of the progress thread used to be poll() timeouts, at least 1ms unless zero.
+    // The floor is kept for the fixed delay, configured policy bounds are used as given
+    nixlProgressPolicy makeProgressPolicy(const nixlBackendInitParams &init_params)
+    {
+        const nixlTime::us_t delay_us =
+            std::min<nixlTime::us_t>(init_params.pthrDelay, std::numeric_limits<int>::max());
+        const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+            std::chrono::microseconds(delay_us));
+        return nixlProgressPolicy::fromParams(
+            init_params.customParams,
+            std::chrono::duration_cast<std::chrono::microseconds>(delay).count());
+    }
+}
+
+/*
+ * Completion stamps of a request handle. UCX callbacks of the operations of the
+ * handle hold a reference, as they may run after the handle was released and
+ * recycled, so the handle switches to new stamps when it is reused meanwhile.
+ */
+class nixlUcxStamps {
+public:
+    nixlCompletionStamp xferDone;
+    nixlCompletionStamp notifDone;
+
+    [[nodiscard]] nixlUcxStamps *
+    ref() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+        return this;
+    }
+
+    void
+    unref() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    [[nodiscard]] bool
+    isShared() const noexcept {
+        return refs_.load(std::memory_order_acquire) > 1;
+    }
+
+    struct deleter {
+        void
+        operator()(nixlUcxStamps *stamps) const noexcept {
+            stamps->unref();
+        }
+    };
+
+private:
+    std::atomic<size_t> refs_{1};
+};
+
+using ucx_stamps_ptr_t = std::unique_ptr<nixlUcxStamps, nixlUcxStamps::deleter>;
+
+namespace {
+    // Stamps the completion of the data, user data is a reference to the stamps
+    void flushCompletedCb(void *request, ucs_status_t status, void *user_data)
+    {
+        auto stamps = static_cast<nixlUcxStamps *>(user_data);
+        if (status == UCS_OK) {
+            stamps->xferDone.mark();
+        }
+        stamps->unref();
+    }
+
+    nixl_status_t flushForStamps(nixlUcxEp &ep, nixlUcxReq &req, nixlUcxStamps &stamps)
+    {
+        nixlUcxStamps *ref = stamps.ref();
+        nixl_status_t ret = ep.flushEp(req, flushCompletedCb, ref);
+        if (ret != NIXL_IN_PROG) {
+            // Callback is not invoked
+            ref->unref();
+            if (ret == NIXL_SUCCESS) {
+                stamps.xferDone.mark();
+            }
+        }
+        return ret;
+    }
 }
 
 /****************************************
@@ -46,10 +127,13 @@ namespace {
 
 class nixlUcxBackendH : public nixlBackendReqH {
 private:
-    std::set<ucx_connection_ptr_t> connections_;
+    // Connections are kept in a vector: a request rarely targets more than
+    // one, and the capacity survives handle recycling, unlike set nodes
+    std::vector<ucx_connection_ptr_t> connections_;
     std::vector<nixlUcxReq> requests_;
     nixlUcxWorker *worker;
     size_t worker_id;
+    ucx_stamps_ptr_t stamps_{new nixlUcxStamps()};
 
     // Notification to be sent after completion of all requests
     struct Notif {
@@ -74,6 +158,13 @@ private:
         return status;
     }
 
+    void
+    addConnection(const ucx_connection_ptr_t &conn) {
+        if (std::find(connections_.begin(), connections_.end(), conn) == connections_.end()) {
+            connections_.push_back(conn);
+        }
+    }
+
 public:
     nixlUcxBackendH(nixlUcxWorker *worker, size_t worker_id)
         : worker(worker),
@@ -84,6 +175,34 @@ public:
         return notif;
     }
 
+    nixlUcxStamps &
+    stamps() {
+        return *stamps_;
+    }
+
+    // Starts stamping a new transfer, stamps still referenced by callbacks of
+    // previous operations are left to them
+    void
+    resetStamps() {
+        if (stamps_->isShared()) {
+            stamps_.reset(new nixlUcxStamps());
+        } else {
+            stamps_->xferDone.reset();
+            stamps_->notifDone.reset();
+        }
+    }
+
+    // Reports the completion times stamped by the callbacks in the handle
+    void
+    publishStamps() {
+        if (auto done = stamps_->xferDone.get()) {
+            xferDone.mark(*done);
+        }
+        if (auto done = stamps_->notifDone.get()) {
+            notifDone.mark(*done);
+        }
+    }
+
     void
     reserve(size_t size) {
         requests_.reserve(size);
@@ -95,10 +214,10 @@ public:
         switch (status) {
         case NIXL_IN_PROG:
             requests_.push_back(req);
-            connections_.insert(conn);
+            addConnection(conn);
             break;
         case NIXL_SUCCESS:
-            connections_.insert(conn);
+            addConnection(conn);
             break;
         default:
             // Error. Release all previously initiated ops and exit:
@@ -108,7 +227,7 @@ public:
         return NIXL_SUCCESS;
     }
 
-    const std::set<ucx_connection_ptr_t> &
+    const std::vector<ucx_connection_ptr_t> &
     getConnections() const {
         return connections_;
     }
@@ -118,6 +237,11 @@ public:
         return false;
     }
 
+    virtual bool
+    isStriped() const {
+        return false;
+    }
+
     virtual nixl_status_t
     release() {
         // TODO: Error log: uncompleted requests found! Cancelling ...
@@ -140,6 +264,7 @@ public:
         if (requests_.empty()) {
             /* No pending transmissions */
             connections_.clear();
+            publishStamps();
             return NIXL_SUCCESS;
         }
 
@@ -180,6 +305,9 @@ public:
         if (requests_.empty()) {
             connections_.clear();
         }
+        if (out_ret == NIXL_SUCCESS) {
+            publishStamps();
+        }
         return out_ret;
     }
 
@@ -200,6 +328,71 @@ public:
     }
 };
 
+/*
+ * This class represents a request whose large descriptors are split into
+ * chunks and spread over all shared workers. Every stripe tracks the requests
+ * posted on its worker, while the handle itself is bound to the worker the
+ * request was prepared on and carries the notification, which is sent only
+ * once all the stripes are completed.
+ */
+class nixlUcxStripedBackendH : public nixlUcxBackendH {
+public:
+    nixlUcxStripedBackendH(const std::vector<std::unique_ptr<nixlUcxWorker>> &workers,
+                           size_t num_stripes,
+                           size_t worker_id)
+        : nixlUcxBackendH(workers[worker_id].get(), worker_id) {
+        stripes_.reserve(num_stripes);
+        for (size_t i = 0; i < num_stripes; ++i) {
+            stripes_.emplace_back(workers[i].get(), i);
+        }
+    }
+
+    size_t
+    getNumStripes() const {
+        return stripes_.size();
+    }
+
+    nixlUcxBackendH &
+    getStripe(size_t idx) {
+        return stripes_[idx];
+    }
+
+    bool
+    isStriped() const override {
+        return true;
+    }
+
+    nixl_status_t
+    release() override {
+        for (auto &stripe : stripes_) {
+            stripe.release();
+        }
+        return nixlUcxBackendH::release();
+    }
+
+    nixl_status_t
+    status() override {
+        nixl_status_t out_ret = NIXL_SUCCESS;
+        for (auto &stripe : stripes_) {
+            nixl_status_t ret = stripe.status();
+            if (ret == NIXL_IN_PROG) {
+                out_ret = NIXL_IN_PROG;
+            } else if (ret != NIXL_SUCCESS) {
+                return ret;
+            }
+        }
+
+        if (out_ret != NIXL_SUCCESS) {
+            return out_ret;
+        }
+
+        return nixlUcxBackendH::status();
+    }
+
+private:
+    std::vector<nixlUcxBackendH> stripes_;
+};
+
 /****************************************
  * Progress thread management
 *****************************************/
@@ -291,19 +484,18 @@ private:
 
 class nixlUcxSharedThread : public nixlUcxThread {
 public:
-    nixlUcxSharedThread(const nixlUcxEngine *engine, size_t num_workers, nixlTime::us_t delay)
-        : nixlUcxThread(engine, num_workers) {
+    nixlUcxSharedThread(const nixlUcxEngine *engine,
+                        size_t num_workers,
+                        const nixlProgressPolicy &policy)
+        : nixlUcxThread(engine, num_workers),
+          policy_(policy) {
         if (pipe(controlPipe_) < 0) {
             throw std::runtime_error("Couldn't create progress thread control pipe");
         }
         // TODO: We need delay to manual periodic wakeup/polling as a temporary
         // workaround for UCX bug (poll wouldn't wake up some fds in particular
-        // circumstances)
-
-        // This will ensure that the resulting delay is at least 1ms and fits into int in order for
-        // it to be compatible with poll()
-        int delay_us = std::min((int)delay, std::numeric_limits<int>::max());
-        delay_ = std::chrono::ceil<std::chrono::milliseconds>(std::chrono::microseconds(delay_us));
+        // circumstances). The policy bounds the wait by its maximum sleep.
+        NIXL_DEBUG << "shared " << *this << " using " << policy_;
 
         pollFds_.resize(num_workers + 1);
         pollFds_.back() = {controlPipe_[0], POLLIN, 0};
@@ -336,20 +528,29 @@ protected:
         bool timeout = true;
         bool pthr_stop = false;
         while (!pthr_stop) {
+            bool active = false;
             for (size_t i = 0; i < pollFds_.size() - 1; i++) {
                 if (!(pollFds_[i].revents & POLLIN) && !timeout) continue;
                 pollFds_[i].revents = 0;
                 nixlUcxWorker *worker = getWorkers()[i];
                 do {
-                    while (worker->progress())
-                        ;
+                    while (worker->progress()) {
+                        active = true;
+                    }
                 } while (worker->arm() == NIXL_IN_PROG);
             }
             timeout = false;
 
+            if (active) {
+                policy_.onActivity();
+            }
+
+            const nixlTime::us_t wait = policy_.nextWait();
+            const timespec wait_ts = {static_cast<time_t>(wait / 1000000),
+                                      static_cast<long>(wait % 1000000) * 1000};
             int ret;
-            while ((ret = poll(pollFds_.data(), pollFds_.size(), delay_.count())) < 0)
-                NIXL_PTRACE << "Call to poll() was interrupted, retrying";
+            while ((ret = ppoll(pollFds_.data(), pollFds_.size(), &wait_ts, nullptr)) < 0)
+                NIXL_PTRACE << "Call to ppoll() was interrupted, retrying";
 
             if (!ret) {
                 timeout = true;
@@ -368,7 +569,7 @@ protected:
     }
 
 private:
-    std::chrono::milliseconds delay_;
+    nixlProgressPolicy policy_;
     int controlPipe_[2];
     std::vector<pollfd> pollFds_;
 };
@@ -380,7 +581,10 @@ nixlUcxThreadEngine::nixlUcxThreadEngine(const nixlBackendInitParams &init_param
     }
 
     size_t num_workers = getWorkers().size();
-    thread_ = std::make_unique<nixlUcxSharedThread>(this, num_workers, init_params.pthrDelay);
+    thread_ = std::make_unique<nixlUcxSharedThread>(
+        this,
+        num_workers,
+        makeProgressPolicy(init_params));
     for (size_t i = 0; i < num_workers; i++) {
         thread_->addWorker(getWorkers()[i].get(), i);
     }
@@ -435,6 +639,7 @@ public:
         NIXL_ASSERT(sharedState_.get() == nullptr);
         sharedState_ = shared_state;
         setWorker(worker, worker_id);
+        resetStamps();
     }
 
     void
@@ -461,6 +666,7 @@ private:
 struct nixlUcxBackendSharedState {
     std::atomic<nixl_status_t> status;
     std::atomic<size_t> pendingReqs;
+    nixlCompletionStamp xferDone; // Latest completion of the chunks
     std::vector<nixlUcxChunkBackendH> chunks;
 
     nixlUcxBackendSharedState() : status(NIXL_SUCCESS), pendingReqs(0) {}
@@ -478,6 +684,8 @@ nixlUcxChunkBackendH::complete(nixl_status_t status) {
     if (status != NIXL_SUCCESS) {
         nixlUcxBackendH::release();
         sharedState_->status.store(status);
+    } else if (auto done = stamps().xferDone.get()) {
+        sharedState_->xferDone.mark(*done);
     }
     sharedState_->pendingReqs.fetch_sub(1);
     NIXL_TRACE << *this << " completed with status: " << status << ", " << *sharedState_;
@@ -527,6 +735,7 @@ public:
     startXfer() {
         NIXL_ASSERT(sharedState_->pendingReqs.load() == 0);
         sharedState_->status.store(NIXL_SUCCESS);
+        sharedState_->xferDone.reset();
         sharedState_->pendingReqs.store(getNumChunks());
     }
 
@@ -571,6 +780,9 @@ public:
             return status;
         }
 
+        if (auto done = sharedState_->xferDone.get()) {
+            xferDone.mark(*done);
+        }
         return sharedState_->status.load();
     }
 
@@ -664,8 +876,10 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
     splitBatchSize_ = nixl_b_params_get(init_params.customParams, "split_batch_size", 1024);
 
     if (init_params.enableProgTh) {
-        sharedThread_ =
-            std::make_unique<nixlUcxSharedThread>(this, numSharedWorkers_, init_params.pthrDelay);
+        sharedThread_ = std::make_unique<nixlUcxSharedThread>(
+            this,
+            numSharedWorkers_,
+            makeProgressPolicy(init_params));
         for (size_t i = 0; i < numSharedWorkers_; i++) {
             sharedThread_->addWorker(getWorkers()[i].get(), i);
         }
@@ -698,15 +912,16 @@ nixlUcxThreadPoolEngine::~nixlUcxThreadPoolEngine() {
 }
 
 nixl_status_t
-nixlUcxThreadPoolEngine::prepXfer(const nixl_xfer_op_t &operation,
-                                  const nixl_meta_dlist_t &local,
-                                  const nixl_meta_dlist_t &remote,
-                                  const std::string &remote_agent,
-                                  nixlBackendReqH *&handle,
-                                  const nixl_opt_b_args_t *opt_args) const {
+nixlUcxThreadPoolEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                                       const nixl_meta_span_t &local,
+                                       const nixl_meta_span_t &remote,
+                                       const std::string &remote_agent,
+                                       nixlBackendReqH *&handle,
+                                       const nixl_opt_b_args_t *opt_args) const {
     size_t batch_size = local.descCount();
     if (batch_size < splitBatchSize_) {
-        return nixlUcxEngine::prepXfer(operation, local, remote, remote_agent, handle, opt_args);
+        return nixlUcxEngine::prepXferSpans(
+            operation, local, remote, remote_agent, handle, opt_args);
     }
 
     size_t chunk_size = std::max(batch_size / dedicatedThreads_.size(), splitBatchSize_);
@@ -722,8 +937,8 @@ nixlUcxThreadPoolEngine::prepXfer(const nixl_xfer_op_t &operation,
 
 nixl_status_t
 nixlUcxThreadPoolEngine::sendXferRange(const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
+                                       const nixl_meta_span_t &local,
+                                       const nixl_meta_span_t &remote,
                                        const std::string &remote_agent,
                                        nixlBackendReqH *handle,
                                        size_t start_idx,
@@ -821,7 +1036,17 @@ nixlUcxEngine::create(const nixlBackendInitParams &init_params) {
 nixlUcxEngine::nixlUcxEngine(const nixlBackendInitParams &init_params)
     : nixlBackendEngine(&init_params),
       sharedWorkerIndex_(1),
-      progressThreadEnabled_(init_params.enableProgTh) {
+      progressThreadEnabled_(init_params.enableProgTh),
+      lazyRkeyUnpack_(nixl_b_params_get(init_params.customParams, "lazy_rkey_unpack", 1) != 0),
+      stripeThreshold_(
+          nixl_b_params_get(init_params.customParams, "stripe_threshold", size_t(0))),
+      stripeChunkSize_(std::max(
+          nixl_b_params_get(init_params.customParams, "stripe_chunk_size", size_t(4 << 20)),
+          size_t(1))),
+      handlePoolSize_(
+          nixl_b_params_get(init_params.customParams, "handle_pool_size", size_t(1024))),
+      postEventId_(registerTelemetryEvent("ucx_xfer_post_descs")),
+      notifEventId_(registerTelemetryEvent("ucx_notif_sent")) {
     std::vector<std::string> devs; /* Empty vector */
     nixl_b_params_t *custom_params = init_params.customParams;
 
@@ -862,6 +1087,7 @@ nixlUcxEngine::nixlUcxEngine(const nixlBackendInitParams &init_params)
     for (size_t i = 0; i < num_workers; i++) {
         uws.emplace_back(std::make_unique<nixlUcxWorker>(*uc, err_handling_mode));
     }
+    handlePools_ = std::make_unique<handlePool[]>(num_workers);
 
     auto &uw = uws.front();
     workerAddr = uw->epAddr();
@@ -991,28 +1217,74 @@ nixl_status_t nixlUcxEngine::getPublicData (const nixlBackendMD* meta,
 }
 
 
+nixlUcxPublicMetadata::nixlUcxPublicMetadata(ucx_connection_ptr_t connection,
+                                             nixl_blob_t rkey_buffer)
+    : nixlBackendMD(false),
+      conn(std::move(connection)),
+      rkeyBuffer_(std::move(rkey_buffer)),
+      rkeys_(new std::atomic<nixl::ucx::rkey *>[conn->getNumEps()]) {
+    for (size_t i = 0; i < conn->getNumEps(); ++i) {
+        rkeys_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+nixlUcxPublicMetadata::~nixlUcxPublicMetadata() {
+    for (size_t i = 0; i < conn->getNumEps(); ++i) {
+        delete rkeys_[i].load(std::memory_order_acquire);
+    }
+}
+
+const nixl::ucx::rkey &
+nixlUcxPublicMetadata::unpackRkey(size_t id) const {
+    auto unpacked = std::make_unique<nixl::ucx::rkey>(*conn->getEp(id), rkeyBuffer_.data());
+    nixl::ucx::rkey *expected = nullptr;
+    // Several threads may share a worker, the first one to publish its rkey wins
+    if (rkeys_[id].compare_exchange_strong(
+            expected, unpacked.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return *unpacked.release();
+    }
+    return *expected;
+}
+
+const nixl::ucx::rkey *
+nixlUcxPublicMetadata::tryUnpackRkey(size_t id) const noexcept {
+    try {
+        return &unpackRkey(id);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Failed to get rkey for worker " << id << ": " << e.what();
+        return nullptr;
+    }
+}
+
+size_t
+nixlUcxPublicMetadata::getNumUnpacked() const noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < conn->getNumEps(); ++i) {
+        count += (rkeys_[i].load(std::memory_order_relaxed) != nullptr);
+    }
+    return count;
+}
+
 // To be cleaned up
 nixl_status_t
 nixlUcxEngine::internalMDHelper (const nixl_blob_t &blob,
                                  const std::string &agent,
                                  nixlBackendMD* &output) {
-    try {
-        auto md = std::make_unique<nixlUcxPublicMetadata>();
-        size_t size = blob.size();
-
-        auto search = remoteConnMap.find(agent);
+    auto search = remoteConnMap.find(agent);
 
-        if (search == remoteConnMap.end()) {
-            // TODO: err: remote connection not found
-            return NIXL_ERR_NOT_FOUND;
-        }
-        md->conn = search->second;
+    if (search == remoteConnMap.end()) {
+        // TODO: err: remote connection not found
+        return NIXL_ERR_NOT_FOUND;
+    }
 
-        std::vector<char> addr(size);
-        nixlSerDes::_stringToBytes(addr.data(), blob, size);
+    try {
+        auto md = std::make_unique<nixlUcxPublicMetadata>(search->second, blob);
 
-        for (size_t wid = 0; wid < uws.size(); wid++) {
-            md->addRkey(*md->conn->getEp(wid), addr.data());
+        if (!lazyRkeyUnpack_) {
+            for (size_t wid = 0; wid < uws.size(); wid++) {
+                (void)md->getRkey(wid);
+            }
         }
 
         output = (nixlBackendMD *)md.release();
@@ -1098,37 +1370,118 @@ nixlUcxEngine::getWorkerIdFromOptArgs(const nixl_opt_b_args_t &opt_args) const n
     }
 }
 
-nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
-                                       const std::string &remote_agent,
-                                       nixlBackendReqH* &handle,
-                                       const nixl_opt_b_args_t* opt_args) const
-{
+nixl_status_t
+nixlUcxEngine::prepXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return prepXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlUcxEngine::estimateXferCost(const nixl_xfer_op_t &operation,
+                                const nixl_meta_dlist_t &local,
+                                const nixl_meta_dlist_t &remote,
+                                const std::string &remote_agent,
+                                nixlBackendReqH *const &handle,
+                                std::chrono::microseconds &duration,
+                                std::chrono::microseconds &err_margin,
+                                nixl_cost_t &method,
+                                const nixl_opt_args_t *opt_args) const {
+    return estimateXferCostSpans(
+        operation, local, remote, remote_agent, handle, duration, err_margin, method, opt_args);
+}
+
+nixl_status_t
+nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    return postXferSpans(operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+nixlUcxEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
     if (local.descCount() == 0 || remote.descCount() == 0) {
         NIXL_ERROR << "Local or remote descriptor list is empty";
         return NIXL_ERR_INVALID_PARAM;
     }
 
     const auto worker_id = getWorkerId(opt_args);
-    /* TODO: try to get from a pool first */
-    auto *ucx_handle = new nixlUcxBackendH(getWorker(worker_id).get(), worker_id);
-
-    handle = ucx_handle;
+    const bool worker_pinned = opt_args && getWorkerIdFromOptArgs(*opt_args);
+
+    /* Stripe only when there is more than one shared worker to spread the
+     * load over, and the user did not ask for a particular worker */
+    if (stripeThreshold_ > 0 && getSharedWorkersSize() > 1 && !worker_pinned) {
+        for (int i = 0; i < local.descCount(); ++i) {
+            if (local[i].len >= stripeThreshold_) {
+                handle = new nixlUcxStripedBackendH(uws, getSharedWorkersSize(), worker_id);
+                return NIXL_SUCCESS;
+            }
+        }
+    }
 
+    handle = acquireHandle(worker_id);
     return NIXL_SUCCESS;
 }
 
-nixl_status_t nixlUcxEngine::estimateXferCost (const nixl_xfer_op_t &operation,
-                                               const nixl_meta_dlist_t &local,
-                                               const nixl_meta_dlist_t &remote,
-                                               const std::string &remote_agent,
-                                               nixlBackendReqH* const &handle,
-                                               std::chrono::microseconds &duration,
-                                               std::chrono::microseconds &err_margin,
-                                               nixl_cost_t &method,
-                                               const nixl_opt_args_t* opt_args) const
-{
+nixlUcxBackendH *
+nixlUcxEngine::acquireHandle(size_t worker_id) const {
+    auto &pool = handlePools_[worker_id];
+    {
+        std::lock_guard<std::mutex> lock(pool.lock);
+        if (!pool.handles.empty()) {
+            nixlUcxBackendH *handle = pool.handles.back().release();
+            pool.handles.pop_back();
+            return handle;
+        }
+    }
+
+    return new nixlUcxBackendH(getWorker(worker_id).get(), worker_id);
+}
+
+void
+nixlUcxEngine::recycleHandle(nixlUcxBackendH *handle) const {
+    std::unique_ptr<nixlUcxBackendH> owned(handle);
+
+    // Composite and striped handles carry per-request state sized by the
+    // request, only plain handles are kept for reuse
+    if (handle->isComposite() || handle->isStriped()) {
+        return;
+    }
+
+    // Handle was released, only the notification and the stamps may be left in place
+    handle->notification().reset();
+    handle->resetStamps();
+    handle->xferDone.reset();
+    handle->notifDone.reset();
+
+    auto &pool = handlePools_[handle->getWorkerId()];
+    std::lock_guard<std::mutex> lock(pool.lock);
+    if (pool.handles.size() < handlePoolSize_) {
+        pool.handles.push_back(std::move(owned));
+    }
+}
+
+nixl_status_t
+nixlUcxEngine::estimateXferCostSpans(const nixl_xfer_op_t &operation,
+                                     const nixl_meta_span_t &local,
+                                     const nixl_meta_span_t &remote,
+                                     const std::string &remote_agent,
+                                     nixlBackendReqH *const &handle,
+                                     std::chrono::microseconds &duration,
+                                     std::chrono::microseconds &err_margin,
+                                     nixl_cost_t &method,
+                                     const nixl_opt_args_t *opt_args) const {
     nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
     size_t workerId = intHandle->getWorkerId();
 
@@ -1178,8 +1531,8 @@ nixl_status_t nixlUcxEngine::estimateXferCost (const nixl_xfer_op_t &operation,
 nixlUcxEngine::batchResult
 nixlUcxEngine::sendXferRangeBatch(nixlUcxEp &ep,
                                   nixl_xfer_op_t operation,
-                                  const nixl_meta_dlist_t &local,
-                                  const nixl_meta_dlist_t &remote,
+                                  const nixl_meta_span_t &local,
+                                  const nixl_meta_span_t &remote,
                                   size_t worker_id,
                                   size_t start_idx,
                                   size_t end_idx) {
@@ -1199,10 +1552,16 @@ nixlUcxEngine::sendXferRangeBatch(nixlUcxEp &ep,
         }
 
         ++result.size;
+        const nixl::ucx::rkey *rkey = rmd->findRkey(worker_id);
         nixlUcxReq req;
-        nixl_status_t ret = operation == NIXL_READ ?
-            ep.read(raddr, rmd->getRkey(worker_id), laddr, lmd->mem, lsize, req) :
-            ep.write(laddr, lmd->mem, raddr, rmd->getRkey(worker_id), lsize, req);
+        nixl_status_t ret;
+        if (__builtin_expect(rkey == nullptr, 0)) {
+            ret = NIXL_ERR_BACKEND;
+        } else if (operation == NIXL_READ) {
+            ret = ep.read(raddr, *rkey, laddr, lmd->mem, lsize, req);
+        } else {
+            ret = ep.write(laddr, lmd->mem, raddr, *rkey, lsize, req);
+        }
 
         if (ret == NIXL_IN_PROG) {
             if (__builtin_expect(result.req != nullptr, 1)) {
@@ -1227,8 +1586,8 @@ nixlUcxEngine::sendXferRangeBatch(nixlUcxEp &ep,
 
 nixl_status_t
 nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
-                             const nixl_meta_dlist_t &local,
-                             const nixl_meta_dlist_t &remote,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
                              const std::string &remote_agent,
                              nixlBackendReqH *handle,
                              size_t start_idx,
@@ -1241,6 +1600,15 @@ nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    if (intHandle->isStriped()) {
+        return sendXferRangeStriped(operation,
+                                    local,
+                                    remote,
+                                    static_cast<nixlUcxStripedBackendH &>(*intHandle),
+                                    start_idx,
+                                    end_idx);
+    }
+
     /* Assuming we have a single EP, we need 3 requests: one pending request,
      * one flush request, and one notification request */
     intHandle->reserve(3);
@@ -1268,7 +1636,7 @@ nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
      */
     for (auto &conn : intHandle->getConnections()) {
         nixlUcxReq req;
-        ret = conn->getEp(workerId)->flushEp(req);
+        ret = flushForStamps(*conn->getEp(workerId), req, intHandle->stamps());
         if (intHandle->append(ret, req, conn) != NIXL_SUCCESS) {
             return ret;
         }
@@ -1278,12 +1646,85 @@ nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
 }
 
 nixl_status_t
-nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
-                        const nixl_meta_dlist_t &local,
-                        const nixl_meta_dlist_t &remote,
-                        const std::string &remote_agent,
-                        nixlBackendReqH *&handle,
-                        const nixl_opt_b_args_t *opt_args) const {
+nixlUcxEngine::sendXferRangeStriped(const nixl_xfer_op_t &operation,
+                                    const nixl_meta_span_t &local,
+                                    const nixl_meta_span_t &remote,
+                                    nixlUcxStripedBackendH &handle,
+                                    size_t start_idx,
+                                    size_t end_idx) const {
+    const size_t num_stripes = handle.getNumStripes();
+    size_t next_stripe = handle.getWorkerId();
+
+    for (size_t s = 0; s < num_stripes; ++s) {
+        handle.getStripe(s).reserve(1);
+    }
+
+    for (size_t i = start_idx; i < end_idx; ++i) {
+        auto laddr = static_cast<uintptr_t>(local[i].addr);
+        auto raddr = static_cast<uint64_t>(remote[i].addr);
+        size_t lsize = local[i].len;
+        NIXL_ASSERT(lsize == remote[i].len);
+
+        auto lmd = static_cast<nixlUcxPrivateMetadata *>(local[i].metadataP);
+        auto rmd = static_cast<nixlUcxPublicMetadata *>(remote[i].metadataP);
+
+        /* Small descriptors stay on the worker of the handle */
+        size_t chunk_size = (lsize >= stripeThreshold_) ? stripeChunkSize_ : lsize;
+
+        for (size_t offset = 0; offset < lsize; offset += chunk_size) {
+            size_t stripe_id = (lsize >= stripeThreshold_) ? (next_stripe++ % num_stripes) :
+                                                             handle.getWorkerId();
+            size_t length = std::min(chunk_size, lsize - offset);
+            const nixl::ucx::rkey *rkey = rmd->findRkey(stripe_id);
+            auto &ep = rmd->conn->getEp(stripe_id);
+            nixlUcxReq req;
+            nixl_status_t ret;
+
+            if (__builtin_expect(rkey == nullptr, 0)) {
+                ret = NIXL_ERR_BACKEND;
+            } else if (operation == NIXL_READ) {
+                ret = ep->read(
+                    raddr + offset, *rkey, (void *)(laddr + offset), lmd->mem, length, req);
+            } else {
+                ret = ep->write(
+                    (void *)(laddr + offset), lmd->mem, raddr + offset, *rkey, length, req);
+            }
+
+            /* Completion of the chunks is tracked by the flush below */
+            if (ret == NIXL_IN_PROG) {
+                ucp_request_free(req);
+                ret = NIXL_SUCCESS;
+            }
+
+            if (handle.getStripe(stripe_id).append(ret, nullptr, rmd->conn) != NIXL_SUCCESS) {
+                handle.release();
+                return ret;
+            }
+        }
+    }
+
+    for (size_t s = 0; s < num_stripes; ++s) {
+        auto &stripe = handle.getStripe(s);
+        for (auto &conn : stripe.getConnections()) {
+            nixlUcxReq req;
+            nixl_status_t ret = flushForStamps(*conn->getEp(s), req, handle.stamps());
+            if (stripe.append(ret, req, conn) != NIXL_SUCCESS) {
+                handle.release();
+                return ret;
+            }
+        }
+    }
+
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlUcxEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                             const nixl_meta_span_t &local,
+                             const nixl_meta_span_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
     size_t lcnt = local.descCount();
     size_t rcnt = remote.descCount();
     nixlUcxBackendH *int_handle = static_cast<nixlUcxBackendH *>(handle);
@@ -1297,10 +1738,12 @@ nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
 
     // TODO: assert that handle is empty/completed, as we can't post request before completion
 
+    int_handle->resetStamps();
     ret = sendXferRange(operation, local, remote, remote_agent, handle, 0, lcnt);
     if (ret != NIXL_SUCCESS) {
         return ret;
     }
+    addTelemetryEvent(postEventId_, lcnt);
 
     ret = int_handle->status();
     if (opt_args && opt_args->hasNotif) {
@@ -1310,7 +1753,8 @@ nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
             ret = notifSendPriv(remote_agent,
                                 opt_args->notifMsg,
                                 rmd->conn->getEp(int_handle->getWorkerId()),
-                                &req);
+                                &req,
+                                int_handle);
             if (int_handle->append(ret, req, rmd->conn) != NIXL_SUCCESS) {
                 return ret;
             }
@@ -1346,7 +1790,11 @@ nixl_status_t nixlUcxEngine::checkXfer (nixlBackendReqH* handle) const
 
     nixlUcxReq req;
     nixl_status_t status =
-        notifSendPriv(notif->agent, notif->payload, conn->getEp(intHandle->getWorkerId()), &req);
+        notifSendPriv(notif->agent,
+                      notif->payload,
+                      conn->getEp(intHandle->getWorkerId()),
+                      &req,
+                      intHandle);
     notif.reset();
 
     if (intHandle->append(status, req, conn) != NIXL_SUCCESS) {
@@ -1361,9 +1809,7 @@ nixl_status_t nixlUcxEngine::releaseReqH(nixlBackendReqH* handle) const
     nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
     nixl_status_t status = intHandle->release();
 
-    /* TODO: return to a pool instead. */
-    delete intHandle;
-
+    recycleHandle(intHandle);
     return status;
 }
 
@@ -1384,7 +1830,8 @@ nixl_status_t
 nixlUcxEngine::notifSendPriv(const std::string &remote_agent,
                              const std::string &msg,
                              const std::unique_ptr<nixlUcxEp> &ep,
-                             nixlUcxReq *req) const {
+                             nixlUcxReq *req,
+                             nixlUcxBackendH *handle) const {
     nixlSerDes ser_des;
 
     ser_des.addStr("name", localAgent);
@@ -1392,22 +1839,39 @@ nixlUcxEngine::notifSendPriv(const std::string &remote_agent,
     // TODO: replace with mpool for performance
 
     std::string *buffer = new std::string(ser_des.exportStr());
-    auto deleter = [buffer, req](void *completed_request, void *ptr) {
+    // The deleter runs once in any case, the send completed successfully if it
+    // runs from the callback with a request completed without error
+    nixlUcxStamps *stamps = (handle != nullptr) ? handle->stamps().ref() : nullptr;
+    auto deleter = [buffer, req, stamps](void *completed_request, void *ptr) {
         delete buffer;
+        if (stamps != nullptr) {
+            if ((completed_request != nullptr) &&
+                (ucp_request_check_status(completed_request) == UCS_OK)) {
+                stamps->notifDone.mark();
+            }
+            stamps->unref();
+        }
         if ((req == nullptr) && (completed_request != nullptr)) {
             /* Caller is not interested in the request, free it */
             ucp_request_free(completed_request);
         }
     };
 
-    return ep->sendAm(NOTIF_STR,
-                      nullptr,
-                      0,
-                      (void *)buffer->data(),
-                      buffer->size(),
-                      UCP_AM_SEND_FLAG_EAGER,
-                      req,
-                      deleter);
+    nixl_status_t ret = ep->sendAm(NOTIF_STR,
+                                   nullptr,
+                                   0,
+                                   (void *)buffer->data(),
+                                   buffer->size(),
+                                   UCP_AM_SEND_FLAG_EAGER,
+                                   req,
+                                   deleter);
+    if ((ret == NIXL_SUCCESS) && (handle != nullptr)) {
+        handle->stamps().notifDone.mark();
+    }
+    if ((ret == NIXL_SUCCESS) || (ret == NIXL_IN_PROG)) {
+        addTelemetryEvent(notifEventId_, msg.size());
+    }
+    return ret;
 }
 
 ucx_connection_ptr_t
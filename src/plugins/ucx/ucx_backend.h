@@ -50,6 +50,11 @@ class nixlUcxConnection : public nixlBackendConnMD {
             return eps[ep_id];
         }
 
+        [[nodiscard]] size_t
+        getNumEps() const noexcept {
+            return eps.size();
+        }
+
     friend class nixlUcxEngine;
 };
 
@@ -77,27 +82,53 @@ class nixlUcxPrivateMetadata : public nixlBackendMD {
     friend class nixlUcxEngine;
 };
 
-// A public metadata has to implement put, and only has the remote metadata
+// A public metadata has to implement put, and only has the remote metadata.
+// The packed rkey is kept as is, and unpacked for a given worker on first use,
+// so that loading a peer with many regions does not pay for regions/workers
+// that are never accessed.
 class nixlUcxPublicMetadata : public nixlBackendMD {
 public:
-    nixlUcxPublicMetadata() : nixlBackendMD(false) {}
+    nixlUcxPublicMetadata(ucx_connection_ptr_t connection, nixl_blob_t rkey_buffer);
+    ~nixlUcxPublicMetadata();
+
+    nixlUcxPublicMetadata(const nixlUcxPublicMetadata &) = delete;
+    nixlUcxPublicMetadata &
+    operator=(const nixlUcxPublicMetadata &) = delete;
 
+    // Throws std::runtime_error if the rkey cannot be unpacked
     [[nodiscard]] const nixl::ucx::rkey &
     getRkey(size_t id) const {
-        return *rkeys_[id];
+        const nixl::ucx::rkey *rkey = rkeys_[id].load(std::memory_order_acquire);
+        return __builtin_expect(rkey != nullptr, 1) ? *rkey : unpackRkey(id);
     }
 
-    void
-    addRkey(const nixlUcxEp &ep, const void *rkey_buffer) {
-        rkeys_.emplace_back(std::make_unique<nixl::ucx::rkey>(ep, rkey_buffer));
+    // Same as getRkey, but returns nullptr instead of throwing
+    [[nodiscard]] const nixl::ucx::rkey *
+    findRkey(size_t id) const noexcept {
+        const nixl::ucx::rkey *rkey = rkeys_[id].load(std::memory_order_acquire);
+        return __builtin_expect(rkey != nullptr, 1) ? rkey : tryUnpackRkey(id);
     }
 
-    ucx_connection_ptr_t conn;
+    [[nodiscard]] size_t
+    getNumUnpacked() const noexcept;
+
+    const ucx_connection_ptr_t conn;
 
 private:
-    std::vector<std::unique_ptr<nixl::ucx::rkey>> rkeys_;
+    [[nodiscard]] const nixl::ucx::rkey &
+    unpackRkey(size_t id) const;
+
+    [[nodiscard]] const nixl::ucx::rkey *
+    tryUnpackRkey(size_t id) const noexcept;
+
+    const nixl_blob_t rkeyBuffer_;
+    // One slot per worker, populated lazily and released with the metadata
+    const std::unique_ptr<std::atomic<nixl::ucx::rkey *>[]> rkeys_;
 };
 
+class nixlUcxBackendH;
+class nixlUcxStripedBackendH;
+
 class nixlUcxEngine : public nixlBackendEngine {
 public:
     static std::unique_ptr<nixlUcxEngine>
@@ -153,7 +184,7 @@ public:
     nixl_status_t
     unloadMD(nixlBackendMD *input) override;
 
-    // Data transfer
+    // Data transfer, descriptor lists are forwarded to the span path
     nixl_status_t
     prepXfer(const nixl_xfer_op_t &operation,
              const nixl_meta_dlist_t &local,
@@ -181,6 +212,38 @@ public:
              nixlBackendReqH *&handle,
              const nixl_opt_b_args_t *opt_args = nullptr) const override;
 
+    bool
+    supportsXferSpans() const override {
+        return true;
+    }
+
+    nixl_status_t
+    prepXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    estimateXferCostSpans(const nixl_xfer_op_t &operation,
+                          const nixl_meta_span_t &local,
+                          const nixl_meta_span_t &remote,
+                          const std::string &remote_agent,
+                          nixlBackendReqH *const &handle,
+                          std::chrono::microseconds &duration,
+                          std::chrono::microseconds &err_margin,
+                          nixl_cost_t &method,
+                          const nixl_opt_args_t *opt_args = nullptr) const override;
+
+    nixl_status_t
+    postXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
+
     nixl_status_t
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
@@ -237,8 +300,8 @@ protected:
 
     virtual nixl_status_t
     sendXferRange(const nixl_xfer_op_t &operation,
-                  const nixl_meta_dlist_t &local,
-                  const nixl_meta_dlist_t &remote,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
                   const std::string &remote_agent,
                   nixlBackendReqH *handle,
                   size_t start_idx,
@@ -264,7 +327,8 @@ private:
     notifSendPriv(const std::string &remote_agent,
                   const std::string &msg,
                   const std::unique_ptr<nixlUcxEp> &ep,
-                  nixlUcxReq *req = nullptr) const;
+                  nixlUcxReq *req = nullptr,
+                  nixlUcxBackendH *handle = nullptr) const;
 
     ucx_connection_ptr_t
     getConnection(const std::string &remote_agent) const;
@@ -275,11 +339,25 @@ private:
         nixlUcxReq req;
     };
 
+    nixl_status_t
+    sendXferRangeStriped(const nixl_xfer_op_t &operation,
+                         const nixl_meta_span_t &local,
+                         const nixl_meta_span_t &remote,
+                         nixlUcxStripedBackendH &handle,
+                         size_t start_idx,
+                         size_t end_idx) const;
+
+    [[nodiscard]] nixlUcxBackendH *
+    acquireHandle(size_t worker_id) const;
+
+    void
+    recycleHandle(nixlUcxBackendH *handle) const;
+
     static batchResult
     sendXferRangeBatch(nixlUcxEp &ep,
                        nixl_xfer_op_t operation,
-                       const nixl_meta_dlist_t &local,
-                       const nixl_meta_dlist_t &remote,
+                       const nixl_meta_span_t &local,
+                       const nixl_meta_span_t &remote,
                        size_t worker_id,
                        size_t start_idx,
                        size_t end_idx);
@@ -298,6 +376,26 @@ private:
     mutable std::atomic<size_t> sharedWorkerIndex_;
 
     const bool progressThreadEnabled_;
+    const bool lazyRkeyUnpack_;
+
+    /* Descriptors of at least stripeThreshold_ bytes are split into chunks of
+     * stripeChunkSize_ bytes and spread over all shared workers, 0 disables */
+    const size_t stripeThreshold_;
+    const size_t stripeChunkSize_;
+
+    /* Released request handles, one freelist per worker. A handle may be
+     * released by another thread than the one which prepared it, hence the
+     * lock. Up to handlePoolSize_ handles are kept per worker, 0 disables */
+    struct handlePool {
+        std::mutex lock;
+        std::vector<std::unique_ptr<nixlUcxBackendH>> handles;
+    };
+    std::unique_ptr<handlePool[]> handlePools_;
+    const size_t handlePoolSize_;
+
+    /* Telemetry events of the data path, registered once */
+    const uint32_t postEventId_;
+    const uint32_t notifEventId_;
 
     /* Notifications */
     notif_list_t notifMainList;
@@ -339,12 +437,12 @@ public:
     ~nixlUcxThreadPoolEngine();
 
     nixl_status_t
-    prepXfer(const nixl_xfer_op_t &operation,
-             const nixl_meta_dlist_t &local,
-             const nixl_meta_dlist_t &remote,
-             const std::string &remote_agent,
-             nixlBackendReqH *&handle,
-             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    prepXferSpans(const nixl_xfer_op_t &operation,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
+                  const std::string &remote_agent,
+                  nixlBackendReqH *&handle,
+                  const nixl_opt_b_args_t *opt_args = nullptr) const override;
 
     size_t
     getSharedWorkersSize() const override {
@@ -360,8 +458,8 @@ protected:
 
     nixl_status_t
     sendXferRange(const nixl_xfer_op_t &operation,
-                  const nixl_meta_dlist_t &local,
-                  const nixl_meta_dlist_t &remote,
+                  const nixl_meta_span_t &local,
+                  const nixl_meta_span_t &remote,
                   const std::string &remote_agent,
                   nixlBackendReqH *handle,
                   size_t start_idx,
@@ -243,6 +243,9 @@ nixlUcxEp::sendAm(unsigned msg_id,
                   const am_deleter_t &deleter) {
     const nixl_status_t status = checkTxState();
     if (status != NIXL_SUCCESS) {
+        if (deleter) {
+            deleter(nullptr, buffer);
+        }
         return status;
     }
 
@@ -359,11 +362,16 @@ nixlUcxEp::estimateCost(size_t size,
 }
 
 nixl_status_t
-nixlUcxEp::flushEp(nixlUcxReq &req) {
+nixlUcxEp::flushEp(nixlUcxReq &req, ucp_send_nbx_callback_t cb, void *user_data) {
     ucp_request_param_t param;
     ucs_status_ptr_t request;
 
     param.op_attr_mask = 0;
+    if (cb != nullptr) {
+        param.op_attr_mask |= UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA;
+        param.cb.send = cb;
+        param.user_data = user_data;
+    }
     request = ucp_ep_flush_nbx(eph, &param);
 
     if (UCS_PTR_IS_PTR(request)) {
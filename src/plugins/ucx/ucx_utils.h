@@ -65,10 +65,9 @@ nixl_b_params_get(const nixl_b_params_t *custom_params, const std::string &key,
         return default_value;
     }
 
-    if constexpr (std::is_same_v<T, int>) {
-        T result;
-        return absl::SimpleAtoi(it->second, &result) ? result : default_value;
-    }
+    static_assert(std::is_integral_v<T>, "Only integral backend parameters are supported");
+    T result;
+    return absl::SimpleAtoi(it->second, &result) ? result : default_value;
 }
 
 using nixlUcxReq = void *;
@@ -126,6 +125,8 @@ public:
     nixlUcxEp &
     operator=(const nixlUcxEp &) = delete;
 
+    // Invoked once for the buffer, with the completed request if the send did not complete
+    // immediately
     using am_deleter_t = std::function<void(void *request, void *buffer)>;
 
     /* Active message handling */
@@ -159,8 +160,10 @@ public:
                  std::chrono::microseconds &duration,
                  std::chrono::microseconds &err_margin,
                  nixl_cost_t &method);
+    // The optional callback is invoked on completion of a flush which did not complete
+    // immediately
     nixl_status_t
-    flushEp(nixlUcxReq &req);
+    flushEp(nixlUcxReq &req, ucp_send_nbx_callback_t cb = nullptr, void *user_data = nullptr);
 
     [[nodiscard]] ucp_ep_h
     getEp() const noexcept {
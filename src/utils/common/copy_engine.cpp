@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "copy_engine.h"
+
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include <absl/strings/numbers.h>
+#include <absl/strings/str_format.h>
+#include <absl/strings/str_split.h>
+#include "nixl_log.h"
+
+namespace {
+// Parses a list of the sysfs format, such as "0-3,8,10-11"
+[[nodiscard]] std::vector<int>
+parseList(const std::string &list) {
+    std::vector<int> values;
+    for (const absl::string_view range : absl::StrSplit(list, ',', absl::SkipWhitespace())) {
+        const std::vector<absl::string_view> ends = absl::StrSplit(range, '-');
+        int low = 0;
+        int high = 0;
+        if (!absl::SimpleAtoi(ends[0], &low)) {
+            return {};
+        }
+        high = low;
+        if ((ends.size() > 1) && !absl::SimpleAtoi(ends[1], &high)) {
+            return {};
+        }
+        for (int v = low; v <= high; ++v) {
+            values.push_back(v);
+        }
+    }
+    return values;
+}
+
+[[nodiscard]] std::string
+readFile(const std::string &path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void
+pinToCpus(std::thread &thread, const std::vector<int> &cpus, const std::string &name) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    const int ret = pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+    if (ret != 0) {
+        NIXL_DEBUG << "Failed to pin a " << name << " copy worker: " << strerror(ret);
+    }
+}
+} // namespace
+
+void
+nixlCopyBatch::arm(size_t ranges, done_cb_t done_cb) {
+    doneCb_ = std::move(done_cb);
+    status_.store(NIXL_SUCCESS, std::memory_order_relaxed);
+    pending_.store(ranges, std::memory_order_relaxed);
+    done_.store(false, std::memory_order_release);
+}
+
+void
+nixlCopyBatch::run(size_t first, size_t last) {
+    const nixl_status_t ret = copy(first, last);
+    if (ret != NIXL_SUCCESS) {
+        nixl_status_t expected = NIXL_SUCCESS;
+        status_.compare_exchange_strong(expected, ret, std::memory_order_acq_rel);
+    }
+
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        nixl_status_t status = status_.load(std::memory_order_acquire);
+        if (doneCb_) {
+            status = doneCb_(status);
+        }
+        status_.store(status, std::memory_order_relaxed);
+        done_.store(true, std::memory_order_release);
+    }
+}
+
+void
+nixlCopyBatch::wait() const noexcept {
+    while (!isDone()) {
+        std::this_thread::yield();
+    }
+}
+
+nixlCopyEngine::nixlCopyEngine(const std::string &name, size_t num_threads, bool numa_aware)
+    : name_(name) {
+    std::vector<int> nodes;
+    if (numa_aware) {
+        nodes = parseList(readFile("/sys/devices/system/node/online"));
+    }
+
+    std::map<int, std::vector<int>> node_cpus;
+    for (const int node : nodes) {
+        auto cpus = parseList(
+            readFile(absl::StrFormat("/sys/devices/system/node/node%d/cpulist", node)));
+        if (!cpus.empty()) {
+            node_cpus.emplace(node, std::move(cpus));
+        }
+    }
+
+    // Without a NUMA topology, all the workers share a queue and are not pinned
+    if (node_cpus.empty()) {
+        if (num_threads > 0) {
+            queues_.push_back(std::make_unique<queue>());
+        }
+        for (size_t i = 0; i < num_threads; ++i) {
+            workers_.emplace_back([this, q = queues_.front().get()] { workerLoop(*q); });
+        }
+        return;
+    }
+
+    nodeQueues_.assign(node_cpus.rbegin()->first + 1, -1);
+    auto it = node_cpus.begin();
+    for (size_t i = 0; i < num_threads; ++i) {
+        const auto &[node, cpus] = *it;
+        if (nodeQueues_[node] < 0) {
+            nodeQueues_[node] = queues_.size();
+            queues_.push_back(std::make_unique<queue>());
+        }
+        queue *q = queues_[nodeQueues_[node]].get();
+        workers_.emplace_back([this, q] { workerLoop(*q); });
+        pinToCpus(workers_.back(), cpus, name_);
+        if (++it == node_cpus.end()) {
+            it = node_cpus.begin();
+        }
+    }
+    NIXL_DEBUG << absl::StrFormat(
+        "%s copy engine: %d workers on %d NUMA nodes", name_, workers_.size(), queues_.size());
+}
+
+nixlCopyEngine::~nixlCopyEngine() {
+    stop_.store(true);
+    for (auto &q : queues_) {
+        std::lock_guard<std::mutex> lock(q->mutex);
+        q->cv.notify_all();
+    }
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void
+nixlCopyEngine::submit(nixlCopyBatch &batch, size_t first, size_t last, int node) {
+    if (queues_.empty()) {
+        batch.run(first, last);
+        return;
+    }
+
+    size_t index;
+    if ((node >= 0) && (size_t(node) < nodeQueues_.size()) && (nodeQueues_[node] >= 0)) {
+        index = nodeQueues_[node];
+    } else {
+        index = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+
+    queue &q = *queues_[index];
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.push_back({&batch, first, last});
+    }
+    q.cv.notify_one();
+}
+
+void
+nixlCopyEngine::workerLoop(queue &q) {
+    for (;;) {
+        task t;
+        {
+            std::unique_lock<std::mutex> lock(q.mutex);
+            q.cv.wait(lock, [&] { return stop_.load() || !q.tasks.empty(); });
+            // Queued ranges are still copied on shutdown, so that no batch is left pending
+            if (q.tasks.empty()) {
+                return;
+            }
+            t = q.tasks.front();
+            q.tasks.pop_front();
+        }
+        t.batch->run(t.first, t.last);
+    }
+}
+
+int
+nixlCopyEngine::getNode(const void *addr) noexcept {
+    int node = -1;
+    if (syscall(SYS_get_mempolicy,
+                &node,
+                nullptr,
+                0,
+                const_cast<void *>(addr),
+                MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+        return -1;
+    }
+    return node;
+}
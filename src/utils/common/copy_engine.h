@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_UTILS_COMMON_COPY_ENGINE_H
+#define NIXL_SRC_UTILS_COMMON_COPY_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "nixl_types.h"
+
+/**
+ * @class nixlCopyBatch
+ * @brief The segments of one posted transfer, copied by ranges which may run on different
+ *        workers. The completion callback runs once, on the thread finishing the last range.
+ *        Backends own the segments and implement how a range is copied.
+ */
+class nixlCopyBatch {
+public:
+    using done_cb_t = std::function<nixl_status_t(nixl_status_t status)>;
+
+    virtual ~nixlCopyBatch() = default;
+
+    // Copies the segments [first, last) and completes one range
+    void
+    run(size_t first, size_t last);
+
+    [[nodiscard]] bool
+    isDone() const noexcept {
+        return done_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] nixl_status_t
+    getStatus() const noexcept {
+        return status_.load(std::memory_order_acquire);
+    }
+
+    // Blocks until the ranges of the current post are all completed
+    void
+    wait() const noexcept;
+
+protected:
+    // Arms the batch for the given number of ranges, at most one post may be in flight
+    void
+    arm(size_t ranges, done_cb_t done_cb);
+
+    [[nodiscard]] virtual nixl_status_t
+    copy(size_t first, size_t last) const = 0;
+
+private:
+    done_cb_t doneCb_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<nixl_status_t> status_{NIXL_SUCCESS};
+    std::atomic<bool> done_{true};
+};
+
+/**
+ * @class nixlCopyEngine
+ * @brief Worker threads which copy ranges of batches. Workers are spread over the NUMA nodes
+ *        and pinned to their CPUs, a range is queued to a worker on the node given by the
+ *        backend, which picks the node of the memory its copies should stay local to.
+ */
+class nixlCopyEngine {
+public:
+    // The name only tells the engines of the backends apart in the logs
+    nixlCopyEngine(const std::string &name, size_t num_threads, bool numa_aware);
+    ~nixlCopyEngine();
+
+    nixlCopyEngine(const nixlCopyEngine &) = delete;
+    nixlCopyEngine &
+    operator=(const nixlCopyEngine &) = delete;
+
+    [[nodiscard]] bool
+    hasWorkers() const noexcept {
+        return !workers_.empty();
+    }
+
+    // Queues the range [first, last) of the batch, node is a hint and may be negative
+    void
+    submit(nixlCopyBatch &batch, size_t first, size_t last, int node);
+
+    // NUMA node of the page at addr, or -1 when unknown
+    [[nodiscard]] static int
+    getNode(const void *addr) noexcept;
+
+private:
+    struct task {
+        nixlCopyBatch *batch;
+        size_t first;
+        size_t last;
+    };
+
+    struct queue {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<task> tasks;
+    };
+
+    void
+    workerLoop(queue &q);
+
+    const std::string name_;
+    std::vector<std::unique_ptr<queue>> queues_;
+    std::vector<int> nodeQueues_; // Queue of every NUMA node, or -1 without workers
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> nextQueue_{0};
+    std::atomic<bool> stop_{false};
+};
+
+#endif
@@ -26,7 +26,13 @@
 
 template<typename T> class sharedRingBuffer {
 public:
-    sharedRingBuffer(const std::string &name, bool create, int version, size_t size = 0);
+    // An existing buffer opened as read_only is mapped read-only and can only be observed
+    // with peek(), which does not consume items nor interfere with the producer
+    sharedRingBuffer(const std::string &name,
+                     bool create,
+                     int version,
+                     size_t size = 0,
+                     bool read_only = false);
     ~sharedRingBuffer();
 
     // Non-copyable
@@ -34,8 +40,10 @@ public:
     sharedRingBuffer &
     operator=(const sharedRingBuffer &) = delete;
 
+    // When overwrite is set and the buffer is full, the oldest item is dropped to make room,
+    // so that observers keep seeing the latest items when nobody consumes them
     bool
-    push(const T &item);
+    push(const T &item, bool overwrite = false);
     bool
     pop(T &item);
     size_t
@@ -49,6 +57,15 @@ public:
     size_t
     capacity() const;
 
+    // Position of the oldest item not consumed yet, a cursor to start observing from.
+    // Positions only grow, the slot of a position is the position masked by the capacity.
+    size_t
+    head() const;
+    // Copy up to max_items items from cursor onwards without consuming them and advance cursor.
+    // Items consumed or dropped before they were copied are skipped and added to skipped.
+    size_t
+    peek(size_t &cursor, T *items, size_t max_items, size_t &skipped) const;
+
 private:
     struct bufferHeader {
         std::atomic<size_t> write_pos{0};
@@ -71,6 +88,7 @@ private:
     bufferHeader *header_;
     T *data_;
     size_t bufferSize_;
+    const bool readOnly_;
 };
 
 #include "cyclic_buffer.tpp"
@@ -22,16 +22,27 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "nixl_log.h"
 #include "util.h"
 
 template<typename T>
-sharedRingBuffer<T>::sharedRingBuffer(const std::string &name, bool create, int version, size_t size)
+sharedRingBuffer<T>::sharedRingBuffer(const std::string &name,
+                                      bool create,
+                                      int version,
+                                      size_t size,
+                                      bool read_only)
     : header_(nullptr),
       data_(nullptr),
-      bufferSize_(size) {
+      bufferSize_(size),
+      readOnly_(read_only) {
 
     if (create) {
+        if (read_only) {
+            throw std::invalid_argument("Cannot create a read-only buffer");
+        }
+
         createCyclicBuffer(name, version);
     } else {
         openCyclicBuffer(name, version);
@@ -41,48 +52,59 @@ sharedRingBuffer<T>::sharedRingBuffer(const std::string &name, bool create, int
 template<typename T>
 sharedRingBuffer<T>::~sharedRingBuffer() {
     if (header_) {
-        msync(header_, getTotalSize(), MS_SYNC);
+        if (!readOnly_) {
+            msync(header_, getTotalSize(), MS_SYNC);
+        }
         munmap(header_, getTotalSize());
     }
 }
 
 template<typename T>
 bool
-sharedRingBuffer<T>::push(const T &item) {
+sharedRingBuffer<T>::push(const T &item, bool overwrite) {
+    if (readOnly_) return false;
+
     size_t write_pos = header_->write_pos.load(std::memory_order_relaxed);
-    size_t next_write = (write_pos + 1) & header_->mask;
+    size_t read_pos = header_->read_pos.load(std::memory_order_acquire);
 
-    if (next_write == header_->read_pos.load(std::memory_order_acquire))
-        return false; // Buffer full
+    if (write_pos - read_pos == header_->mask) {
+        if (!overwrite) return false; // Buffer full
 
-    data_[write_pos] = item;
+        // Drop the oldest item, unless the reader just consumed it, its slot is reused next
+        header_->read_pos.compare_exchange_strong(
+            read_pos, read_pos + 1, std::memory_order_acq_rel);
+    }
+
+    data_[write_pos & header_->mask] = item;
 
-    header_->write_pos.store(next_write, std::memory_order_release);
+    header_->write_pos.store(write_pos + 1, std::memory_order_release);
     return true;
 }
 
 template<typename T>
 bool
 sharedRingBuffer<T>::pop(T &item) {
-    size_t read_pos = header_->read_pos.load(std::memory_order_relaxed);
+    if (readOnly_) return false;
 
-    if (read_pos == header_->write_pos.load(std::memory_order_acquire)) return false;
+    size_t read_pos = header_->read_pos.load(std::memory_order_acquire);
 
-    // Read data
-    item = data_[read_pos];
+    // Claim the item, it may be dropped concurrently by a producer that overwrites
+    do {
+        if (read_pos == header_->write_pos.load(std::memory_order_acquire)) return false;
 
-    // Update read position
-    size_t next_read = (read_pos + 1) & header_->mask;
-    header_->read_pos.store(next_read, std::memory_order_release);
+        item = data_[read_pos & header_->mask];
+    } while (!header_->read_pos.compare_exchange_weak(
+        read_pos, read_pos + 1, std::memory_order_acq_rel, std::memory_order_acquire));
     return true;
 }
 
 template<typename T>
 size_t
 sharedRingBuffer<T>::size() const {
-    size_t write_pos = header_->write_pos.load(std::memory_order_acquire);
+    // The positions only grow, load the read position first so that it is not ahead
     size_t read_pos = header_->read_pos.load(std::memory_order_acquire);
-    return (write_pos - read_pos) & header_->mask;
+    size_t write_pos = header_->write_pos.load(std::memory_order_acquire);
+    return std::min(write_pos - read_pos, header_->mask);
 }
 
 template<typename T>
@@ -95,9 +117,7 @@ sharedRingBuffer<T>::empty() const {
 template<typename T>
 bool
 sharedRingBuffer<T>::full() const {
-    size_t write_pos = header_->write_pos.load(std::memory_order_acquire);
-    size_t next_write = (write_pos + 1) & header_->mask;
-    return next_write == header_->read_pos.load(std::memory_order_acquire);
+    return size() == header_->mask;
 }
 
 template<typename T>
@@ -112,6 +132,46 @@ sharedRingBuffer<T>::capacity() const {
     return header_->capacity;
 }
 
+template<typename T>
+size_t
+sharedRingBuffer<T>::head() const {
+    return header_->read_pos.load(std::memory_order_acquire);
+}
+
+template<typename T>
+size_t
+sharedRingBuffer<T>::peek(size_t &cursor, T *items, size_t max_items, size_t &skipped) const {
+    const size_t read_pos = header_->read_pos.load(std::memory_order_acquire);
+    const size_t write_pos = header_->write_pos.load(std::memory_order_acquire);
+
+    // The items before the read position were consumed or dropped, they may be overwritten.
+    // A cursor past the write position belongs to a buffer which was created again.
+    if (cursor < read_pos) {
+        skipped += read_pos - cursor;
+        cursor = read_pos;
+    } else if (cursor > write_pos) {
+        cursor = read_pos;
+    }
+
+    const size_t count = std::min(write_pos - cursor, max_items);
+    for (size_t i = 0; i < count; ++i) {
+        items[i] = data_[(cursor + i) & header_->mask];
+    }
+
+    // The producer only reuses slots freed by the reader or dropped by itself, both advance
+    // read_pos first, so the copies of the items which are still not freed are consistent
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const size_t freed = header_->read_pos.load(std::memory_order_relaxed);
+    const size_t torn = freed > cursor ? std::min(freed - cursor, count) : 0;
+    if (torn != 0) {
+        std::copy(items + torn, items + count, items);
+        skipped += torn;
+    }
+
+    cursor += count;
+    return count - torn;
+}
+
 template<typename T>
 sharedRingBuffer<T>::bufferHeader::bufferHeader(size_t size) : capacity(size), mask(size - 1) {
     if ((size & (size - 1)) != 0) {
@@ -181,7 +241,7 @@ sharedRingBuffer<T>::openCyclicBuffer(const std::string &name, int version) {
         delete fd;
     };
 
-    int fd = open(name.c_str(), O_RDWR);
+    int fd = open(name.c_str(), readOnly_ ? O_RDONLY : O_RDWR);
     if (fd == -1) {
         NIXL_ERROR << "Failed to open a file for shared memory: " << name
                    << " with error: " << strerror(errno);
@@ -204,11 +264,14 @@ sharedRingBuffer<T>::openCyclicBuffer(const std::string &name, int version) {
         throw std::runtime_error("File too small for buffer header");
     }
 
+    const int prot = readOnly_ ? PROT_READ : PROT_READ | PROT_WRITE;
+
     // First, map just the header to read the size
-    void *header_ptr =
-        mmap(nullptr, sizeof(bufferHeader), PROT_READ | PROT_WRITE, MAP_SHARED, *file_fd, 0);
+    void *header_ptr = mmap(nullptr, sizeof(bufferHeader), prot, MAP_SHARED, *file_fd, 0);
     if (header_ptr == MAP_FAILED) {
-        unlink(name.c_str());
+        if (!readOnly_) {
+            unlink(name.c_str());
+        }
         NIXL_ERROR << "Failed to map header memory: " << name
                    << " with error: " << strerror(errno);
         throw std::runtime_error("Failed to map header memory");
@@ -220,7 +283,9 @@ sharedRingBuffer<T>::openCyclicBuffer(const std::string &name, int version) {
     int current_version = temp_header->version.load(std::memory_order_acquire);
     if (current_version != version) {
         munmap(temp_header, sizeof(bufferHeader));
-        unlink(name.c_str());
+        if (!readOnly_) {
+            unlink(name.c_str());
+        }
         NIXL_ERROR << "Version mismatch: expected " + std::to_string(version) + ", got " +
                 std::to_string(current_version);
         throw std::runtime_error("Version mismatch: expected " + std::to_string(version) +
@@ -243,7 +308,7 @@ sharedRingBuffer<T>::openCyclicBuffer(const std::string &name, int version) {
     munmap(temp_header, sizeof(bufferHeader));
 
     // Map the entire buffer
-    void *ptr = mmap(nullptr, getTotalSize(), PROT_READ | PROT_WRITE, MAP_SHARED, *file_fd, 0);
+    void *ptr = mmap(nullptr, getTotalSize(), prot, MAP_SHARED, *file_fd, 0);
     if (ptr == MAP_FAILED) {
         NIXL_ERROR << "Failed to map file memory: " << name
                    << " with error: " << strerror(errno);
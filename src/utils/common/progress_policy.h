@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_UTILS_COMMON_PROGRESS_POLICY_H
+#define NIXL_SRC_UTILS_COMMON_PROGRESS_POLICY_H
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+
+#include "absl/strings/numbers.h"
+#include "common/nixl_log.h"
+#include "common/nixl_time.h"
+#include "nixl_types.h"
+
+/*
+ * Decides how long a progress thread waits between two progress iterations.
+ * After an iteration that made progress the thread keeps polling without
+ * waiting for spinBudget microseconds, then waits for minSleep, doubling the
+ * wait on every idle iteration up to maxSleep. The wait is expected to be
+ * interrupted by an event when the backend supports it.
+ *
+ * The policy is configured with the following backend parameters:
+ *   progress_spin_us       - busy-poll budget after activity (default: 0)
+ *   progress_min_sleep_us  - first wait after the budget is spent
+ *   progress_max_sleep_us  - upper bound of the wait
+ * Both wait bounds default to the agent progress thread delay, which keeps
+ * the fixed delay behavior when no parameter is given.
+ */
+class nixlProgressPolicy {
+public:
+    nixlProgressPolicy(nixlTime::us_t spin_budget,
+                       nixlTime::us_t min_sleep,
+                       nixlTime::us_t max_sleep)
+        : spinBudget_(spin_budget),
+          minSleep_(std::min(min_sleep, max_sleep)),
+          maxSleep_(max_sleep),
+          sleep_(minSleep_) {}
+
+    [[nodiscard]] static nixlProgressPolicy
+    fromParams(const nixl_b_params_t *params, nixlTime::us_t delay) {
+        const auto spin_budget = getParam(params, "progress_spin_us", 0);
+        const auto min_sleep = getParam(params, "progress_min_sleep_us", delay);
+        const auto max_sleep = getParam(params, "progress_max_sleep_us", delay);
+        if (min_sleep > max_sleep) {
+            NIXL_WARN << "progress_min_sleep_us (" << min_sleep
+                      << ") exceeds progress_max_sleep_us (" << max_sleep << "), using "
+                      << max_sleep;
+        }
+        return nixlProgressPolicy(spin_budget, min_sleep, max_sleep);
+    }
+
+    // Called after a progress iteration which completed some work
+    void
+    onActivity() noexcept {
+        if (spinBudget_ > 0) {
+            lastActivity_ = nixlTime::getUs();
+        }
+        sleep_ = minSleep_;
+    }
+
+    // Returns the time to wait before the next progress iteration
+    [[nodiscard]] nixlTime::us_t
+    nextWait() noexcept {
+        if (spinBudget_ > 0 && nixlTime::getUs() - lastActivity_ < spinBudget_) {
+            return 0;
+        }
+
+        const nixlTime::us_t wait = sleep_;
+        sleep_ = std::min(std::max<nixlTime::us_t>(sleep_ * 2, 1), maxSleep_);
+        return wait;
+    }
+
+    friend std::ostream &
+    operator<<(std::ostream &os, const nixlProgressPolicy &policy) {
+        return os << "progress policy {spin: " << policy.spinBudget_
+                  << "us, sleep: " << policy.minSleep_ << "-" << policy.maxSleep_ << "us}";
+    }
+
+private:
+    [[nodiscard]] static nixlTime::us_t
+    getParam(const nixl_b_params_t *params, const std::string &key, nixlTime::us_t default_value) {
+        if (!params) {
+            return default_value;
+        }
+
+        const auto it = params->find(key);
+        if (it == params->end()) {
+            return default_value;
+        }
+
+        nixlTime::us_t value;
+        if (!absl::SimpleAtoi(it->second, &value)) {
+            NIXL_WARN << "Invalid " << key << " value '" << it->second << "', using "
+                      << default_value;
+            return default_value;
+        }
+        return value;
+    }
+
+    const nixlTime::us_t spinBudget_;
+    const nixlTime::us_t minSleep_;
+    const nixlTime::us_t maxSleep_;
+    nixlTime::us_t sleep_;
+    nixlTime::us_t lastActivity_ = 0;
+};
+
+#endif /* NIXL_SRC_UTILS_COMMON_PROGRESS_POLICY_H */
@@ -16,9 +16,61 @@
  */
 #include <cstring>
 
+#if HAVE_LZ4
+#include <lz4.h>
+#endif
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 #include "serdes.h"
 #include "common/nixl_log.h"
 
+namespace {
+// Compressed blobs start with a tag which older versions reject as not being a nixlSerDes blob,
+// followed by the codec and the size of the uncompressed blob
+const std::string compressed_tag = "nixlSerDesZ";
+constexpr size_t compressed_header_size = 11 + sizeof(uint8_t) + sizeof(uint64_t);
+// Bounds of the uncompressed size, against corrupted or malicious headers: blobs which compress
+// better than the ratio are exported uncompressed, so that importers never allocate more than
+// the ratio times the size of the received payload
+constexpr uint64_t max_uncompressed_size = 1ULL << 32;
+constexpr uint64_t max_compression_ratio = 1024;
+
+#if HAVE_ZSTD
+constexpr int zstd_level = 3;
+
+bool
+compressZstd(const std::string &src, std::string &dst) {
+    dst.resize(ZSTD_compressBound(src.size()));
+    const size_t size = ZSTD_compress(&dst[0], dst.size(), src.data(), src.size(), zstd_level);
+    if (ZSTD_isError(size)) {
+        NIXL_WARN << "ZSTD compression failed: " << ZSTD_getErrorName(size);
+        return false;
+    }
+    dst.resize(size);
+    return true;
+}
+
+bool
+decompressZstd(const char *src, size_t src_size, std::string &dst) {
+    // The frames of the exporter record their size, check it before decompressing
+    if (ZSTD_getFrameContentSize(src, src_size) != dst.size()) {
+        NIXL_ERROR << "Deserialization failed, ZSTD frame size mismatch";
+        return false;
+    }
+
+    const size_t size = ZSTD_decompress(&dst[0], dst.size(), src, src_size);
+    if (ZSTD_isError(size) || size != dst.size()) {
+        NIXL_ERROR << "Deserialization failed, ZSTD decompression error: "
+                   << (ZSTD_isError(size) ? ZSTD_getErrorName(size) : "size mismatch");
+        return false;
+    }
+    return true;
+}
+#endif // HAVE_ZSTD
+} // namespace
+
 nixlSerDes::nixlSerDes()
     : workingStr("nixlSerDes|"),
       des_offset(workingStr.size()),
@@ -153,8 +205,104 @@ std::string nixlSerDes::exportStr() const {
     return workingStr;
 }
 
+std::string
+nixlSerDes::exportStr(nixl_serdes_codec_t codec) const {
+    std::string payload;
+
+    switch (codec) {
+    case nixl_serdes_codec_t::NONE:
+        return workingStr;
+    case nixl_serdes_codec_t::LZ4:
+#if HAVE_LZ4
+        if (workingStr.size() <= LZ4_MAX_INPUT_SIZE) {
+            payload.resize(LZ4_compressBound(workingStr.size()));
+            const int size = LZ4_compress_default(
+                workingStr.data(), &payload[0], workingStr.size(), payload.size());
+            payload.resize(size > 0 ? size : 0);
+        }
+#endif // HAVE_LZ4
+        break;
+    case nixl_serdes_codec_t::ZSTD:
+#if HAVE_ZSTD
+        if (!compressZstd(workingStr, payload)) {
+            payload.clear();
+        }
+#endif // HAVE_ZSTD
+        break;
+    }
+
+    // Small blobs are not worth the header
+    if (payload.empty() || payload.size() + compressed_header_size >= workingStr.size() ||
+        workingStr.size() > payload.size() * max_compression_ratio) {
+        return workingStr;
+    }
+
+    const uint64_t raw_size = workingStr.size();
+    std::string blob = compressed_tag;
+    blob.reserve(compressed_header_size + payload.size());
+    blob.push_back(static_cast<char>(codec));
+    blob.append(_bytesToString(&raw_size, sizeof(raw_size)));
+    blob.append(payload);
+    return blob;
+}
+
 nixl_status_t nixlSerDes::importStr(const std::string &sdbuf) {
 
+    if (sdbuf.compare(0, compressed_tag.size(), compressed_tag) == 0) {
+        if (sdbuf.size() < compressed_header_size) {
+            NIXL_ERROR << "Deserialization failed, incomplete compressed header";
+            return NIXL_ERR_MISMATCH;
+        }
+
+        const auto codec = static_cast<nixl_serdes_codec_t>(sdbuf[compressed_tag.size()]);
+        uint64_t raw_size;
+        std::memcpy(&raw_size, sdbuf.data() + compressed_tag.size() + 1, sizeof(raw_size));
+        [[maybe_unused]] const char *payload = sdbuf.data() + compressed_header_size;
+        [[maybe_unused]] const size_t payload_size = sdbuf.size() - compressed_header_size;
+        if (raw_size > max_uncompressed_size || raw_size > payload_size * max_compression_ratio) {
+            NIXL_ERROR << "Deserialization failed, invalid uncompressed size " << raw_size
+                       << " of a " << payload_size << " bytes payload";
+            return NIXL_ERR_MISMATCH;
+        }
+
+        std::string raw(raw_size, '\0');
+        bool decompressed = false;
+
+        switch (codec) {
+        case nixl_serdes_codec_t::LZ4:
+#if HAVE_LZ4
+            decompressed = LZ4_decompress_safe(payload, &raw[0], payload_size, raw_size) ==
+                static_cast<int>(raw_size);
+            if (!decompressed) {
+                NIXL_ERROR << "Deserialization failed, LZ4 decompression error";
+            }
+#else
+            NIXL_ERROR << "Deserialization failed, NIXL was built without LZ4";
+#endif // HAVE_LZ4
+            break;
+        case nixl_serdes_codec_t::ZSTD:
+#if HAVE_ZSTD
+            decompressed = decompressZstd(payload, payload_size, raw);
+#else
+            NIXL_ERROR << "Deserialization failed, NIXL was built without ZSTD";
+#endif // HAVE_ZSTD
+            break;
+        default:
+            NIXL_ERROR << "Deserialization failed, unknown codec "
+                       << static_cast<int>(codec);
+            break;
+        }
+
+        if (!decompressed) {
+            return NIXL_ERR_MISMATCH;
+        }
+        if (raw.compare(0, compressed_tag.size(), compressed_tag) == 0) {
+            NIXL_ERROR << "Deserialization failed, nested compressed blob";
+            return NIXL_ERR_MISMATCH;
+        }
+        return importStr(raw);
+    }
+
     if(sdbuf.compare(0, 11, "nixlSerDes|") != 0){
         NIXL_ERROR << "Deserialization failed, missing nixlSerDes tag";
         return NIXL_ERR_MISMATCH;
@@ -166,3 +314,52 @@ nixl_status_t nixlSerDes::importStr(const std::string &sdbuf) {
 
     return NIXL_SUCCESS;
 }
+
+// Compression management
+bool
+nixlSerDes::isCodecAvailable(nixl_serdes_codec_t codec) {
+    switch (codec) {
+    case nixl_serdes_codec_t::NONE:
+        return true;
+    case nixl_serdes_codec_t::LZ4:
+#if HAVE_LZ4
+        return true;
+#else
+        return false;
+#endif
+    case nixl_serdes_codec_t::ZSTD:
+#if HAVE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+nixl_status_t
+nixlSerDes::parseCodec(const std::string &name, nixl_serdes_codec_t &codec) {
+    if (name.empty() || name == "none") {
+        codec = nixl_serdes_codec_t::NONE;
+    } else if (name == "lz4") {
+        codec = nixl_serdes_codec_t::LZ4;
+    } else if (name == "zstd") {
+        codec = nixl_serdes_codec_t::ZSTD;
+    } else {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    return NIXL_SUCCESS;
+}
+
+uint32_t
+nixlSerDes::getCodecMask() {
+    uint32_t mask = 0;
+    for (auto codec : {nixl_serdes_codec_t::NONE,
+                       nixl_serdes_codec_t::LZ4,
+                       nixl_serdes_codec_t::ZSTD}) {
+        if (isCodecAvailable(codec)) {
+            mask |= 1U << static_cast<uint8_t>(codec);
+        }
+    }
+    return mask;
+}
@@ -22,6 +22,13 @@
 
 #include "nixl_types.h"
 
+// Codec of a compressed blob, recorded in its header
+enum class nixl_serdes_codec_t : uint8_t {
+    NONE = 0,
+    LZ4 = 1,
+    ZSTD = 2,
+};
+
 class nixlSerDes {
 private:
     typedef enum { SERIALIZE, DESERIALIZE } ser_mode_t;
@@ -44,8 +51,18 @@ public:
 
     /* Ser/Des buffer management */
     std::string exportStr() const;
+    /* Compressed blob, or the uncompressed one if the codec is not built in or does not make
+     * it smaller. Blobs of both kinds are accepted by importStr. */
+    std::string exportStr(nixl_serdes_codec_t codec) const;
     nixl_status_t importStr(const std::string &sdbuf);
 
+    /* Compression management */
+    static bool isCodecAvailable(nixl_serdes_codec_t codec);
+    static nixl_status_t parseCodec(const std::string &name, nixl_serdes_codec_t &codec);
+    /* Codecs which importStr accepts, as a mask of 1 << codec, to be advertised to the peers
+     * which export blobs for this process */
+    static uint32_t getCodecMask();
+
     static std::string _bytesToString(const void *buf, ssize_t size);
     static void _stringToBytes(void* fill_buf, const std::string &s, ssize_t size);
 };
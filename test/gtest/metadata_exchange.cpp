@@ -15,10 +15,13 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
 #include <thread>
 #include <random>
 #include "nixl.h"
 #include "common.h"
+#include "metadata_cache.h"
 
 // Used to avoid failures when etcd is not available
 #if HAVE_ETCD
@@ -147,6 +150,60 @@ protected:
         agents_.clear();
     }
 
+    // Replaces the last agent by a new one with the same name, as after a restart of its process
+    void
+    restartLastAgent() {
+        const std::string name = agents_.back().name;
+        agents_.pop_back();
+
+        const auto port = PortAllocator::next_tcp_port();
+        nixlAgentConfig cfg;
+        cfg.useListenThread = true;
+        cfg.listenPort = port;
+        cfg.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT;
+
+        agents_.emplace_back(std::make_unique<nixlAgent>(name, cfg), name, port);
+        agents_.back().initDefault();
+    }
+
+    // Replaces the agents by count agents which gossip their metadata
+    void
+    createGossipAgents(int count, unsigned int fanout) {
+        agents_.clear();
+        for (int i = 0; i < count; i++) {
+            const auto port = PortAllocator::next_tcp_port();
+            std::string name = "gossip_agent_" + std::to_string(i);
+            nixlAgentConfig cfg;
+            cfg.useListenThread = true;
+            cfg.listenPort = port;
+            cfg.lthrDelay = 10000;
+            cfg.gossipFanout = fanout;
+            cfg.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT;
+
+            auto agent = std::make_unique<nixlAgent>(name, cfg);
+
+            agents_.emplace_back(std::move(agent), std::move(name), port);
+        }
+    }
+
+    // Whether every agent loaded the metadata of every other agent
+    bool
+    allAgentsLoaded(const std::vector<bool> &expected) const {
+        for (const auto &agent : agents_) {
+            for (size_t i = 0; i < agents_.size(); i++) {
+                if (agents_[i].name == agent.name) {
+                    continue;
+                }
+                const bool loaded = agent.agent->checkRemoteMD(agents_[i].name, {DRAM_SEG}) ==
+                    NIXL_SUCCESS;
+                if (loaded != expected[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     void initAgentsDefault()
     {
         for (auto &agent : agents_) {
@@ -443,6 +500,140 @@ TEST_F(MetadataExchangeTestFixture, SocketFetchRemoteAndInvalidateLocal) {
     ASSERT_NE(dst.agent->checkRemoteMD(src.name, {DRAM_SEG}), NIXL_SUCCESS);
 }
 
+TEST(MetadataCacheTest, StoreLoadAndRemove) {
+    char dir_template[] = "/tmp/nixl_md_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    const std::string dir = dir_template;
+    const std::string agent = "agent/with:chars";
+    const nixl_blob_t md = "nixlSerDes|some metadata";
+    uint64_t version;
+    nixl_blob_t loaded;
+
+    {
+        nixlMetadataCache cache(dir);
+        EXPECT_FALSE(cache.getVersion(agent, version));
+        cache.store(agent, md);
+        ASSERT_TRUE(cache.getVersion(agent, version));
+        EXPECT_EQ(version, nixlMetadataCache::version(md));
+    }
+
+    // A new instance, as after a restart, finds the metadata and its version
+    {
+        nixlMetadataCache cache(dir);
+        ASSERT_TRUE(cache.getVersion(agent, version));
+        ASSERT_EQ(cache.load(agent, version, loaded), NIXL_SUCCESS);
+        EXPECT_EQ(loaded, md);
+        EXPECT_EQ(cache.load(agent, version + 1, loaded), NIXL_ERR_NOT_FOUND);
+        EXPECT_EQ(cache.load("other", version, loaded), NIXL_ERR_NOT_FOUND);
+
+        // A corrupted blob is not loaded
+        for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+            std::fstream file(entry.path(), std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(-1, std::ios::end);
+            file.put('X');
+        }
+        EXPECT_EQ(cache.load(agent, version, loaded), NIXL_ERR_MISMATCH);
+
+        cache.remove(agent);
+        EXPECT_FALSE(cache.getVersion(agent, version));
+    }
+
+    {
+        nixlMetadataCache cache(dir);
+        EXPECT_FALSE(cache.getVersion(agent, version));
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(MetadataExchangeTestFixture, SocketFetchRemoteAfterRestartWithCache) {
+    char dir_template[] = "/tmp/nixl_md_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    const std::string dir = dir_template;
+    ScopedEnv env;
+    env.addVar("NIXL_METADATA_CACHE_DIR", dir);
+
+    initAgentsDefault();
+    restartLastAgent();
+
+    auto &src = agents_[0];
+    nixl_opt_args_t fetch_args;
+    fetch_args.ipAddr = src.ip;
+    fetch_args.port = src.port;
+
+    const auto fetch = [&]() {
+        auto &dst = agents_.back();
+        ASSERT_EQ(dst.agent->fetchRemoteMD(src.name, &fetch_args), NIXL_SUCCESS);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (dst.agent->checkRemoteMD(src.name, {DRAM_SEG}) != NIXL_SUCCESS) {
+            ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    // Cold fetch, which fills the cache
+    fetch();
+    nixl_blob_t src_md;
+    ASSERT_EQ(src.agent->getLocalMD(src_md), NIXL_SUCCESS);
+    uint64_t version;
+    ASSERT_TRUE(nixlMetadataCache(dir).getVersion(src.name, version));
+    EXPECT_EQ(version, nixlMetadataCache::version(src_md));
+
+    // Warm fetch after a restart, the unchanged metadata is loaded from the cache
+    restartLastAgent();
+    fetch();
+
+    // The metadata of the source changes, the probe fails and the new metadata is sent
+    src.initAndRegisterBuffers(1, 4096);
+    ASSERT_EQ(src.agent->getLocalMD(src_md), NIXL_SUCCESS);
+    restartLastAgent();
+    fetch();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!nixlMetadataCache(dir).getVersion(src.name, version) ||
+           version != nixlMetadataCache::version(src_md)) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(MetadataExchangeTestFixture, SocketGossipManyAgents) {
+    constexpr int agent_count = 16;
+    createGossipAgents(agent_count, 3);
+    initAgentsDefault();
+
+    // Every agent sends its metadata to a single seed only
+    for (size_t i = 0; i < agents_.size(); i++) {
+        const auto &seed = agents_[i == 0 ? 1 : 0];
+        nixl_opt_args_t send_args;
+        send_args.ipAddr = seed.ip;
+        send_args.port = seed.port;
+        ASSERT_EQ(agents_[i].agent->sendLocalMD(&send_args), NIXL_SUCCESS);
+    }
+
+    std::vector<bool> expected(agents_.size(), true);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!allAgentsLoaded(expected)) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    // Invalidation spreads the same way
+    nixl_opt_args_t inval_args;
+    inval_args.ipAddr = agents_[0].ip;
+    inval_args.port = agents_[0].port;
+    ASSERT_EQ(agents_.back().agent->invalidateLocalMD(&inval_args), NIXL_SUCCESS);
+
+    expected.back() = false;
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!allAgentsLoaded(expected)) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
 TEST_F(MetadataExchangeTestFixture, SocketSendPartialLocal) {
     initAgentsDefault();
 
@@ -637,6 +828,69 @@ TEST_F(MetadataExchangeTestFixture, EtcdSendLocalAndFetchRemote) {
     src.agent.reset();
 }
 
+TEST_F(MetadataExchangeTestFixture, EtcdFetchDoesNotWaitForMissingAgent) {
+    VERIFY_ETCD_MODE();
+    initAgentsDefault();
+
+    auto &src = agents_[0];
+    auto &dst = agents_[1];
+
+    const LogIgnoreGuard lig1(std::regex("Watch timed out for key: .*/invalid_agent_name/metadata"));
+    const LogIgnoreGuard lig2("Failed to fetch metadata from etcd: NIXL_ERR_BACKEND");
+
+    // The fetch of an agent which never sends its metadata waits for the watch timeout,
+    // the fetches enqueued after it are not delayed
+    ASSERT_EQ(dst.agent->fetchRemoteMD("invalid_agent_name"), NIXL_SUCCESS);
+    ASSERT_EQ(src.agent->sendLocalMD(), NIXL_SUCCESS);
+    ASSERT_EQ(dst.agent->fetchRemoteMD(src.name), NIXL_SUCCESS);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (dst.agent->checkRemoteMD(src.name, {DRAM_SEG}) != NIXL_SUCCESS) {
+        ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(10));
+    EXPECT_EQ(lig1.getIgnoredCount(), 1);
+    EXPECT_EQ(lig2.getIgnoredCount(), 1);
+}
+
+TEST_F(MetadataExchangeTestFixture, EtcdFetchAllRemote) {
+    VERIFY_ETCD_MODE();
+    initAgentsDefault();
+
+    auto &src = agents_[0];
+    auto &dst = agents_[1];
+
+    auto sleep_time = std::chrono::seconds(10);
+
+    // Agents which send their metadata after the bulk fetch are fetched too
+    ASSERT_EQ(dst.agent->fetchAllRemoteMD(), NIXL_SUCCESS);
+    ASSERT_EQ(src.agent->sendLocalMD(), NIXL_SUCCESS);
+
+    std::this_thread::sleep_for(sleep_time);
+
+    ASSERT_EQ(dst.agent->checkRemoteMD(src.name, {DRAM_SEG}), NIXL_SUCCESS);
+    ASSERT_NE(dst.agent->checkRemoteMD(dst.name, {DRAM_SEG}), NIXL_SUCCESS);
+
+    ASSERT_EQ(src.agent->invalidateLocalMD(), NIXL_SUCCESS);
+
+    std::this_thread::sleep_for(sleep_time);
+
+    ASSERT_EQ(dst.agent->checkRemoteMD(src.name, {DRAM_SEG}), NIXL_ERR_NOT_FOUND);
+
+    // Agents which sent their metadata before the bulk fetch are fetched by its range get
+    ASSERT_EQ(dst.agent->sendLocalMD(), NIXL_SUCCESS);
+    ASSERT_EQ(src.agent->fetchAllRemoteMD(), NIXL_SUCCESS);
+
+    std::this_thread::sleep_for(sleep_time);
+
+    ASSERT_EQ(src.agent->checkRemoteMD(dst.name, {DRAM_SEG}), NIXL_SUCCESS);
+
+    // Prevent invalidateLocalMD() from being called again in TearDown()
+    src.agent.reset();
+}
+
 TEST_F(MetadataExchangeTestFixture, EtcdSendLocalPartialAndFetchRemote) {
     VERIFY_ETCD_MODE();
     initAgentsDefault();
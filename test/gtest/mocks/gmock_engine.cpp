@@ -38,6 +38,9 @@ GMockBackendEngine::GMockBackendEngine() : nixlBackendEngine(&init_params) {
     ON_CALL(*this, unloadMD(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, prepXfer(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, postXfer(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, supportsXferSpans()).WillByDefault(Return(false));
+    ON_CALL(*this, prepXferSpans(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, postXferSpans(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, checkXfer(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, releaseReqH(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, getPublicData(_, _)).WillByDefault(Return(NIXL_SUCCESS));
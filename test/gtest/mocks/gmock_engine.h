@@ -94,6 +94,25 @@ public:
                  nixlBackendReqH *&req,
                  const nixl_opt_b_args_t *extra_args),
                 (const, override));
+    MOCK_METHOD(bool, supportsXferSpans, (), (const, override));
+    MOCK_METHOD(nixl_status_t,
+                prepXferSpans,
+                (const nixl_xfer_op_t &op,
+                 const nixl_meta_span_t &src,
+                 const nixl_meta_span_t &dst,
+                 const std::string &remote_agent,
+                 nixlBackendReqH *&req,
+                 const nixl_opt_b_args_t *extra_args),
+                (const, override));
+    MOCK_METHOD(nixl_status_t,
+                postXferSpans,
+                (const nixl_xfer_op_t &op,
+                 const nixl_meta_span_t &src,
+                 const nixl_meta_span_t &dst,
+                 const std::string &remote_agent,
+                 nixlBackendReqH *&req,
+                 const nixl_opt_b_args_t *extra_args),
+                (const, override));
     MOCK_METHOD(nixl_status_t, checkXfer, (nixlBackendReqH * req), (const, override));
     MOCK_METHOD(nixl_status_t, releaseReqH, (nixlBackendReqH * req), (const, override));
     MOCK_METHOD(nixl_status_t,
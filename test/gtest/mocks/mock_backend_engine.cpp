@@ -78,6 +78,30 @@ MockBackendEngine::postXfer(const nixl_xfer_op_t &operation,
     return gmock_backend_engine->postXfer(operation, local, remote, remote_agent, handle, opt_args);
 }
 
+nixl_status_t
+MockBackendEngine::prepXferSpans(const nixl_xfer_op_t &operation,
+                                 const nixl_meta_span_t &local,
+                                 const nixl_meta_span_t &remote,
+                                 const std::string &remote_agent,
+                                 nixlBackendReqH *&handle,
+                                 const nixl_opt_b_args_t *opt_args) const {
+    assert(sharedState > 0);
+    return gmock_backend_engine->prepXferSpans(
+        operation, local, remote, remote_agent, handle, opt_args);
+}
+
+nixl_status_t
+MockBackendEngine::postXferSpans(const nixl_xfer_op_t &operation,
+                                 const nixl_meta_span_t &local,
+                                 const nixl_meta_span_t &remote,
+                                 const std::string &remote_agent,
+                                 nixlBackendReqH *&handle,
+                                 const nixl_opt_b_args_t *opt_args) const {
+    assert(sharedState > 0);
+    return gmock_backend_engine->postXferSpans(
+        operation, local, remote, remote_agent, handle, opt_args);
+}
+
 nixl_status_t
 MockBackendEngine::checkXfer(nixlBackendReqH *handle) const {
     assert(sharedState > 0);
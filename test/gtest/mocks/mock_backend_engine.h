@@ -66,6 +66,22 @@ public:
                          const std::string &remote_agent,
                          nixlBackendReqH *&handle,
                          const nixl_opt_b_args_t *opt_args) const override;
+  bool supportsXferSpans() const override {
+    assert(sharedState > 0);
+    return gmock_backend_engine->supportsXferSpans();
+  }
+  nixl_status_t prepXferSpans(const nixl_xfer_op_t &operation,
+                              const nixl_meta_span_t &local,
+                              const nixl_meta_span_t &remote,
+                              const std::string &remote_agent,
+                              nixlBackendReqH *&handle,
+                              const nixl_opt_b_args_t *opt_args) const override;
+  nixl_status_t postXferSpans(const nixl_xfer_op_t &operation,
+                              const nixl_meta_span_t &local,
+                              const nixl_meta_span_t &remote,
+                              const std::string &remote_agent,
+                              nixlBackendReqH *&handle,
+                              const nixl_opt_b_args_t *opt_args) const override;
   nixl_status_t checkXfer(nixlBackendReqH *handle) const override;
   nixl_status_t releaseReqH(nixlBackendReqH *handle) const override;
   nixl_status_t getPublicData(const nixlBackendMD *meta, std::string &str) const override {
@@ -35,6 +35,8 @@ namespace gtest::plugins::azure_blob {
  */
 
 nixl_b_params_t azure_blob_params;
+nixl_b_params_t azure_blob_chunked_params = {{"chunk_size", "1048576"},
+                                             {"chunk_concurrency", "4"}};
 const std::string local_agent_name = "Agent1";
 const nixlBackendInitParams azure_blob_test_params = {.localAgent = local_agent_name,
                                                       .type = "AZURE_BLOB",
@@ -43,6 +45,13 @@ const nixlBackendInitParams azure_blob_test_params = {.localAgent = local_agent_
                                                       .pthrDelay = 0,
                                                       .syncMode =
                                                           nixl_thread_sync_t::NIXL_THREAD_SYNC_RW};
+const nixlBackendInitParams azure_blob_chunked_test_params = {
+    .localAgent = local_agent_name,
+    .type = "AZURE_BLOB",
+    .customParams = &azure_blob_chunked_params,
+    .enableProgTh = false,
+    .pthrDelay = 0,
+    .syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_RW};
 
 class setupAzureBlobTestFixture : public setupBackendTestFixture {
 protected:
@@ -88,7 +97,7 @@ private:
         container_client_ = std::make_shared<Azure::Storage::Blobs::BlobContainerClient>(
             service_client->GetBlobContainerClient(test_container_name));
         container_client_->Create();
-        azure_blob_params["container_name"] = test_container_name;
+        (*GetParam().customParams)["container_name"] = test_container_name;
     }
 
     void
@@ -119,6 +128,23 @@ TEST_P(setupAzureBlobTestFixture, XferMultiBufsTest) {
     transfer.checkLocalMem();
 }
 
+TEST_P(setupAzureBlobTestFixture, XferLargeBufsTest) {
+    // Not a multiple of the chunk size, to cover a partial last chunk
+    constexpr size_t buffer_size = 5 * 1024 * 1024 + 123;
+    transferHandler<DRAM_SEG, OBJ_SEG> transfer(localBackendEngine_,
+                                                localBackendEngine_,
+                                                local_agent_name,
+                                                local_agent_name,
+                                                false,
+                                                2,
+                                                buffer_size);
+    transfer.setLocalMem();
+    transfer.testTransfer(NIXL_WRITE);
+    transfer.resetLocalMem();
+    transfer.testTransfer(NIXL_READ);
+    transfer.checkLocalMem();
+}
+
 TEST_P(setupAzureBlobTestFixture, queryMemTest) {
     transferHandler<DRAM_SEG, OBJ_SEG> transfer(
         localBackendEngine_, localBackendEngine_, local_agent_name, local_agent_name, false, 3);
@@ -142,4 +168,8 @@ INSTANTIATE_TEST_SUITE_P(AzureBlobTests,
                          setupAzureBlobTestFixture,
                          testing::Values(azure_blob_test_params));
 
+INSTANTIATE_TEST_SUITE_P(AzureBlobChunkedTests,
+                         setupAzureBlobTestFixture,
+                         testing::Values(azure_blob_chunked_test_params));
+
 } // namespace gtest::plugins::azure_blob
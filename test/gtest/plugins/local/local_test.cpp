@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include "common.h"
+#include "nixl.h"
+
+namespace gtest {
+namespace {
+    constexpr const char *local_backend_name = "LOCAL";
+    constexpr const char *agent_name = "local_agent";
+    constexpr const char *notif_msg = "local_done";
+    constexpr size_t buf_size = 8 * 1024 * 1024 + 4096;
+    constexpr size_t num_descs = 5;
+
+    uint8_t
+    pattern(size_t i) {
+        return uint8_t(i * 13 + 5);
+    }
+
+    // Descriptors of odd lengths at offsets which are not aligned for the vector stores
+    nixl_xfer_dlist_t
+    getXferDescs(uintptr_t base, size_t misalign) {
+        nixl_xfer_dlist_t descs(DRAM_SEG);
+        const size_t len = (buf_size - 64) / num_descs - 7;
+        for (size_t i = 0; i < num_descs; ++i) {
+            descs.addDesc(nixlBasicDesc(base + misalign + i * (len + 3), len, 0));
+        }
+        return descs;
+    }
+} // namespace
+
+// Kernel, copy workers and stream threshold of the backend
+using local_params_t = std::tuple<std::string, int, int>;
+
+class TestLocalBackend : public testing::TestWithParam<local_params_t> {
+protected:
+    TestLocalBackend()
+        : m_src(buf_size),
+          m_dst(buf_size),
+          m_reg_descs(DRAM_SEG) {
+        m_env.addVar("NIXL_PLUGIN_DIR", std::string(BUILD_DIR) + "/src/plugins/local");
+    }
+
+    void
+    SetUp() override {
+        const auto &[kernel, num_threads, stream_threshold] = GetParam();
+        // The plugin directory is set before the agent loads its plugins
+        m_agent = std::make_unique<nixlAgent>(agent_name, nixlAgentConfig(true));
+        nixl_b_params_t params;
+        params["kernel"] = kernel;
+        params["num_threads"] = std::to_string(num_threads);
+        params["stream_threshold"] = std::to_string(stream_threshold);
+        params["inline_threshold"] = "65536";
+        ASSERT_EQ(NIXL_SUCCESS, m_agent->createBackend(local_backend_name, params, m_backend));
+
+        m_reg_descs.addDesc(nixlBlobDesc(uintptr_t(m_src.data()), m_src.size(), 0));
+        m_reg_descs.addDesc(nixlBlobDesc(uintptr_t(m_dst.data()), m_dst.size(), 0));
+        ASSERT_EQ(NIXL_SUCCESS, m_agent->registerMem(m_reg_descs));
+    }
+
+    void
+    TearDown() override {
+        if (m_backend) {
+            m_agent->deregisterMem(m_reg_descs);
+        }
+    }
+
+    void
+    transfer(nixl_xfer_op_t op, size_t src_misalign, size_t dst_misalign) {
+        for (size_t i = 0; i < buf_size; ++i) {
+            m_src[i] = pattern(i);
+            m_dst[i] = 0;
+        }
+
+        // Reads pull from the remote side of the request into the local one
+        const bool is_read = (op == NIXL_READ);
+        const auto src_descs = getXferDescs(uintptr_t(m_src.data()), src_misalign);
+        const auto dst_descs = getXferDescs(uintptr_t(m_dst.data()), dst_misalign);
+        nixl_opt_args_t extra_params;
+        extra_params.notif = notif_msg;
+        nixlXferReqH *req = nullptr;
+        ASSERT_EQ(NIXL_SUCCESS,
+                  m_agent->createXferReq(op,
+                                        is_read ? dst_descs : src_descs,
+                                        is_read ? src_descs : dst_descs,
+                                        agent_name,
+                                        req,
+                                        &extra_params));
+
+        nixl_status_t status = m_agent->postXferReq(req);
+        while (status == NIXL_IN_PROG) {
+            status = m_agent->getXferStatus(req);
+        }
+        EXPECT_EQ(NIXL_SUCCESS, status);
+        EXPECT_EQ(NIXL_SUCCESS, m_agent->releaseXferReq(req));
+
+        for (int i = 0; i < src_descs.descCount(); ++i) {
+            const size_t src_off = src_descs[i].addr - uintptr_t(m_src.data());
+            const size_t dst_off = dst_descs[i].addr - uintptr_t(m_dst.data());
+            for (size_t j = 0; j < src_descs[i].len; ++j) {
+                ASSERT_EQ(pattern(src_off + j), m_dst[dst_off + j])
+                    << "descriptor " << i << " at offset " << j;
+            }
+            // Bytes between the descriptors are left alone
+            ASSERT_EQ(0, m_dst[dst_off + src_descs[i].len]);
+        }
+
+        nixl_notifs_t notifs;
+        ASSERT_EQ(NIXL_SUCCESS, m_agent->getNotifs(notifs));
+        ASSERT_EQ(1U, notifs[agent_name].size());
+        EXPECT_EQ(notif_msg, notifs[agent_name].front());
+    }
+
+    ScopedEnv m_env;
+    std::unique_ptr<nixlAgent> m_agent;
+    nixlBackendH *m_backend = nullptr;
+    std::vector<uint8_t> m_src;
+    std::vector<uint8_t> m_dst;
+    nixl_reg_dlist_t m_reg_descs;
+};
+
+TEST_P(TestLocalBackend, Write) {
+    transfer(NIXL_WRITE, 0, 0);
+}
+
+TEST_P(TestLocalBackend, Read) {
+    transfer(NIXL_READ, 0, 0);
+}
+
+TEST_P(TestLocalBackend, MisalignedWrite) {
+    transfer(NIXL_WRITE, 5, 33);
+}
+
+TEST_P(TestLocalBackend, SelfNotification) {
+    ASSERT_EQ(NIXL_SUCCESS, m_agent->genNotif(agent_name, notif_msg));
+    nixl_notifs_t notifs;
+    ASSERT_EQ(NIXL_SUCCESS, m_agent->getNotifs(notifs));
+    ASSERT_EQ(1U, notifs[agent_name].size());
+    EXPECT_EQ(notif_msg, notifs[agent_name].front());
+}
+
+INSTANTIATE_TEST_SUITE_P(memcpy,
+                         TestLocalBackend,
+                         testing::Values(local_params_t{"memcpy", 0, 0}));
+INSTANTIATE_TEST_SUITE_P(stream_inline,
+                         TestLocalBackend,
+                         testing::Values(local_params_t{"auto", 0, 0}));
+INSTANTIATE_TEST_SUITE_P(stream_workers,
+                         TestLocalBackend,
+                         testing::Values(local_params_t{"auto", 4, 0}));
+INSTANTIATE_TEST_SUITE_P(cached_workers,
+                         TestLocalBackend,
+                         testing::Values(local_params_t{"auto", 4, 1 << 30}));
+
+} // namespace gtest
@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "common.h"
+#include "nixl.h"
+
+namespace gtest {
+namespace {
+    constexpr const char *shm_backend_name = "SHM";
+    constexpr const char *initiator_name = "shm_initiator";
+    constexpr const char *target_name = "shm_target";
+    constexpr const char *notif_msg = "shm_done";
+    constexpr size_t buf_size = 4 * 1024 * 1024 + 123;
+    constexpr size_t num_descs = 4;
+    constexpr auto timeout = std::chrono::seconds(30);
+
+    bool
+    writeAll(int fd, const void *data, size_t len) {
+        const char *p = static_cast<const char *>(data);
+        while (len > 0) {
+            const ssize_t ret = write(fd, p, len);
+            if (ret <= 0) {
+                return false;
+            }
+            p += ret;
+            len -= ret;
+        }
+        return true;
+    }
+
+    bool
+    readAll(int fd, void *data, size_t len) {
+        char *p = static_cast<char *>(data);
+        while (len > 0) {
+            const ssize_t ret = read(fd, p, len);
+            if (ret <= 0) {
+                return false;
+            }
+            p += ret;
+            len -= ret;
+        }
+        return true;
+    }
+
+    uint8_t
+    pattern(size_t i) {
+        return uint8_t(i * 7 + 3);
+    }
+
+    // An agent with the SHM backend and one registered buffer
+    class shmAgent {
+    public:
+        explicit shmAgent(const std::string &name)
+            : agent_(std::make_unique<nixlAgent>(name, nixlAgentConfig(true))),
+              buf_(buf_size),
+              regDescs_(DRAM_SEG) {
+            if (agent_->createBackend(shm_backend_name, {}, backend_) == NIXL_SUCCESS) {
+                regDescs_.addDesc(nixlBlobDesc(uintptr_t(buf_.data()), buf_.size(), 0));
+                ok_ = (agent_->registerMem(regDescs_) == NIXL_SUCCESS);
+            }
+        }
+
+        ~shmAgent() {
+            if (ok_) {
+                agent_->deregisterMem(regDescs_);
+            }
+        }
+
+        bool
+        isOk() const {
+            return ok_;
+        }
+
+        nixlAgent &
+        get() {
+            return *agent_;
+        }
+
+        std::vector<uint8_t> &
+        getBuf() {
+            return buf_;
+        }
+
+        // The buffer split in a few descriptors, to exercise several segments
+        nixl_xfer_dlist_t
+        getXferDescs(uintptr_t base) const {
+            nixl_xfer_dlist_t descs(DRAM_SEG);
+            const size_t len = buf_size / num_descs;
+            for (size_t i = 0; i < num_descs; ++i) {
+                const size_t desc_len = (i + 1 < num_descs) ? len : buf_size - i * len;
+                descs.addDesc(nixlBasicDesc(base + i * len, desc_len, 0));
+            }
+            return descs;
+        }
+
+        bool
+        waitForNotif(const std::string &remote_name, const std::string &msg) {
+            const auto deadline = std::chrono::steady_clock::now() + timeout;
+            nixl_notifs_t notifs;
+            while (std::chrono::steady_clock::now() < deadline) {
+                if (agent_->getNotifs(notifs) != NIXL_SUCCESS) {
+                    return false;
+                }
+                if (!notifs[remote_name].empty()) {
+                    return notifs[remote_name].front() == msg;
+                }
+            }
+            return false;
+        }
+
+    private:
+        std::unique_ptr<nixlAgent> agent_;
+        nixlBackendH *backend_ = nullptr;
+        std::vector<uint8_t> buf_;
+        nixl_reg_dlist_t regDescs_;
+        bool ok_ = false;
+    };
+
+    // Runs in the forked child, publishes its metadata and buffer, and then waits for the
+    // notification of the transfer of the parent
+    int
+    runTarget(nixl_xfer_op_t op, int md_fd) {
+        shmAgent target(target_name);
+        if (!target.isOk()) {
+            return 1;
+        }
+
+        auto &buf = target.getBuf();
+        for (size_t i = 0; i < buf.size(); ++i) {
+            buf[i] = (op == NIXL_READ) ? pattern(i) : 0;
+        }
+
+        std::string md;
+        if (target.get().getLocalMD(md) != NIXL_SUCCESS) {
+            return 2;
+        }
+        const uint64_t addr = uintptr_t(buf.data());
+        const uint64_t md_len = md.size();
+        if (!writeAll(md_fd, &addr, sizeof(addr)) || !writeAll(md_fd, &md_len, sizeof(md_len)) ||
+            !writeAll(md_fd, md.data(), md.size())) {
+            return 3;
+        }
+
+        if (!target.waitForNotif(initiator_name, notif_msg)) {
+            return 4;
+        }
+
+        if (op == NIXL_WRITE) {
+            for (size_t i = 0; i < buf.size(); ++i) {
+                if (buf[i] != pattern(i)) {
+                    return 5;
+                }
+            }
+        }
+        return 0;
+    }
+} // namespace
+
+class TestShmBackend : public testing::TestWithParam<nixl_xfer_op_t> {
+protected:
+    TestShmBackend() {
+        m_env.addVar("NIXL_PLUGIN_DIR", std::string(BUILD_DIR) + "/src/plugins/shm");
+    }
+
+    ScopedEnv m_env;
+};
+
+// Agents of different processes, so that the data moves through cross memory attach. The
+// parent initiates, since it may access the memory of its child with any ptrace scope.
+TEST_P(TestShmBackend, CrossProcessXfer) {
+    const nixl_xfer_op_t op = GetParam();
+    int md_pipe[2];
+    ASSERT_EQ(0, pipe(md_pipe));
+
+    // Agents are only created after the fork, so that the child has none of their threads
+    const pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        close(md_pipe[0]);
+        _exit(runTarget(op, md_pipe[1]));
+    }
+    close(md_pipe[1]);
+
+    {
+        shmAgent initiator(initiator_name);
+        ASSERT_TRUE(initiator.isOk());
+        auto &buf = initiator.getBuf();
+        for (size_t i = 0; i < buf.size(); ++i) {
+            buf[i] = (op == NIXL_WRITE) ? pattern(i) : 0;
+        }
+
+        uint64_t remote_addr = 0;
+        uint64_t md_len = 0;
+        ASSERT_TRUE(readAll(md_pipe[0], &remote_addr, sizeof(remote_addr)));
+        ASSERT_TRUE(readAll(md_pipe[0], &md_len, sizeof(md_len)));
+        std::string md(md_len, '\0');
+        ASSERT_TRUE(readAll(md_pipe[0], md.data(), md.size()));
+        close(md_pipe[0]);
+
+        std::string remote_name;
+        ASSERT_EQ(NIXL_SUCCESS, initiator.get().loadRemoteMD(md, remote_name));
+        ASSERT_EQ(target_name, remote_name);
+
+        nixl_opt_args_t extra_params;
+        extra_params.notif = notif_msg;
+        nixlXferReqH *req = nullptr;
+        ASSERT_EQ(NIXL_SUCCESS,
+                  initiator.get().createXferReq(op,
+                                                initiator.getXferDescs(uintptr_t(buf.data())),
+                                                initiator.getXferDescs(remote_addr),
+                                                remote_name,
+                                                req,
+                                                &extra_params));
+
+        nixl_status_t status = initiator.get().postXferReq(req);
+        while (status == NIXL_IN_PROG) {
+            status = initiator.get().getXferStatus(req);
+        }
+        EXPECT_EQ(NIXL_SUCCESS, status);
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().releaseXferReq(req));
+
+        if (op == NIXL_READ) {
+            for (size_t i = 0; i < buf.size(); ++i) {
+                ASSERT_EQ(pattern(i), buf[i]) << "at offset " << i;
+            }
+        }
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().invalidateRemoteMD(remote_name));
+    }
+
+    int wstatus = 0;
+    ASSERT_EQ(pid, waitpid(pid, &wstatus, 0));
+    ASSERT_TRUE(WIFEXITED(wstatus));
+    EXPECT_EQ(0, WEXITSTATUS(wstatus));
+}
+
+INSTANTIATE_TEST_SUITE_P(shm, TestShmBackend, testing::Values(NIXL_READ, NIXL_WRITE));
+
+} // namespace gtest
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include "mem_section.h"
+
+namespace gtest {
+namespace sec_desc_list {
+
+    nixlSectionDesc
+    makeDesc(uintptr_t addr, size_t len, uint64_t dev_id = 0, const std::string &blob = "") {
+        nixlSectionDesc desc(addr, len, dev_id, nullptr);
+        desc.metaBlob = blob;
+        return desc;
+    }
+
+    void
+    expectAddrs(const nixlSecDescList &list, const std::vector<uintptr_t> &addrs) {
+        ASSERT_EQ(list.descCount(), static_cast<int>(addrs.size()));
+        for (size_t i = 0; i < addrs.size(); ++i) {
+            EXPECT_EQ(list[i].addr, addrs[i]) << "at index " << i;
+        }
+        EXPECT_TRUE(list.verifySorted());
+    }
+
+    TEST(SecDescListTest, AddSortedToEmpty) {
+        nixlSecDescList list(DRAM_SEG);
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x1000, 0x100), makeDesc(0x2000, 0x100)}), 0);
+        expectAddrs(list, {0x1000, 0x2000});
+    }
+
+    TEST(SecDescListTest, AddSortedEmptyBatch) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100));
+        EXPECT_EQ(list.addSortedDescs({}), 0);
+        expectAddrs(list, {0x1000});
+    }
+
+    TEST(SecDescListTest, AddSortedAppend) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100));
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x3000, 0x100), makeDesc(0x4000, 0x100)}), 0);
+        expectAddrs(list, {0x1000, 0x3000, 0x4000});
+    }
+
+    TEST(SecDescListTest, AddSortedInterleaved) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x2000, 0x100));
+        list.addDesc(makeDesc(0x4000, 0x100));
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x1000, 0x100),
+                                       makeDesc(0x3000, 0x100),
+                                       makeDesc(0x5000, 0x100)}),
+                  0);
+        expectAddrs(list, {0x1000, 0x2000, 0x3000, 0x4000, 0x5000});
+    }
+
+    TEST(SecDescListTest, AddSortedMatchesAddDesc) {
+        const std::vector<nixlSectionDesc> current = {
+            makeDesc(0x2000, 0x100, 1), makeDesc(0x2000, 0x100, 0), makeDesc(0x1000, 0x80)};
+        const std::vector<nixlSectionDesc> added = {
+            makeDesc(0x1800, 0x100), makeDesc(0x2000, 0x100, 1), makeDesc(0x3000, 0x10)};
+
+        nixlSecDescList merged(DRAM_SEG), inserted(DRAM_SEG);
+        for (const auto &desc : current) {
+            merged.addDesc(desc);
+            inserted.addDesc(desc);
+        }
+        for (const auto &desc : added) {
+            inserted.addDesc(desc);
+        }
+        std::vector<nixlSectionDesc> sorted = added;
+        std::stable_sort(sorted.begin(), sorted.end());
+        merged.addSortedDescs(std::move(sorted));
+
+        ASSERT_EQ(merged.descCount(), inserted.descCount());
+        for (int i = 0; i < merged.descCount(); ++i) {
+            EXPECT_EQ(merged[i], inserted[i]) << "at index " << i;
+        }
+    }
+
+    TEST(SecDescListTest, AddSortedDuplicates) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100, 0, "current"));
+
+        // Duplicates are kept after the current equal element, and are not overlaps
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x1000, 0x100, 0, "first"),
+                                       makeDesc(0x1000, 0x100, 0, "second")}),
+                  0);
+        ASSERT_EQ(list.descCount(), 3);
+        EXPECT_EQ(list[0].metaBlob, "current");
+        EXPECT_EQ(list[1].metaBlob, "first");
+        EXPECT_EQ(list[2].metaBlob, "second");
+        EXPECT_EQ(list.getIndex(makeDesc(0x1000, 0x100)), 0);
+    }
+
+    TEST(SecDescListTest, AddSortedOverlapsInBatch) {
+        nixlSecDescList list(DRAM_SEG);
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x1000, 0x100), makeDesc(0x1080, 0x100)}), 1);
+        expectAddrs(list, {0x1000, 0x1080});
+    }
+
+    TEST(SecDescListTest, AddSortedOverlapsCurrent) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100));
+        list.addDesc(makeDesc(0x3000, 0x100));
+
+        // Overlaps the next current element, the previous one, and none
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x0f80, 0x100),
+                                       makeDesc(0x3080, 0x100),
+                                       makeDesc(0x4000, 0x100)}),
+                  2);
+        expectAddrs(list, {0x0f80, 0x1000, 0x3000, 0x3080, 0x4000});
+    }
+
+    TEST(SecDescListTest, AddSortedOverlapsAppended) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100));
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x10ff, 0x100)}), 1);
+        expectAddrs(list, {0x1000, 0x10ff});
+    }
+
+    TEST(SecDescListTest, AddSortedAdjacentAndOtherDevice) {
+        nixlSecDescList list(DRAM_SEG);
+        list.addDesc(makeDesc(0x1000, 0x100));
+
+        // Touching ranges and ranges of other devices do not overlap
+        EXPECT_EQ(list.addSortedDescs({makeDesc(0x1100, 0x100), makeDesc(0x1000, 0x100, 1)}), 0);
+        EXPECT_EQ(list.descCount(), 3);
+        EXPECT_TRUE(list.verifySorted());
+    }
+
+} // namespace sec_desc_list
+} // namespace gtest
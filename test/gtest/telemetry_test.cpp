@@ -357,3 +357,285 @@ TEST_F(telemetryTest, TelemetryAgentEventsTwo) {
 
     envHelper_.popVar();
 }
+
+namespace {
+// Records a data path event by id, as the UCX and POSIX backends do when posting
+class telemetryBackend : public mocks::GMockBackendEngine {
+public:
+    explicit telemetryBackend(const nixlBackendInitParams *init_params)
+        : GMockBackendEngine(init_params),
+          postEventId_(registerTelemetryEvent("test_xfer_post_descs")) {}
+
+    void
+    post(uint64_t descs) const {
+        addTelemetryEvent(postEventId_, descs);
+    }
+
+private:
+    const uint32_t postEventId_;
+};
+} // namespace
+
+TEST_F(telemetryTest, BackendEventsExported) {
+    envHelper_.addVar(TELEMETRY_RUN_INTERVAL_VAR, "1");
+
+    nixl_b_params_t params;
+    nixlBackendInitParams init_params;
+    init_params.localAgent = testFile_;
+    init_params.type = "TEST";
+    init_params.customParams = &params;
+    init_params.enableProgTh = false;
+    init_params.pthrDelay = 0;
+    init_params.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_NONE;
+    init_params.enableTelemetry_ = true;
+
+    // The backend outlives the telemetry, as in the agent
+    telemetryBackend backend(&init_params);
+    nixlTelemetry telemetry(testFile_);
+    ASSERT_TRUE(telemetry.isExporting());
+    telemetry.addBackend(&backend);
+
+    telemetry.updateTxBytes(1024);
+    backend.post(3);
+    std::thread([&backend] { backend.post(5); }).join();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto path = testDir_.string() + "/" + testFile_;
+    auto buffer =
+        std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(path, false, TELEMETRY_VERSION);
+    EXPECT_EQ(buffer->size(), 3);
+
+    nixlTelemetryEvent event;
+    buffer->pop(event);
+    EXPECT_STREQ(event.eventName_, "agent_tx_bytes");
+
+    uint64_t descs = 0;
+    while (buffer->pop(event)) {
+        EXPECT_STREQ(event.eventName_, "test_xfer_post_descs");
+        EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND);
+        descs += event.value_;
+    }
+    EXPECT_EQ(descs, 8);
+
+    envHelper_.popVar();
+}
+
+TEST_F(telemetryTest, LatencyHistogramBuckets) {
+    for (size_t i = 1; i < nixlLatencyHistogram::numBuckets; ++i) {
+        EXPECT_EQ(nixlLatencyHistogram::bucketLowerBound(i),
+                  nixlLatencyHistogram::bucketUpperBound(i - 1));
+    }
+
+    for (uint64_t value = 0; value < (1 << 24); value += 1 + value / 100) {
+        const size_t idx = nixlLatencyHistogram::bucketIndex(value);
+        EXPECT_LE(nixlLatencyHistogram::bucketLowerBound(idx), value);
+        EXPECT_LT(value, nixlLatencyHistogram::bucketUpperBound(idx));
+    }
+}
+
+TEST_F(telemetryTest, LatencyHistogramSnapshots) {
+    auto histogram = std::make_unique<nixlLatencyHistogram>();
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram->record(value * 1000);
+    }
+
+    auto snap = histogram->getSnapshot();
+    EXPECT_EQ(snap.count(), 1000);
+    EXPECT_EQ(snap.sum(), 500500000);
+    // Percentiles are bucket upper bounds, within 1 / subBuckets of the exact value
+    EXPECT_NEAR(snap.percentile(0.5), 500000, 500000 / nixlLatencyHistogram::subBuckets);
+    EXPECT_NEAR(snap.percentile(0.99), 990000, 990000 / nixlLatencyHistogram::subBuckets);
+    EXPECT_GE(snap.max(), 1000000);
+
+    histogram->record(5000000);
+    auto delta = histogram->getSnapshot();
+    delta.subtract(snap);
+    EXPECT_EQ(delta.count(), 1);
+    EXPECT_GE(delta.percentile(0.5), 5000000);
+
+    snap.merge(delta);
+    EXPECT_EQ(snap.count(), 1001);
+    EXPECT_GE(snap.max(), 5000000);
+}
+
+TEST_F(telemetryTest, HistogramSummaryRecords) {
+    envHelper_.addVar(TELEMETRY_RUN_INTERVAL_VAR, "1");
+
+    nixlTelemetry telemetry(testFile_);
+
+    // Same backend, operation and size range: merged over remote agents
+    auto *histograms1 = telemetry.getXferHistograms("UCX", NIXL_WRITE, 5000, "remote1");
+    auto *histograms2 = telemetry.getXferHistograms("UCX", NIXL_WRITE, 4096, "remote2");
+    ASSERT_NE(histograms1, nullptr);
+    ASSERT_NE(histograms1, histograms2);
+    EXPECT_EQ(histograms1, telemetry.getXferHistograms("UCX", NIXL_WRITE, 8191, "remote1"));
+
+    histograms1->post.record(1000);
+    histograms1->xfer.record(10000);
+    histograms2->post.record(1000);
+    histograms2->xfer.record(10000);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto path = testDir_.string() + "/" + testFile_;
+    auto buffer =
+        std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(path, false, TELEMETRY_VERSION);
+    ASSERT_EQ(buffer->size(), 7);
+
+    nixlTelemetryEvent event;
+    buffer->pop(event);
+    EXPECT_STREQ(event.eventName_, "UCX/WRITE/4K/xfer_n");
+    EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE);
+    EXPECT_EQ(event.value_, 2);
+    buffer->pop(event);
+    EXPECT_STREQ(event.eventName_, "UCX/WRITE/4K/xfer_p50");
+    EXPECT_EQ(event.value_,
+              nixlLatencyHistogram::bucketUpperBound(nixlLatencyHistogram::bucketIndex(10000)));
+
+    // No new samples, no new records
+    while (buffer->pop(event)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(buffer->size(), 0);
+
+    envHelper_.popVar();
+}
+
+TEST_F(telemetryTest, RingsConcurrentProducers) {
+    constexpr uint32_t num_producers = 4;
+    constexpr uint64_t records_per_producer = 100000;
+    nixlTelemetryRings<> rings(1024);
+
+    std::atomic<uint32_t> running{num_producers};
+    std::vector<std::thread> producers;
+    for (uint32_t id = 0; id < num_producers; ++id) {
+        producers.emplace_back([&rings, &running, id]() {
+            for (uint64_t value = 0; value < records_per_producer; ++value) {
+                rings.record(id, value);
+            }
+            running.fetch_sub(1);
+        });
+    }
+
+    // Records are dropped when a ring is full, but the ones drained from a producer
+    // keep its order and are neither duplicated nor torn
+    std::vector<uint64_t> next_value(num_producers, 0);
+    std::vector<uint64_t> drained(num_producers, 0);
+    bool ordered = true;
+    const auto consume = [&](const nixlTelemetryRecord &record) {
+        if ((record.id_ >= num_producers) || (record.value_ < next_value[record.id_])) {
+            ordered = false;
+            return;
+        }
+        next_value[record.id_] = record.value_ + 1;
+        ++drained[record.id_];
+    };
+
+    while (running.load() > 0) {
+        rings.drain(consume);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    rings.drain(consume);
+
+    EXPECT_TRUE(ordered);
+    uint64_t total = 0;
+    for (uint32_t id = 0; id < num_producers; ++id) {
+        EXPECT_GT(drained[id], 0);
+        total += drained[id];
+    }
+    EXPECT_EQ(total + rings.dropped(), num_producers * records_per_producer);
+}
+
+TEST_F(telemetryTest, SpansOnlyForSpanExporters) {
+    nixlTelemetry telemetry(testFile_);
+
+    // The buffer exporter does not export spans, nothing is sampled nor recorded
+    EXPECT_FALSE(telemetry.sampleSpan());
+    const auto now = std::chrono::steady_clock::now();
+    telemetry.addSpan(nixl_telemetry_span_kind_t::XFER, now, now, this, "UCX");
+}
+
+TEST_F(telemetryTest, SpanRings) {
+    nixlTelemetryRings<nixlTelemetrySpan> rings(4);
+    for (uint64_t i = 0; i < 6; ++i) {
+        rings.record({i, 10 * i, 0x1000, 1, nixl_telemetry_span_kind_t::POST_XFER_REQ, "UCX"});
+    }
+
+    std::vector<nixlTelemetrySpan> spans;
+    EXPECT_EQ(rings.drain([&spans](const nixlTelemetrySpan &span) { spans.push_back(span); }),
+              4);
+    EXPECT_EQ(rings.dropped(), 2);
+    ASSERT_EQ(spans.size(), 4);
+    EXPECT_EQ(spans[3].durationNs_, 30);
+    EXPECT_EQ(spans[3].kind_, nixl_telemetry_span_kind_t::POST_XFER_REQ);
+    EXPECT_STREQ(spans[3].backend_, "UCX");
+}
+
+TEST_F(telemetryTest, ObserveBufferWithoutConsuming) {
+    const auto path = (testDir_ / testFile_).string();
+    sharedRingBuffer<nixlTelemetryEvent> buffer(path, true, TELEMETRY_VERSION, 8);
+    sharedRingBuffer<nixlTelemetryEvent> observer(path, false, TELEMETRY_VERSION, 0, true);
+
+    for (uint64_t i = 0; i < 3; ++i) {
+        buffer.push({i, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, "agent_tx_bytes", i});
+    }
+
+    nixlTelemetryEvent events[8];
+    size_t cursor = observer.head();
+    size_t skipped = 0;
+    EXPECT_EQ(observer.peek(cursor, events, 8, skipped), 3);
+    EXPECT_EQ(skipped, 0);
+    EXPECT_EQ(events[2].value_, 2);
+    EXPECT_EQ(buffer.size(), 3);
+    EXPECT_EQ(observer.peek(cursor, events, 8, skipped), 0);
+
+    // Observing from a cursor behind the consumer skips the consumed events
+    nixlTelemetryEvent event;
+    cursor = observer.head();
+    buffer.pop(event);
+    buffer.pop(event);
+    EXPECT_EQ(observer.peek(cursor, events, 8, skipped), 1);
+    EXPECT_EQ(skipped, 2);
+    EXPECT_EQ(events[0].value_, 2);
+
+    // A read-only buffer cannot be modified
+    EXPECT_FALSE(observer.push(event));
+    EXPECT_FALSE(observer.pop(event));
+    EXPECT_EQ(buffer.size(), 1);
+}
+
+TEST_F(telemetryTest, ObserveOverwrittenBuffer) {
+    const auto path = (testDir_ / testFile_).string();
+    sharedRingBuffer<nixlTelemetryEvent> buffer(path, true, TELEMETRY_VERSION, 4);
+    sharedRingBuffer<nixlTelemetryEvent> observer(path, false, TELEMETRY_VERSION, 0, true);
+
+    nixlTelemetryEvent events[4];
+    size_t cursor = observer.head();
+    size_t skipped = 0;
+    for (uint64_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE(buffer.push(
+            {i, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, "agent_tx_bytes", i}));
+    }
+    EXPECT_EQ(observer.peek(cursor, events, 4, skipped), 3);
+    EXPECT_FALSE(buffer.push(
+        {3, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, "agent_tx_bytes", 3}));
+
+    // Without a consumer, overwriting keeps the latest events observable
+    for (uint64_t i = 3; i < 8; ++i) {
+        EXPECT_TRUE(buffer.push(
+            {i, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, "agent_tx_bytes", i},
+            true));
+    }
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(observer.peek(cursor, events, 4, skipped), 3);
+    EXPECT_EQ(skipped, 2);
+    EXPECT_EQ(events[0].value_, 5);
+    EXPECT_EQ(events[2].value_, 7);
+
+    nixlTelemetryEvent event;
+    EXPECT_TRUE(buffer.pop(event));
+    EXPECT_EQ(event.value_, 5);
+    EXPECT_EQ(buffer.size(), 2);
+}
@@ -28,6 +28,7 @@
 #include <optional>
 #include <string>
 #include <chrono>
+#include <cstring>
 #include <thread>
 #include <vector>
 #include <thread>
@@ -115,7 +116,7 @@ protected:
         return ports.at(i);
     }
 
-    nixl_b_params_t getBackendParams()
+    virtual nixl_b_params_t getBackendParams()
     {
         nixl_b_params_t params;
 
@@ -123,6 +124,8 @@ protected:
             params["num_workers"] = std::to_string(getNumWorkers());
             params["num_threads"] = std::to_string(getNumThreads());
             params["split_batch_size"] = "32";
+        } else if (getBackendName() == "SHM" || getBackendName() == "TCP") {
+            params["num_threads"] = std::to_string(getNumThreads());
         }
 
         params["engine_config"] = GetParam().engineConfig;
@@ -130,13 +133,19 @@ protected:
     }
 
     void
-    addAgent(unsigned int agent_num, bool capture_telemetry = false) {
+    addAgent(unsigned int agent_num,
+             bool capture_telemetry = false,
+             const nixl_b_params_t &extra_params = {}) {
         ports.push_back(PortAllocator::next_tcp_port());
         agents.emplace_back(std::make_unique<nixlAgent>(
             getAgentName(agent_num), getConfig(getPort(agent_num), capture_telemetry)));
         nixlBackendH *backend_handle = nullptr;
+        nixl_b_params_t params = getBackendParams();
+        for (const auto &[key, value] : extra_params) {
+            params[key] = value;
+        }
         nixl_status_t status =
-            agents.back()->createBackend(getBackendName(), getBackendParams(), backend_handle);
+            agents.back()->createBackend(getBackendName(), params, backend_handle);
         ASSERT_EQ(status, NIXL_SUCCESS);
         EXPECT_NE(backend_handle, nullptr);
         backend_handles.push_back(backend_handle);
@@ -445,6 +454,9 @@ protected:
                         EXPECT_TRUE(telemetry.postDuration > chrono_period_us_t(0));
                         EXPECT_TRUE(telemetry.xferDuration > chrono_period_us_t(0));
                         EXPECT_TRUE(telemetry.xferDuration >= telemetry.postDuration);
+                        EXPECT_LE(telemetry.postDuration + telemetry.wireDuration +
+                                      telemetry.notifDuration,
+                                  telemetry.xferDuration);
                     }
                 }
 
@@ -531,6 +543,55 @@ protected:
     }
 };
 
+class TestTransferStriped : public TestTransfer {
+protected:
+    static constexpr size_t stripe_threshold = 4 * 1024 * 1024;
+    // Not a divisor of the descriptor sizes, so that the last chunk is shorter
+    static constexpr size_t stripe_chunk_size = 1024 * 1024 + 1;
+
+    nixl_b_params_t
+    getBackendParams() override {
+        nixl_b_params_t params = TestTransfer::getBackendParams();
+        params["stripe_threshold"] = std::to_string(stripe_threshold);
+        params["stripe_chunk_size"] = std::to_string(stripe_chunk_size);
+        return params;
+    }
+
+    // Returns the bandwidth in GB/s of repeated writes, polled without sleeping
+    double
+    measureBandwidth(size_t from,
+                     size_t to,
+                     const std::vector<MemBuffer> &src_buffers,
+                     const std::vector<MemBuffer> &dst_buffers,
+                     size_t size,
+                     size_t repeat) {
+        nixlXferReqH *xfer_req = nullptr;
+        nixl_status_t status =
+            getAgent(from).createXferReq(NIXL_WRITE,
+                                         makeDescList<nixlBasicDesc>(src_buffers, DRAM_SEG),
+                                         makeDescList<nixlBasicDesc>(dst_buffers, DRAM_SEG),
+                                         getAgentName(to),
+                                         xfer_req);
+        EXPECT_EQ(status, NIXL_SUCCESS);
+        if (status != NIXL_SUCCESS) {
+            return 0;
+        }
+
+        const auto start_time = absl::Now();
+        for (size_t i = 0; i < repeat; ++i) {
+            status = getAgent(from).postXferReq(xfer_req);
+            while (status == NIXL_IN_PROG) {
+                status = getAgent(from).getXferStatus(xfer_req);
+            }
+            EXPECT_EQ(status, NIXL_SUCCESS);
+        }
+        const auto total_time = absl::ToDoubleSeconds(absl::Now() - start_time);
+
+        EXPECT_EQ(getAgent(from).releaseXferReq(xfer_req), NIXL_SUCCESS);
+        return size * src_buffers.size() * repeat / total_time / (1024 * 1024 * 1024);
+    }
+};
+
 const std::string TestTransfer::NOTIF_MSG = "notification";
 
 TEST_P(TestTransfer, RandomSizes)
@@ -574,7 +635,8 @@ TEST_P(TestTransfer, remoteMDFromSocket)
     std::vector<MemBuffer> src_buffers, dst_buffers;
     constexpr size_t size = 16 * 1024;
     constexpr size_t count = 4;
-    nixl_mem_t mem_type = m_cuda_device? VRAM_SEG : DRAM_SEG;
+    const bool dram_only = (getBackendName() == "SHM") || (getBackendName() == "TCP");
+    nixl_mem_t mem_type = (m_cuda_device && !dram_only) ? VRAM_SEG : DRAM_SEG;
 
     createRegisteredMem(getAgent(0), size, count, mem_type, src_buffers);
     createRegisteredMem(getAgent(1), size, count, mem_type, dst_buffers);
@@ -621,6 +683,77 @@ TEST_P(TestTransfer, ListenerCommSize) {
     deregisterMem(getAgent(1), buffers, DRAM_SEG);
 }
 
+TEST_P(TestTransferStriped, LargeDescriptors) {
+    constexpr size_t size = 2 * stripe_threshold;
+    constexpr size_t count = 4;
+
+    std::vector<MemBuffer> src_buffers, dst_buffers;
+    createRegisteredMem(getAgent(0), size, count, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, count, DRAM_SEG, dst_buffers);
+    for (size_t i = 0; i < count; ++i) {
+        memset(reinterpret_cast<void *>(uintptr_t(src_buffers[i])), 'a' + i, size);
+        memset(reinterpret_cast<void *>(uintptr_t(dst_buffers[i])), 0, size);
+    }
+
+    exchangeMD(0, 1);
+    doTransfer(getAgent(0),
+               getAgentName(0),
+               getAgent(1),
+               getAgentName(1),
+               size,
+               count,
+               2,
+               2,
+               DRAM_SEG,
+               src_buffers,
+               DRAM_SEG,
+               dst_buffers);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(0,
+                  memcmp(reinterpret_cast<void *>(uintptr_t(src_buffers[i])),
+                         reinterpret_cast<void *>(uintptr_t(dst_buffers[i])),
+                         size));
+    }
+
+    invalidateMD(0, 1);
+    deregisterMem(getAgent(0), src_buffers, DRAM_SEG);
+    deregisterMem(getAgent(1), dst_buffers, DRAM_SEG);
+}
+
+TEST_P(TestTransferStriped, Bandwidth) {
+    constexpr size_t size = 64 * 1024 * 1024;
+    constexpr size_t count = 4;
+    constexpr size_t repeat = 8;
+
+    // Agents 2 and 3 run the same transfers without striping
+    const nixl_b_params_t no_stripe_params = {{"stripe_threshold", "0"}};
+    addAgent(2, false, no_stripe_params);
+    addAgent(3, false, no_stripe_params);
+
+    std::vector<MemBuffer> src_buffers, dst_buffers, plain_src_buffers, plain_dst_buffers;
+    createRegisteredMem(getAgent(0), size, count, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, count, DRAM_SEG, dst_buffers);
+    createRegisteredMem(getAgent(2), size, count, DRAM_SEG, plain_src_buffers);
+    createRegisteredMem(getAgent(3), size, count, DRAM_SEG, plain_dst_buffers);
+
+    exchangeMD(0, 1);
+    exchangeMD(2, 3);
+    const double striped = measureBandwidth(0, 1, src_buffers, dst_buffers, size, repeat);
+    const double plain =
+        measureBandwidth(2, 3, plain_src_buffers, plain_dst_buffers, size, repeat);
+    Logger() << size << "x" << count << "x" << repeat << " writes: " << striped
+             << " GB/s striped over " << getNumWorkers() << " workers, " << plain
+             << " GB/s on one worker";
+
+    invalidateMD(0, 1);
+    invalidateMD(2, 3);
+    deregisterMem(getAgent(0), src_buffers, DRAM_SEG);
+    deregisterMem(getAgent(1), dst_buffers, DRAM_SEG);
+    deregisterMem(getAgent(2), plain_src_buffers, DRAM_SEG);
+    deregisterMem(getAgent(3), plain_dst_buffers, DRAM_SEG);
+}
+
 TEST_P(TestTransferTelemetry, GetXferTelemetryFile) {
     env.addVar("NIXL_TELEMETRY_ENABLE", "y");
     env.addVar("NIXL_TELEMETRY_DIR", "/tmp/");
@@ -667,4 +800,14 @@ NIXL_INSTANTIATE_TEST(ucx_telemetry_threadpool_no_pt,
                       4,
                       "");
 
+NIXL_INSTANTIATE_TEST(ucx_striped, TestTransferStriped, "UCX", true, 4, 0, "");
+NIXL_INSTANTIATE_TEST(ucx_striped_no_pt, TestTransferStriped, "UCX", false, 4, 0, "");
+NIXL_INSTANTIATE_TEST(ucx_striped_threadpool, TestTransferStriped, "UCX", true, 6, 4, "");
+
+NIXL_INSTANTIATE_TEST(shm, TestTransfer, "SHM", true, 0, 4, "");
+NIXL_INSTANTIATE_TEST(shm_inline, TestTransfer, "SHM", false, 0, 0, "");
+
+NIXL_INSTANTIATE_TEST(tcp, TestTransfer, "TCP", true, 0, 2, "");
+NIXL_INSTANTIATE_TEST(tcp_no_pt, TestTransfer, "TCP", false, 0, 1, "");
+
 } // namespace gtest
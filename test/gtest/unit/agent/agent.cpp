@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <numeric>
 #include <random>
 
 #include "common.h"
@@ -393,6 +394,113 @@ namespace agent {
         EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl2), NIXL_SUCCESS);
     }
 
+    TEST_F(dualAgentBridgeFixture, XferReqSpansTest) {
+        // More descriptors than kept inline in the request
+        constexpr int num_descs = 2 * nixlMetaDescBuf::kInlineDescs;
+        const auto &gmock_engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(gmock_engine, supportsXferSpans()).WillByDefault(testing::Return(true));
+        EXPECT_CALL(gmock_engine, prepXfer).Times(0);
+        EXPECT_CALL(gmock_engine, postXfer).Times(0);
+
+        nixl_b_params_t local_params, remote_params;
+        nixlBackendH *local_backend, *remote_backend;
+        EXPECT_EQ(local_agent_helper_->createBackendWithGMock(local_params, local_backend),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(remote_agent_helper_->createBackendWithGMock(remote_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        nixl_reg_dlist_t local_reg_dlist(DRAM_SEG), remote_reg_dlist(DRAM_SEG);
+        nixl_opt_args_t local_extra_params, remote_extra_params;
+        blob local_blob, remote_blob;
+        EXPECT_EQ(local_agent_helper_->initAndRegisterMemory(
+                      local_blob, local_reg_dlist, local_extra_params, local_backend),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(remote_agent_helper_->initAndRegisterMemory(
+                      remote_blob, remote_reg_dlist, remote_extra_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        std::string remote_agent_name_out;
+        EXPECT_EQ(local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out),
+                  NIXL_SUCCESS);
+
+        // Back to back blocks of the blobs
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        const nixlBlobDesc local_desc = local_blob.getDesc();
+        const nixlBlobDesc remote_desc = remote_blob.getDesc();
+        const size_t block_len = local_desc.len / num_descs;
+        for (int i = 0; i < num_descs; i++) {
+            local_xfer_dlist.addDesc(
+                nixlBasicDesc(local_desc.addr + i * block_len, block_len, local_desc.devId));
+            remote_xfer_dlist.addDesc(
+                nixlBasicDesc(remote_desc.addr + i * block_len, block_len, remote_desc.devId));
+        }
+
+        // createXferReq keeps the descriptors as given
+        EXPECT_CALL(gmock_engine, prepXferSpans)
+            .WillOnce([&](const nixl_xfer_op_t &,
+                          const nixl_meta_span_t &local,
+                          const nixl_meta_span_t &remote,
+                          const std::string &,
+                          nixlBackendReqH *&,
+                          const nixl_opt_b_args_t *) {
+                EXPECT_EQ(local.getType(), DRAM_SEG);
+                EXPECT_EQ(local.descCount(), num_descs);
+                EXPECT_EQ(remote.descCount(), num_descs);
+                for (int i = 0; i < num_descs; i++) {
+                    EXPECT_EQ(local[i].addr, local_xfer_dlist[i].addr);
+                    EXPECT_EQ(remote[i].addr, remote_xfer_dlist[i].addr);
+                    EXPECT_EQ(local[i].len, block_len);
+                }
+                return NIXL_SUCCESS;
+            });
+        EXPECT_CALL(gmock_engine, postXferSpans).WillOnce(testing::Return(NIXL_SUCCESS));
+
+        nixlXferReqH *xfer_req;
+        EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                              local_xfer_dlist,
+                                              remote_xfer_dlist,
+                                              remote_agent_name_out,
+                                              xfer_req,
+                                              &local_extra_params),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // makeXferReq merges them into a single descriptor
+        EXPECT_CALL(gmock_engine, prepXferSpans)
+            .WillOnce([&](const nixl_xfer_op_t &,
+                          const nixl_meta_span_t &local,
+                          const nixl_meta_span_t &remote,
+                          const std::string &,
+                          nixlBackendReqH *&,
+                          const nixl_opt_b_args_t *) {
+                EXPECT_EQ(local.descCount(), 1);
+                EXPECT_EQ(remote.descCount(), 1);
+                EXPECT_EQ(local[0].addr, local_desc.addr);
+                EXPECT_EQ(local[0].len, num_descs * block_len);
+                return NIXL_SUCCESS;
+            });
+
+        nixlDlistH *desc_hndl1, *desc_hndl2;
+        EXPECT_EQ(local_agent_->prepXferDlist(local_xfer_dlist, desc_hndl1), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->prepXferDlist(remote_agent_name_out, remote_xfer_dlist, desc_hndl2),
+                  NIXL_SUCCESS);
+
+        std::vector<int> indices(num_descs);
+        std::iota(indices.begin(), indices.end(), 0);
+        EXPECT_EQ(local_agent_->makeXferReq(NIXL_WRITE,
+                                            desc_hndl1,
+                                            indices,
+                                            desc_hndl2,
+                                            indices,
+                                            xfer_req,
+                                            &local_extra_params),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl1), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl2), NIXL_SUCCESS);
+    }
+
     TEST_F(dualAgentBridgeFixture, GenNotifTest) {
         const std::string msg = "notification";
         EXPECT_CALL(remote_agent_helper_->getGMockEngine(), getNotifs)
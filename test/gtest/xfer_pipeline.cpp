@@ -0,0 +1,261 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "nixl.h"
+
+namespace {
+
+constexpr auto kTimeout = std::chrono::seconds(30);
+
+std::vector<uint8_t>
+makePattern(size_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(seed + i * 7 + (i >> 12));
+    }
+    return data;
+}
+
+nixl_reg_dlist_t
+regDescs(nixl_mem_t type, const std::vector<std::vector<uint8_t>> &bufs) {
+    nixl_reg_dlist_t descs(type);
+    for (const auto &buf : bufs) {
+        descs.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(buf.data()), buf.size(), 0));
+    }
+    return descs;
+}
+
+nixl_xfer_dlist_t
+xferDescs(nixl_mem_t type, const std::vector<std::vector<uint8_t>> &bufs) {
+    nixl_xfer_dlist_t descs(type);
+    for (const auto &buf : bufs) {
+        descs.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(buf.data()), buf.size(), 0));
+    }
+    return descs;
+}
+
+nixlAgentConfig
+agentConfig() {
+    nixlAgentConfig cfg;
+    cfg.useProgThread = true;
+    cfg.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_RW;
+    return cfg;
+}
+
+nixl_status_t
+waitXfer(nixlAgent &agent, nixlXferReqH *req) {
+    const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    nixl_status_t status = agent.getXferStatus(req);
+    while ((status == NIXL_IN_PROG) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+        status = agent.getXferStatus(req);
+    }
+    return status;
+}
+
+bool
+waitNotif(nixlAgent &agent, const std::string &from, const nixl_blob_t &msg) {
+    const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    nixl_notifs_t notifs;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (agent.getNotifs(notifs) != NIXL_SUCCESS) {
+            return false;
+        }
+        for (const auto &notif : notifs[from]) {
+            if (notif == msg) {
+                return true;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} // namespace
+
+class PipelineTest : public ::testing::Test {
+protected:
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    // Bounce buffers of the stages, kept alive until the end of the test
+    nixlPipelineConfig
+    makeConfig(nixlAgent &agent, const std::vector<size_t> &buffers_per_stage) {
+        nixlPipelineConfig cfg;
+        cfg.chunkSize = kChunkSize;
+        for (size_t count : buffers_per_stage) {
+            std::vector<std::vector<uint8_t>> stage(count, std::vector<uint8_t>(kChunkSize));
+            EXPECT_EQ(agent.registerMem(regDescs(DRAM_SEG, stage)), NIXL_SUCCESS);
+            cfg.bounceStages.push_back(xferDescs(DRAM_SEG, stage));
+            bounce_.push_back(std::move(stage));
+        }
+        return cfg;
+    }
+
+    std::vector<std::vector<std::vector<uint8_t>>> bounce_;
+};
+
+TEST_F(PipelineTest, LocalStages) {
+    nixlAgent agent("pipeline", agentConfig());
+    nixlBackendH *local = nullptr;
+    ASSERT_EQ(agent.createBackend("LOCAL", {}, local), NIXL_SUCCESS);
+
+    // Descriptors smaller than, across and larger than a chunk
+    const std::vector<size_t> sizes = {100, kChunkSize - 1, 3 * kChunkSize + 17, 4096, 1};
+    std::vector<std::vector<uint8_t>> src, dst;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        src.push_back(makePattern(sizes[i], i));
+        dst.emplace_back(sizes[i], 0);
+    }
+    ASSERT_EQ(agent.registerMem(regDescs(DRAM_SEG, src)), NIXL_SUCCESS);
+    ASSERT_EQ(agent.registerMem(regDescs(DRAM_SEG, dst)), NIXL_SUCCESS);
+
+    const nixlPipelineConfig cfg = makeConfig(agent, {2, 3});
+    nixlXferReqH *req = nullptr;
+    ASSERT_EQ(agent.createPipelineXferReq(
+                  xferDescs(DRAM_SEG, src), "pipeline", xferDescs(DRAM_SEG, dst), "pipeline", cfg,
+                  req),
+              NIXL_SUCCESS);
+
+    // Reposting moves the new content of the source
+    for (uint8_t round = 0; round < 2; ++round) {
+        // Refilled in place, the pipeline holds the addresses of the registered buffers
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            const std::vector<uint8_t> pattern = makePattern(sizes[i], i + round * 31);
+            std::copy(pattern.begin(), pattern.end(), src[i].begin());
+        }
+
+        const nixl_status_t status = agent.postXferReq(req);
+        ASSERT_GE(status, NIXL_SUCCESS);
+        ASSERT_EQ(waitXfer(agent, req), NIXL_SUCCESS);
+        for (size_t i = 0; i < sizes.size(); ++i) {
+            EXPECT_EQ(src[i], dst[i]) << "descriptor " << i << ", round " << int(round);
+        }
+    }
+
+    EXPECT_EQ(agent.releaseXferReq(req), NIXL_SUCCESS);
+}
+
+TEST_F(PipelineTest, FileToRemote) {
+    nixlAgent initiator("initiator", agentConfig());
+    nixlAgent target("target", agentConfig());
+
+    nixlBackendH *posix = nullptr;
+    nixlBackendH *init_tcp = nullptr;
+    nixlBackendH *target_tcp = nullptr;
+    ASSERT_EQ(initiator.createBackend("POSIX", {}, posix), NIXL_SUCCESS);
+    ASSERT_EQ(initiator.createBackend("TCP", {}, init_tcp), NIXL_SUCCESS);
+    ASSERT_EQ(target.createBackend("TCP", {}, target_tcp), NIXL_SUCCESS);
+
+    const size_t size = 16 * kChunkSize + 123;
+    const std::vector<uint8_t> data = makePattern(size, 5);
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "nixl_pipeline_test.bin").string();
+    const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pwrite(fd, data.data(), size, 0), static_cast<ssize_t>(size));
+
+    nixl_reg_dlist_t file_reg(FILE_SEG);
+    file_reg.addDesc(nixlBlobDesc(0, size, fd));
+    ASSERT_EQ(initiator.registerMem(file_reg), NIXL_SUCCESS);
+
+    std::vector<std::vector<uint8_t>> dst(1, std::vector<uint8_t>(size, 0));
+    ASSERT_EQ(target.registerMem(regDescs(DRAM_SEG, dst)), NIXL_SUCCESS);
+
+    nixl_blob_t md;
+    std::string name;
+    ASSERT_EQ(target.getLocalMD(md), NIXL_SUCCESS);
+    ASSERT_EQ(initiator.loadRemoteMD(md, name), NIXL_SUCCESS);
+    ASSERT_EQ(initiator.getLocalMD(md), NIXL_SUCCESS);
+    ASSERT_EQ(target.loadRemoteMD(md, name), NIXL_SUCCESS);
+
+    // POSIX reads the file into the bounce buffers, TCP writes them to the target
+    nixlPipelineConfig cfg = makeConfig(initiator, {3});
+    cfg.hopBackends = {posix, init_tcp};
+
+    nixl_xfer_dlist_t src(FILE_SEG);
+    src.addDesc(nixlBasicDesc(0, size, fd));
+    nixl_opt_args_t extra_params;
+    extra_params.notif = "pipeline-done";
+    nixlXferReqH *req = nullptr;
+    ASSERT_EQ(initiator.createPipelineXferReq(
+                  src, "initiator", xferDescs(DRAM_SEG, dst), "target", cfg, req, &extra_params),
+              NIXL_SUCCESS);
+
+    ASSERT_GE(initiator.postXferReq(req), NIXL_SUCCESS);
+    ASSERT_EQ(waitXfer(initiator, req), NIXL_SUCCESS);
+    EXPECT_TRUE(waitNotif(target, "initiator", "pipeline-done"));
+    EXPECT_EQ(dst[0], data);
+
+    nixlBackendH *backend = nullptr;
+    EXPECT_EQ(initiator.queryXferBackend(req, backend), NIXL_ERR_NOT_SUPPORTED);
+    EXPECT_EQ(initiator.releaseXferReq(req), NIXL_SUCCESS);
+
+    EXPECT_EQ(target.deregisterMem(regDescs(DRAM_SEG, dst)), NIXL_SUCCESS);
+    EXPECT_EQ(initiator.deregisterMem(file_reg), NIXL_SUCCESS);
+    close(fd);
+    std::filesystem::remove(path);
+}
+
+TEST_F(PipelineTest, InvalidConfig) {
+    nixlAgent agent("pipeline", agentConfig());
+    nixlBackendH *local = nullptr;
+    ASSERT_EQ(agent.createBackend("LOCAL", {}, local), NIXL_SUCCESS);
+
+    std::vector<std::vector<uint8_t>> src(1, makePattern(kChunkSize, 0));
+    std::vector<std::vector<uint8_t>> dst(1, std::vector<uint8_t>(kChunkSize));
+    const nixl_xfer_dlist_t src_descs = xferDescs(DRAM_SEG, src);
+    const nixl_xfer_dlist_t dst_descs = xferDescs(DRAM_SEG, dst);
+    nixlXferReqH *req = nullptr;
+
+    nixlPipelineConfig no_stage;
+    EXPECT_EQ(agent.createPipelineXferReq(
+                  src_descs, "pipeline", dst_descs, "pipeline", no_stage, req),
+              NIXL_ERR_INVALID_PARAM);
+
+    nixlPipelineConfig small_buffers = makeConfig(agent, {2});
+    small_buffers.chunkSize = 2 * kChunkSize;
+    EXPECT_EQ(agent.createPipelineXferReq(
+                  src_descs, "pipeline", dst_descs, "pipeline", small_buffers, req),
+              NIXL_ERR_INVALID_PARAM);
+
+    nixlPipelineConfig wrong_hops = makeConfig(agent, {2});
+    wrong_hops.hopBackends = {local};
+    EXPECT_EQ(agent.createPipelineXferReq(
+                  src_descs, "pipeline", dst_descs, "pipeline", wrong_hops, req),
+              NIXL_ERR_INVALID_PARAM);
+
+    std::vector<std::vector<uint8_t>> short_dst(1, std::vector<uint8_t>(kChunkSize / 2));
+    EXPECT_EQ(agent.createPipelineXferReq(src_descs,
+                                          "pipeline",
+                                          xferDescs(DRAM_SEG, short_dst),
+                                          "pipeline",
+                                          makeConfig(agent, {1}),
+                                          req),
+              NIXL_ERR_INVALID_PARAM);
+    EXPECT_EQ(req, nullptr);
+}
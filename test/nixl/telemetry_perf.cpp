@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures the overhead of telemetry on postXferReq, with several threads
+ * posting transfers through the same agent:
+ *
+ *   telemetry_perf [num_iters] [num_threads1,num_threads2,...]
+ *
+ * Every thread owns a transfer request between two local agents over UCX,
+ * and repeatedly posts it and waits for its completion. The postXferReq call
+ * is timed on its own, the cycle includes the completion which records the
+ * transfer events. Telemetry is enabled with the buffer exporter writing to
+ * a temporary directory.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "absl/strings/str_split.h"
+#include "nixl.h"
+#include "test_utils.h"
+
+namespace {
+const std::string agent1 = "TelemetryPerf1";
+const std::string agent2 = "TelemetryPerf2";
+constexpr size_t msg_size = 8;
+
+struct threadStats {
+    std::vector<double> postNs;
+    double cycleNs = 0;
+};
+
+void
+runThread(nixlAgent &agent,
+          const std::string &remote_name,
+          uintptr_t src,
+          uintptr_t dst,
+          size_t num_iters,
+          threadStats &stats) {
+    nixl_xfer_dlist_t src_list(DRAM_SEG), dst_list(DRAM_SEG);
+    src_list.addDesc(nixlBasicDesc(src, msg_size, 0));
+    dst_list.addDesc(nixlBasicDesc(dst, msg_size, 0));
+
+    nixlXferReqH *req = nullptr;
+    nixl_exit_on_failure(agent.createXferReq(NIXL_WRITE, src_list, dst_list, remote_name, req),
+                         "Failed to create xfer req",
+                         agent1);
+
+    stats.postNs.reserve(num_iters);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_iters; i++) {
+        const auto post_start = std::chrono::steady_clock::now();
+        nixl_status_t status = agent.postXferReq(req);
+        const std::chrono::duration<double, std::nano> post_time =
+            std::chrono::steady_clock::now() - post_start;
+        stats.postNs.push_back(post_time.count());
+
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus(req);
+        }
+        nixl_exit_on_failure(status, "Failed to complete xfer", agent1);
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    stats.cycleNs = elapsed.count() / num_iters;
+
+    nixl_exit_on_failure(agent.releaseXferReq(req), "Failed to release xfer req", agent1);
+}
+
+void
+runMode(bool telemetry, size_t num_threads, size_t num_iters) {
+    std::filesystem::path telemetry_dir;
+    if (telemetry) {
+        char dir_template[] = "/tmp/nixl_telemetry_perf_XXXXXX";
+        nixl_exit_on_failure(mkdtemp(dir_template) != nullptr, "Failed to create telemetry dir");
+        telemetry_dir = dir_template;
+        setenv("NIXL_TELEMETRY_ENABLE", "y", 1);
+        setenv("NIXL_TELEMETRY_DIR", telemetry_dir.c_str(), 1);
+    } else {
+        unsetenv("NIXL_TELEMETRY_ENABLE");
+    }
+
+    nixlAgentConfig cfg;
+    cfg.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_RW;
+
+    {
+        nixlAgent A1(agent1, cfg);
+        nixlAgent A2(agent2, cfg);
+
+        nixl_b_params_t params;
+        nixl_mem_list_t mems;
+        nixlBackendH *backend1, *backend2;
+        nixl_exit_on_failure(A1.getPluginParams("UCX", mems, params), "No UCX plugin", agent1);
+        nixl_exit_on_failure(
+            A1.createBackend("UCX", params, backend1), "Failed to create backend", agent1);
+        nixl_exit_on_failure(
+            A2.createBackend("UCX", params, backend2), "Failed to create backend", agent2);
+
+        std::vector<char> src(msg_size * num_threads), dst(msg_size * num_threads);
+        nixl_reg_dlist_t src_regs(DRAM_SEG), dst_regs(DRAM_SEG);
+        src_regs.addDesc(nixlBlobDesc((uintptr_t)src.data(), src.size(), 0));
+        dst_regs.addDesc(nixlBlobDesc((uintptr_t)dst.data(), dst.size(), 0));
+        nixl_exit_on_failure(A1.registerMem(src_regs), "Failed to register memory", agent1);
+        nixl_exit_on_failure(A2.registerMem(dst_regs), "Failed to register memory", agent2);
+
+        std::string meta2, remote_name;
+        nixl_exit_on_failure(A2.getLocalMD(meta2), "Failed to get local MD", agent2);
+        nixl_exit_on_failure(
+            A1.loadRemoteMD(meta2, remote_name), "Failed to load remote MD", agent1);
+
+        std::vector<threadStats> stats(num_threads);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back(runThread,
+                                 std::ref(A1),
+                                 std::cref(remote_name),
+                                 (uintptr_t)src.data() + t * msg_size,
+                                 (uintptr_t)dst.data() + t * msg_size,
+                                 num_iters,
+                                 std::ref(stats[t]));
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        std::vector<double> post_ns;
+        double cycle_ns = 0;
+        for (const auto &thread_stats : stats) {
+            post_ns.insert(post_ns.end(), thread_stats.postNs.begin(), thread_stats.postNs.end());
+            cycle_ns += thread_stats.cycleNs / num_threads;
+        }
+        std::sort(post_ns.begin(), post_ns.end());
+        double post_avg = 0;
+        for (double ns : post_ns) {
+            post_avg += ns / post_ns.size();
+        }
+
+        std::cout << std::left << std::setw(12) << (telemetry ? "on" : "off") << std::right
+                  << std::setw(10) << num_threads << std::fixed << std::setprecision(1)
+                  << std::setw(14) << post_avg << std::setw(14) << post_ns[post_ns.size() / 2]
+                  << std::setw(14) << post_ns[post_ns.size() * 99 / 100] << std::setw(14)
+                  << cycle_ns << std::endl;
+
+        A1.invalidateRemoteMD(remote_name);
+        A1.deregisterMem(src_regs);
+        A2.deregisterMem(dst_regs);
+    }
+
+    if (telemetry) {
+        std::filesystem::remove_all(telemetry_dir);
+    }
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t num_iters = (argc > 1) ? std::stoul(argv[1]) : 100000;
+    std::vector<size_t> thread_counts = {1, 2, 4, 8};
+    if (argc > 2) {
+        thread_counts.clear();
+        for (auto count : absl::StrSplit(argv[2], ',')) {
+            thread_counts.push_back(std::stoul(std::string(count)));
+            nixl_exit_on_failure(thread_counts.back() > 0, "Number of threads must be positive");
+        }
+    }
+
+    nixl_exit_on_failure(num_iters > 0, "Number of iterations must be positive");
+
+    std::cout << std::left << std::setw(12) << "telemetry" << std::right << std::setw(10)
+              << "threads" << std::setw(14) << "post avg ns" << std::setw(14) << "post p50 ns"
+              << std::setw(14) << "post p99 ns" << std::setw(14) << "cycle ns" << std::endl;
+
+    for (size_t num_threads : thread_counts) {
+        for (bool telemetry : {false, true}) {
+            pid_t pid = fork();
+            nixl_exit_on_failure(pid >= 0, "Failed to fork");
+            if (pid == 0) {
+                runMode(telemetry, num_threads, num_iters);
+                exit(EXIT_SUCCESS);
+            }
+
+            int status;
+            waitpid(pid, &status, 0);
+            nixl_exit_on_failure(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+                                 "Benchmark process failed");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures the cost of request handle management in the UCX backend, with
+ * and without the handle freelists:
+ *
+ *   ucx_handle_perf [num_iters] [msg_size]
+ *
+ * Every cycle is prepXfer + releaseReqH, optionally with a transfer posted in
+ * between. Heap allocations are counted by replacing the global operator new.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ucx_backend.h"
+#include "test_utils.h"
+
+namespace {
+std::atomic<size_t> num_allocs{0};
+} // namespace
+
+void *
+operator new(size_t size) {
+    num_allocs.fetch_add(1, std::memory_order_relaxed);
+    void *ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void
+operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void
+operator delete(void *ptr, size_t) noexcept {
+    free(ptr);
+}
+
+namespace {
+const std::string agent_name = "Agent1";
+
+void
+runMode(bool pooled, size_t num_iters, size_t msg_size) {
+    nixlBackendInitParams init;
+    nixl_b_params_t custom_params;
+
+    custom_params["handle_pool_size"] = pooled ? "1024" : "0";
+
+    init.enableProgTh = false;
+    init.localAgent = agent_name;
+    init.customParams = &custom_params;
+    init.type = "UCX";
+
+    auto ucx = nixlUcxEngine::create(init);
+    nixl_exit_on_failure(!ucx->getInitErr(), "Failed to initialize UCX engine");
+
+    std::string conn_info;
+    nixl_exit_on_failure(ucx->getConnInfo(conn_info), "Failed to get conn info");
+    nixl_exit_on_failure(ucx->loadRemoteConnInfo(agent_name, conn_info),
+                         "Failed to load conn info");
+
+    std::vector<char> src(msg_size), dst(msg_size);
+    nixlBlobDesc desc;
+    nixlBackendMD *src_md, *dst_md, *remote_md;
+
+    desc.addr = (uintptr_t)src.data();
+    desc.len = msg_size;
+    desc.devId = 0;
+    nixl_exit_on_failure(ucx->registerMem(desc, DRAM_SEG, src_md), "Failed to register src");
+    desc.addr = (uintptr_t)dst.data();
+    nixl_exit_on_failure(ucx->registerMem(desc, DRAM_SEG, dst_md), "Failed to register dst");
+    nixl_exit_on_failure(ucx->getPublicData(dst_md, desc.metaInfo), "Failed to get public data");
+    nixl_exit_on_failure(ucx->loadRemoteMD(desc, DRAM_SEG, agent_name, remote_md),
+                         "Failed to load remote MD");
+
+    nixl_meta_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    nixlMetaDesc l_desc, r_desc;
+    l_desc.addr = (uintptr_t)src.data();
+    l_desc.len = msg_size;
+    l_desc.devId = 0;
+    l_desc.metadataP = src_md;
+    r_desc.addr = (uintptr_t)dst.data();
+    r_desc.len = msg_size;
+    r_desc.devId = 0;
+    r_desc.metadataP = remote_md;
+    local.addDesc(l_desc);
+    remote.addDesc(r_desc);
+
+    for (bool post : {false, true}) {
+        const size_t allocs_before = num_allocs.load();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < num_iters; i++) {
+            nixlBackendReqH *handle = nullptr;
+            nixl_status_t ret = ucx->prepXfer(NIXL_WRITE, local, remote, agent_name, handle);
+            nixl_exit_on_failure(ret, "Failed to prep xfer");
+            if (post) {
+                ret = ucx->postXfer(NIXL_WRITE, local, remote, agent_name, handle);
+                while (ret == NIXL_IN_PROG) {
+                    ret = ucx->checkXfer(handle);
+                }
+                nixl_exit_on_failure(ret, "Failed to complete xfer");
+            }
+            ucx->releaseReqH(handle);
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        const size_t allocs = num_allocs.load() - allocs_before;
+
+        std::cout << std::left << std::setw(10) << (pooled ? "pooled" : "unpooled")
+                  << std::setw(14) << (post ? "prep+post" : "prep") << std::right
+                  << std::setw(10) << msg_size << std::fixed << std::setprecision(1)
+                  << std::setw(16) << elapsed.count() / num_iters << std::setw(16)
+                  << double(allocs) / num_iters << std::endl;
+    }
+
+    ucx->unloadMD(remote_md);
+    ucx->deregisterMem(src_md);
+    ucx->deregisterMem(dst_md);
+    ucx->disconnect(agent_name);
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t num_iters = (argc > 1) ? std::stoul(argv[1]) : 100000;
+    const size_t msg_size = (argc > 2) ? std::stoul(argv[2]) : 8;
+
+    nixl_exit_on_failure(num_iters > 0, "Number of iterations must be positive");
+
+    std::cout << std::left << std::setw(10) << "handles" << std::setw(14) << "cycle"
+              << std::right << std::setw(10) << "size" << std::setw(16) << "ns/cycle"
+              << std::setw(16) << "allocs/cycle" << std::endl;
+
+    for (bool pooled : {false, true}) {
+        pid_t pid = fork();
+        nixl_exit_on_failure(pid >= 0, "Failed to fork");
+        if (pid == 0) {
+            runMode(pooled, num_iters, msg_size);
+            exit(EXIT_SUCCESS);
+        }
+
+        int status;
+        waitpid(pid, &status, 0);
+        nixl_exit_on_failure(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+                             "Benchmark process failed");
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures notification latency against the CPU consumed by the UCX progress
+ * thread, for several progress policies and request rates:
+ *
+ *   ucx_progress_perf [duration_ms] [rate1,rate2,...]
+ *
+ * Requests are notifications sent to self at a fixed rate, their latency is
+ * the time until getNotifs() returns them. getNotifs() does not progress the
+ * workers when the progress thread is enabled, so the delivery depends only
+ * on the progress thread. The CPU time of the progress thread is the process
+ * CPU time without the time of the main thread.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "absl/strings/str_split.h"
+#include "ucx_backend.h"
+#include "test_utils.h"
+
+namespace {
+const std::string agent_name = "Agent1";
+
+struct progressMode {
+    std::string name;
+    nixl_b_params_t params;
+};
+
+double
+getCpuSec(int who) {
+    struct rusage usage;
+    getrusage(who, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+        (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+void
+runMode(const progressMode &mode, size_t rate, std::chrono::milliseconds duration) {
+    nixlBackendInitParams init;
+    nixl_b_params_t custom_params = mode.params;
+
+    init.enableProgTh = true;
+    init.pthrDelay = 0;
+    init.localAgent = agent_name;
+    init.customParams = &custom_params;
+    init.type = "UCX";
+
+    auto ucx = nixlUcxEngine::create(init);
+    nixl_exit_on_failure(!ucx->getInitErr(), "Failed to initialize UCX engine");
+
+    std::string conn_info;
+    nixl_exit_on_failure(ucx->getConnInfo(conn_info), "Failed to get conn info");
+    nixl_exit_on_failure(ucx->loadRemoteConnInfo(agent_name, conn_info),
+                         "Failed to load conn info");
+
+    const auto interval = std::chrono::nanoseconds(std::chrono::seconds(1)) / rate;
+    std::vector<double> latencies;
+    latencies.reserve(duration / interval + 1);
+
+    const double cpu_self_start = getCpuSec(RUSAGE_SELF);
+    const double cpu_main_start = getCpuSec(RUSAGE_THREAD);
+    const auto start = std::chrono::steady_clock::now();
+    auto next = start;
+    while (std::chrono::steady_clock::now() - start < duration) {
+        std::this_thread::sleep_until(next);
+        next += interval;
+
+        const auto sent = std::chrono::steady_clock::now();
+        nixl_exit_on_failure(ucx->genNotif(agent_name, "ping"), "Failed to send notification");
+
+        notif_list_t notifs;
+        do {
+            notifs.clear();
+            nixl_exit_on_failure(ucx->getNotifs(notifs), "Failed to get notifications");
+        } while (notifs.empty());
+
+        const std::chrono::duration<double, std::micro> latency =
+            std::chrono::steady_clock::now() - sent;
+        latencies.push_back(latency.count());
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double cpu_main = getCpuSec(RUSAGE_THREAD) - cpu_main_start;
+    const double cpu_progress = getCpuSec(RUSAGE_SELF) - cpu_self_start - cpu_main;
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies[std::min(latencies.size() - 1, size_t(p * latencies.size()))];
+    };
+
+    std::cout << std::left << std::setw(10) << mode.name << std::right << std::setw(10) << rate
+              << std::fixed << std::setprecision(1) << std::setw(12)
+              << latencies.size() / elapsed.count() << std::setw(12) << percentile(0.5)
+              << std::setw(12) << percentile(0.99) << std::setw(12)
+              << 100 * cpu_progress / elapsed.count() << std::endl;
+
+    ucx->disconnect(agent_name);
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const std::chrono::milliseconds duration((argc > 1) ? std::stoul(argv[1]) : 1000);
+    std::vector<size_t> rates = {100, 1000, 10000, 100000};
+    if (argc > 2) {
+        rates.clear();
+        for (auto rate : absl::StrSplit(argv[2], ',')) {
+            rates.push_back(std::stoul(std::string(rate)));
+            nixl_exit_on_failure(rates.back() > 0, "Request rate must be positive");
+        }
+    }
+
+    const std::vector<progressMode> modes = {
+        {"busy", {}},
+        {"sleep", {{"progress_min_sleep_us", "1000"}, {"progress_max_sleep_us", "1000"}}},
+        {"adaptive",
+         {{"progress_spin_us", "50"},
+          {"progress_min_sleep_us", "10"},
+          {"progress_max_sleep_us", "1000"}}},
+    };
+
+    std::cout << std::left << std::setw(10) << "policy" << std::right << std::setw(10)
+              << "rate" << std::setw(12) << "achieved" << std::setw(12) << "p50 [us]"
+              << std::setw(12) << "p99 [us]" << std::setw(12) << "pthr CPU %" << std::endl;
+
+    for (const auto &mode : modes) {
+        for (size_t rate : rates) {
+            pid_t pid = fork();
+            nixl_exit_on_failure(pid >= 0, "Failed to fork");
+            if (pid == 0) {
+                runMode(mode, rate, duration);
+                exit(EXIT_SUCCESS);
+            }
+
+            int status;
+            waitpid(pid, &status, 0);
+            nixl_exit_on_failure(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+                                 "Benchmark process failed");
+        }
+    }
+
+    return 0;
+}
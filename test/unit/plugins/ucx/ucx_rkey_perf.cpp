@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures the cost of loading remote metadata in the UCX backend, with lazy
+ * and eager rkey unpacking:
+ *
+ *   ucx_rkey_perf [num_regions] [num_workers] [num_touched]
+ *
+ * Every mode runs in a forked process so that RSS numbers are not polluted by
+ * memory retained by the allocator from a previous run.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ucx_backend.h"
+#include "test_utils.h"
+
+namespace {
+const std::string agent_name = "Agent1";
+
+size_t
+getRssKb() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total = 0, resident = 0;
+    statm >> total >> resident;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+void
+runMode(bool lazy, size_t num_regions, size_t num_workers, size_t num_touched) {
+    nixlBackendInitParams init;
+    nixl_b_params_t custom_params;
+
+    custom_params["num_workers"] = std::to_string(num_workers);
+    custom_params["lazy_rkey_unpack"] = lazy ? "1" : "0";
+
+    init.enableProgTh = false;
+    init.localAgent = agent_name;
+    init.customParams = &custom_params;
+    init.type = "UCX";
+
+    auto ucx = nixlUcxEngine::create(init);
+    nixl_exit_on_failure(!ucx->getInitErr(), "Failed to initialize UCX engine");
+
+    std::string conn_info;
+    nixl_exit_on_failure(ucx->getConnInfo(conn_info), "Failed to get conn info");
+    nixl_exit_on_failure(ucx->loadRemoteConnInfo(agent_name, conn_info),
+                         "Failed to load conn info");
+
+    // A single registration is enough, what is measured is the number of
+    // remote descriptors, each of them carries its own copy of the packed rkey
+    const size_t len = 4096 * 2;
+    std::vector<char> src(len), dst(len);
+    nixlBlobDesc desc;
+    nixlBackendMD *src_md, *dst_md;
+
+    desc.addr = (uintptr_t)src.data();
+    desc.len = len;
+    desc.devId = 0;
+    nixl_exit_on_failure(ucx->registerMem(desc, DRAM_SEG, src_md), "Failed to register src");
+    desc.addr = (uintptr_t)dst.data();
+    nixl_exit_on_failure(ucx->registerMem(desc, DRAM_SEG, dst_md), "Failed to register dst");
+    nixl_exit_on_failure(ucx->getPublicData(dst_md, desc.metaInfo), "Failed to get public data");
+
+    std::vector<nixlBackendMD *> remote_mds(num_regions);
+    const size_t rss_before = getRssKb();
+    auto start = std::chrono::steady_clock::now();
+    for (auto &md : remote_mds) {
+        nixl_exit_on_failure(ucx->loadRemoteMD(desc, DRAM_SEG, agent_name, md),
+                             "Failed to load remote MD");
+    }
+    const std::chrono::duration<double, std::milli> load_time =
+        std::chrono::steady_clock::now() - start;
+    const size_t rss_after = getRssKb();
+
+    // Touch a few regions to account for first-use unpacking on the datapath
+    nixl_meta_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    for (size_t i = 0; i < std::min(num_touched, num_regions); i++) {
+        nixlMetaDesc l_desc, r_desc;
+        l_desc.addr = (uintptr_t)src.data();
+        l_desc.len = len;
+        l_desc.devId = 0;
+        l_desc.metadataP = src_md;
+        r_desc.addr = (uintptr_t)dst.data();
+        r_desc.len = len;
+        r_desc.devId = 0;
+        r_desc.metadataP = remote_mds[i * (num_regions / num_touched)];
+        local.addDesc(l_desc);
+        remote.addDesc(r_desc);
+    }
+
+    nixlBackendReqH *handle = nullptr;
+    start = std::chrono::steady_clock::now();
+    nixl_status_t ret = ucx->prepXfer(NIXL_WRITE, local, remote, agent_name, handle);
+    nixl_exit_on_failure(ret, "Failed to prep xfer");
+    ret = ucx->postXfer(NIXL_WRITE, local, remote, agent_name, handle);
+    while (ret == NIXL_IN_PROG) {
+        ret = ucx->checkXfer(handle);
+    }
+    nixl_exit_on_failure(ret, "Failed to complete xfer");
+    const std::chrono::duration<double, std::milli> xfer_time =
+        std::chrono::steady_clock::now() - start;
+    ucx->releaseReqH(handle);
+
+    size_t unpacked = 0;
+    for (auto md : remote_mds) {
+        unpacked += static_cast<nixlUcxPublicMetadata *>(md)->getNumUnpacked();
+    }
+
+    std::cout << std::left << std::setw(8) << (lazy ? "lazy" : "eager") << std::right
+              << std::setw(12) << num_regions << std::setw(10) << num_workers << std::fixed
+              << std::setprecision(2) << std::setw(16) << load_time.count() << std::setw(16)
+              << (rss_after - rss_before) / 1024.0 << std::setw(16) << xfer_time.count()
+              << std::setw(12) << unpacked << std::endl;
+
+    for (auto md : remote_mds) {
+        ucx->unloadMD(md);
+    }
+    ucx->deregisterMem(src_md);
+    ucx->deregisterMem(dst_md);
+    ucx->disconnect(agent_name);
+}
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t num_regions = (argc > 1) ? std::stoul(argv[1]) : 100000;
+    const size_t num_workers = (argc > 2) ? std::stoul(argv[2]) : 4;
+    const size_t num_touched = (argc > 3) ? std::stoul(argv[3]) : 64;
+
+    nixl_exit_on_failure(num_touched > 0, "Number of touched regions must be positive");
+
+    std::cout << std::left << std::setw(8) << "mode" << std::right << std::setw(12) << "regions"
+              << std::setw(10) << "workers" << std::setw(16) << "load [ms]" << std::setw(16)
+              << "load RSS [MB]" << std::setw(16) << "1st xfer [ms]" << std::setw(12)
+              << "unpacked" << std::endl;
+
+    for (bool lazy : {false, true}) {
+        pid_t pid = fork();
+        nixl_exit_on_failure(pid >= 0, "Failed to fork");
+        if (pid == 0) {
+            runMode(lazy, num_regions, num_workers, num_touched);
+            exit(EXIT_SUCCESS);
+        }
+
+        int status;
+        waitpid(pid, &status, 0);
+        nixl_exit_on_failure(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+                             "Benchmark process failed");
+    }
+
+    return 0;
+}
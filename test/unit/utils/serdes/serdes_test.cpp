@@ -59,5 +59,59 @@ int main() {
 
     free(ptr);
 
+    // Compressed blobs, a large repetitive one as metadata with many regions
+    nixlSerDes sd3;
+    std::string regions;
+    for (int r = 0; r < 4096; r++) {
+        regions += "region|" + std::to_string(r % 16) + "|0000000000001000|dev0|";
+    }
+    ret = sd3.addStr(t2, regions);
+    assert(ret == 0);
+    std::string raw = sd3.exportStr();
+
+    for (auto codec : {nixl_serdes_codec_t::NONE,
+                       nixl_serdes_codec_t::LZ4,
+                       nixl_serdes_codec_t::ZSTD}) {
+        std::string blob = sd3.exportStr(codec);
+        if (nixlSerDes::isCodecAvailable(codec) && codec != nixl_serdes_codec_t::NONE) {
+            assert(blob.size() < raw.size());
+        } else {
+            assert(blob == raw);
+        }
+
+        nixlSerDes sd4;
+        ret = sd4.importStr(blob);
+        assert(ret == 0);
+        assert(sd4.getStr(t2) == regions);
+    }
+
+    // Small blobs are left uncompressed
+    assert(sd.exportStr(nixl_serdes_codec_t::ZSTD) == sdbuf);
+
+    // Corrupted compressed blobs are rejected
+    std::string bad = sd3.exportStr(nixl_serdes_codec_t::ZSTD);
+    if (bad != raw) {
+        bad.resize(bad.size() / 2);
+        nixlSerDes sd5;
+        assert(sd5.importStr(bad) != 0);
+    }
+
+    // Headers claiming a larger uncompressed size than the payload can hold are rejected
+    std::string forged = "nixlSerDesZ";
+    forged.push_back(static_cast<char>(nixl_serdes_codec_t::LZ4));
+    uint64_t forged_size = 1ULL << 31;
+    forged.append(nixlSerDes::_bytesToString(&forged_size, sizeof(forged_size)));
+    forged.append(64, 'x');
+    nixlSerDes sd6;
+    assert(sd6.importStr(forged) != 0);
+
+    // Uncompressed blobs are always accepted
+    assert(nixlSerDes::getCodecMask() & (1U << static_cast<uint8_t>(nixl_serdes_codec_t::NONE)));
+
+    nixl_serdes_codec_t codec;
+    assert(nixlSerDes::parseCodec("lz4", codec) == NIXL_SUCCESS);
+    assert(codec == nixl_serdes_codec_t::LZ4);
+    assert(nixlSerDes::parseCodec("gzip", codec) != NIXL_SUCCESS);
+
     return 0;
 }